@@ -3,8 +3,9 @@
 const common = require('../common.js');
 
 const bench = common.createBenchmark(main, {
-  len: [0, 1, 64, 1024],
-  n: [1e7]
+  op: ['decode', 'encode'],
+  len: [0, 1, 64, 1024, 64 * 1024],
+  n: [1e5]
 });
 
 function main(conf) {
@@ -17,10 +18,15 @@ function main(conf) {
 
   const hex = buf.toString('hex');
 
-  bench.start();
-
-  for (let i = 0; i < n; i += 1)
-    Buffer.from(hex, 'hex');
-
-  bench.end(n);
+  if (conf.op === 'decode') {
+    bench.start();
+    for (let i = 0; i < n; i += 1)
+      Buffer.from(hex, 'hex');
+    bench.end(n);
+  } else {
+    bench.start();
+    for (let i = 0; i < n; i += 1)
+      buf.toString('hex');
+    bench.end(n);
+  }
 }
@@ -0,0 +1,46 @@
+'use strict';
+
+const common = require('../common.js');
+const buffer = require('buffer');
+
+const bench = common.createBenchmark(main, {
+  op: ['isUtf8', 'isAscii', 'toString'],
+  type: ['ascii', 'latin1', 'cjk'],
+  len: [64, 1024, 64 * 1024],
+  n: [1e5]
+});
+
+const chars = {
+  ascii: '{"key":"value"}',
+  latin1: 'Déjà vu, naïve café',
+  cjk: '日本語のテキスト'
+};
+
+function main(conf) {
+  const len = conf.len | 0;
+  const n = conf.n | 0;
+  const text = chars[conf.type].repeat(len).slice(0, len);
+  const buf = Buffer.from(text);
+
+  var i;
+  switch (conf.op) {
+    case 'isUtf8':
+      bench.start();
+      for (i = 0; i < n; i++)
+        buffer.isUtf8(buf);
+      bench.end(n);
+      break;
+    case 'isAscii':
+      bench.start();
+      for (i = 0; i < n; i++)
+        buffer.isAscii(buf);
+      bench.end(n);
+      break;
+    case 'toString':
+      bench.start();
+      for (i = 0; i < n; i++)
+        buf.toString('utf8');
+      bench.end(n);
+      break;
+  }
+}
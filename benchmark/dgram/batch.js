@@ -0,0 +1,83 @@
+// test UDP send throughput of socket.sendBatch() against socket.send()
+// with a single Buffer and with a list of Buffers (as in multi-buffer.js)
+'use strict';
+
+const common = require('../common.js');
+const PORT = common.PORT;
+
+// `num` is the number of datagrams to queue up each time, either with one
+// socket.send() call per datagram or with a single socket.sendBatch() call.
+// `multi-buffer` is the socket.send() path benchmark/dgram/multi-buffer.js
+// exercises, i.e. each datagram is passed as a list of Buffers.
+var bench = common.createBenchmark(main, {
+  len: [64, 256, 1024],
+  num: [100],
+  method: ['send', 'multi-buffer', 'sendBatch'],
+  dur: [5]
+});
+
+var dur;
+var len;
+var num;
+var method;
+var chunk;
+var chunks;
+var batch;
+
+function main(conf) {
+  dur = +conf.dur;
+  len = +conf.len;
+  num = +conf.num;
+  method = conf.method;
+
+  chunk = Buffer.allocUnsafe(len);
+  chunks = [chunk];
+  batch = [];
+  for (var i = 0; i < num; i++)
+    batch.push({ msg: chunk, port: PORT, address: '127.0.0.1' });
+
+  server();
+}
+
+var dgram = require('dgram');
+
+function server() {
+  var sent = 0;
+  var socket = dgram.createSocket('udp4');
+
+  function onsend() {
+    if (sent++ % num === 0)
+      for (var i = 0; i < num; i++)
+        socket.send(chunk, PORT, '127.0.0.1', onsend);
+  }
+
+  function onsendmulti() {
+    if (sent++ % num === 0)
+      for (var i = 0; i < num; i++)
+        socket.send(chunks, PORT, '127.0.0.1', onsendmulti);
+  }
+
+  function onsendbatch() {
+    sent += num;
+    socket.sendBatch(batch, onsendbatch);
+  }
+
+  socket.on('listening', function() {
+    bench.start();
+    if (method === 'send')
+      onsend();
+    else if (method === 'multi-buffer')
+      onsendmulti();
+    else
+      socket.sendBatch(batch, onsendbatch);
+
+    setTimeout(function() {
+      var bytes = sent * len;
+      var gbits = (bytes * 8) / (1024 * 1024 * 1024);
+      bench.end(gbits);
+      process.exit(0);
+    }, dur * 1000);
+  });
+
+  socket.bind(PORT);
+}
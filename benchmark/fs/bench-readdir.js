@@ -6,17 +6,19 @@ const path = require('path');
 
 const bench = common.createBenchmark(main, {
   n: [1e4],
+  withFileTypes: ['false', 'true']
 });
 
 
 function main(conf) {
   const n = conf.n >>> 0;
+  const options = { withFileTypes: conf.withFileTypes === 'true' };
 
   bench.start();
   (function r(cntr) {
     if (cntr-- <= 0)
       return bench.end(n);
-    fs.readdir(path.resolve(__dirname, '../../lib/'), function() {
+    fs.readdir(path.resolve(__dirname, '../../lib/'), options, function() {
       r(cntr);
     });
   }(n));
@@ -6,15 +6,17 @@ const path = require('path');
 
 const bench = common.createBenchmark(main, {
   n: [1e4],
+  withFileTypes: ['false', 'true']
 });
 
 
 function main(conf) {
   const n = conf.n >>> 0;
+  const options = { withFileTypes: conf.withFileTypes === 'true' };
 
   bench.start();
   for (var i = 0; i < n; i++) {
-    fs.readdirSync(path.resolve(__dirname, '../../lib/'));
+    fs.readdirSync(path.resolve(__dirname, '../../lib/'), options);
   }
   bench.end(n);
 }
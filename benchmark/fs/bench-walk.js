@@ -0,0 +1,60 @@
+'use strict';
+
+const common = require('../common');
+const fs = require('fs');
+const path = require('path');
+
+const bench = common.createBenchmark(main, {
+  n: [100],
+  method: ['walk', 'readdir']
+});
+
+const root = path.resolve(__dirname, '../../lib/');
+
+// The same walk done with readdir() and lstat(), for comparison.
+function readdirWalk(dir, onEntry, callback) {
+  fs.readdir(dir, function(err, names) {
+    if (err)
+      throw err;
+    var pending = names.length;
+    if (pending === 0)
+      return callback();
+    names.forEach(function(name) {
+      const file = path.join(dir, name);
+      fs.lstat(file, function(err, stats) {
+        if (err)
+          throw err;
+        onEntry(file, stats);
+        if (stats.isDirectory())
+          readdirWalk(file, onEntry, done);
+        else
+          done();
+      });
+    });
+    function done() {
+      if (--pending === 0)
+        callback();
+    }
+  });
+}
+
+function main(conf) {
+  const n = conf.n >>> 0;
+
+  function onEntry() {}
+
+  bench.start();
+  (function r(cntr) {
+    if (cntr-- <= 0)
+      return bench.end(n);
+    if (conf.method === 'walk') {
+      fs.walk(root).on('data', onEntry).on('end', function() {
+        r(cntr);
+      });
+    } else {
+      readdirWalk(root, onEntry, function() {
+        r(cntr);
+      });
+    }
+  }(n));
+}
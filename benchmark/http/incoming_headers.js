@@ -0,0 +1,41 @@
+'use strict';
+
+const common = require('../common.js');
+const parsers = require('_http_common').parsers;
+const HTTPParser = process.binding('http_parser').HTTPParser;
+const CRLF = '\r\n';
+
+const bench = common.createBenchmark(main, {
+  headers: [4, 16, 30],
+  duplicates: ['true', 'false'],
+  n: [1e5]
+});
+
+function main(conf) {
+  const headers = conf.headers | 0;
+  const duplicates = conf.duplicates === 'true';
+  const n = conf.n | 0;
+
+  var request = `GET /hello HTTP/1.1${CRLF}Host: localhost${CRLF}`;
+  for (var i = 1; i < headers; i++) {
+    const name = duplicates ? 'X-Filler' : `X-Filler${i}`;
+    request += `${name}: ${Math.random().toString(36).substr(2)}${CRLF}`;
+  }
+  request = Buffer.from(request + CRLF);
+
+  // Goes through the same code as a server, minus the socket.
+  const parser = parsers.alloc();
+  parser.socket = null;
+  parser.onIncoming = function(req) {
+    if (req.headers.host === undefined)
+      throw new Error('missing header');
+    return 0;
+  };
+
+  bench.start();
+  for (i = 0; i < n; i++) {
+    parser.reinitialize(HTTPParser.REQUEST);
+    parser.execute(request, 0, request.length);
+  }
+  bench.end(n);
+}
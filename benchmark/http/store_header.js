@@ -0,0 +1,29 @@
+'use strict';
+
+const common = require('../common.js');
+const ServerResponse = require('http').ServerResponse;
+
+const bench = common.createBenchmark(main, {
+  headers: [2, 10, 50],
+  n: [1e6]
+});
+
+const req = { method: 'GET', httpVersionMajor: 1, httpVersionMinor: 1 };
+
+function main(conf) {
+  const n = conf.n | 0;
+  const headers = {
+    'Content-Type': 'text/plain; charset=utf-8',
+    'Content-Length': 1024
+  };
+  for (var i = 2; i < conf.headers; i++)
+    headers['X-Header-' + i] = 'some value ' + i;
+
+  bench.start();
+  for (i = 0; i < n; i++) {
+    const res = new ServerResponse(req);
+    res.sendDate = false;
+    res.writeHead(200, headers);
+  }
+  bench.end(n);
+}
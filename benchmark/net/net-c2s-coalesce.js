@@ -0,0 +1,54 @@
+// test the speed of many small writes per tick, with and without coalescing
+'use strict';
+
+var common = require('../common.js');
+var PORT = common.PORT;
+
+var bench = common.createBenchmark(main, {
+  len: [16, 128, 1024],
+  writes: [1, 16],
+  coalesce: ['true', 'false'],
+  dur: [5],
+});
+
+var net = require('net');
+
+function main(conf) {
+  var dur = +conf.dur;
+  var writes = +conf.writes;
+  var coalesce = conf.coalesce === 'true';
+  var chunk = Buffer.alloc(+conf.len, 'x');
+  var received = 0;
+
+  var server = net.createServer(function(socket) {
+    socket.on('data', function(data) {
+      received += data.length;
+    });
+  });
+
+  server.listen(PORT, function() {
+    var socket = net.connect(PORT);
+    socket.setWriteCoalescing(coalesce);
+    socket.on('connect', function() {
+      bench.start();
+
+      socket.on('drain', send);
+      send();
+
+      setTimeout(function() {
+        var gbits = (received * 8) / (1024 * 1024 * 1024);
+        bench.end(gbits);
+        process.exit(0);
+      }, dur * 1000);
+
+      // Like a server answering pipelined requests, a few writes per tick.
+      function send() {
+        for (var i = 0; i < writes; i++) {
+          if (!socket.write(chunk))
+            return;
+        }
+        setImmediate(send);
+      }
+    });
+  });
+}
@@ -0,0 +1,70 @@
+'use strict';
+// Compares v8.serialize()/v8.deserialize() with JSON on payloads of
+// different shapes.
+const common = require('../common.js');
+const v8 = require('v8');
+
+const bench = common.createBenchmark(main, {
+  method: ['v8', 'json'],
+  op: ['serialize', 'deserialize'],
+  type: ['small', 'records', 'strings', 'numbers', 'buffer'],
+  n: [1e4]
+});
+
+function createPayload(type) {
+  var i;
+  switch (type) {
+    case 'small':
+      return { id: 42, name: 'node', active: true, tags: ['a', 'b'] };
+    case 'records': {
+      const records = [];
+      for (i = 0; i < 100; i++) {
+        records.push({
+          id: i,
+          name: `user${i}`,
+          email: `user${i}@example.com`,
+          score: i * 1.5,
+          address: { city: 'Berlin', zip: '10115' }
+        });
+      }
+      return records;
+    }
+    case 'strings': {
+      const strings = [];
+      for (i = 0; i < 100; i++)
+        strings.push('lorem ipsum dolor sit amet '.repeat(10));
+      return strings;
+    }
+    case 'numbers': {
+      const numbers = [];
+      for (i = 0; i < 1000; i++)
+        numbers.push(i % 2 ? i : i / 3);
+      return numbers;
+    }
+    case 'buffer':
+      return { name: 'blob', data: Buffer.alloc(64 * 1024, 'x') };
+    default:
+      throw new Error('Unexpected type');
+  }
+}
+
+function main(conf) {
+  const n = conf.n | 0;
+  const payload = createPayload(conf.type);
+  const serialize = conf.method === 'v8' ? v8.serialize : JSON.stringify;
+  const deserialize = conf.method === 'v8' ? v8.deserialize : JSON.parse;
+  var i;
+
+  if (conf.op === 'serialize') {
+    bench.start();
+    for (i = 0; i < n; i++)
+      serialize(payload);
+    bench.end(n);
+  } else {
+    const data = serialize(payload);
+    bench.start();
+    for (i = 0; i < n; i++)
+      deserialize(data);
+    bench.end(n);
+  }
+}
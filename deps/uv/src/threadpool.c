@@ -282,6 +282,11 @@ int uv_cancel(uv_req_t* req) {
   case UV_FS:
     loop =  ((uv_fs_t*) req)->loop;
     wreq = &((uv_fs_t*) req)->work_req;
+#if defined(__linux__)
+    /* Submitted through io_uring, see uv__fs_iou_submit(). */
+    if (wreq->work == NULL)
+      return uv__fs_iou_cancel((uv_fs_t*) req);
+#endif
     break;
   case UV_GETADDRINFO:
     loop =  ((uv_getaddrinfo_t*) req)->loop;
@@ -56,6 +56,10 @@
 # define HAVE_PREADV 0
 #endif
 
+#if defined(__linux__)
+# include <sys/sysmacros.h>
+#endif
+
 #if defined(__linux__) || defined(__sun)
 # include <sys/sendfile.h>
 #endif
@@ -115,6 +119,8 @@
 #define POST                                                                  \
   do {                                                                        \
     if (cb != NULL) {                                                         \
+      if (uv__fs_iou_submit(loop, req))                                       \
+        return 0;                                                             \
       uv__work_submit(loop, &req->work_req, uv__fs_work, uv__fs_done);        \
       return 0;                                                               \
     }                                                                         \
@@ -998,6 +1004,247 @@ static void uv__fs_done(struct uv__work* w, int status) {
 }
 
 
+#if defined(__linux__)
+static void uv__statx_to_stat(const struct uv__statx* src, uv_stat_t* dst) {
+  dst->st_dev = makedev(src->stx_dev_major, src->stx_dev_minor);
+  dst->st_mode = src->stx_mode;
+  dst->st_nlink = src->stx_nlink;
+  dst->st_uid = src->stx_uid;
+  dst->st_gid = src->stx_gid;
+  dst->st_rdev = makedev(src->stx_rdev_major, src->stx_rdev_minor);
+  dst->st_ino = src->stx_ino;
+  dst->st_size = src->stx_size;
+  dst->st_blksize = src->stx_blksize;
+  dst->st_blocks = src->stx_blocks;
+  dst->st_atim.tv_sec = src->stx_atime.tv_sec;
+  dst->st_atim.tv_nsec = src->stx_atime.tv_nsec;
+  dst->st_mtim.tv_sec = src->stx_mtime.tv_sec;
+  dst->st_mtim.tv_nsec = src->stx_mtime.tv_nsec;
+  dst->st_ctim.tv_sec = src->stx_ctime.tv_sec;
+  dst->st_ctim.tv_nsec = src->stx_ctime.tv_nsec;
+  /* Same as uv__to_stat(), so the result doesn't depend on the code path. */
+  dst->st_birthtim.tv_sec = src->stx_ctime.tv_sec;
+  dst->st_birthtim.tv_nsec = src->stx_ctime.tv_nsec;
+  dst->st_flags = 0;
+  dst->st_gen = 0;
+}
+
+
+/* Queues the request on the loop's io_uring instead of the thread pool.
+ * Returns 0 when the request should take the thread pool after all: the loop
+ * isn't configured with UV_LOOP_USE_IO_URING, the ring is not available, it
+ * is full, or the operation is not one it handles.
+ */
+static int uv__fs_iou_submit(uv_loop_t* loop, uv_fs_t* req) {
+  struct uv__io_uring_sqe* sqe;
+  struct uv__statx* statxbuf;
+
+  if (!(loop->flags & UV_LOOP_ENABLE_IO_URING))
+    return 0;
+
+  switch (req->fs_type) {
+    case UV_FS_READ:
+    case UV_FS_WRITE:
+      if (req->nbufs > (unsigned int) uv__getiovmax())
+        return 0;
+      break;
+    case UV_FS_OPEN:
+    case UV_FS_CLOSE:
+    case UV_FS_FSYNC:
+    case UV_FS_FDATASYNC:
+    case UV_FS_STAT:
+    case UV_FS_LSTAT:
+    case UV_FS_FSTAT:
+      break;
+    default:
+      return 0;
+  }
+
+  /* The kernel writes the result after the fact, it can't go straight into
+   * req->statbuf because the layout is different.
+   */
+  statxbuf = NULL;
+  if (req->fs_type == UV_FS_STAT ||
+      req->fs_type == UV_FS_LSTAT ||
+      req->fs_type == UV_FS_FSTAT) {
+    statxbuf = uv__malloc(sizeof(*statxbuf));
+    if (statxbuf == NULL)
+      return 0;
+  }
+
+  sqe = uv__iou_get_fs_sqe(loop);
+  if (sqe == NULL) {
+    uv__free(statxbuf);
+    return 0;
+  }
+
+  switch (req->fs_type) {
+    case UV_FS_READ:
+    case UV_FS_WRITE:
+      sqe->opcode = req->fs_type == UV_FS_READ ? UV__IORING_OP_READV
+                                               : UV__IORING_OP_WRITEV;
+      sqe->fd = req->file;
+      sqe->addr = (uintptr_t) req->bufs;
+      sqe->len = req->nbufs;
+      /* -1 is the current file position, like read() and write(). */
+      sqe->off = req->off < 0 ? (uint64_t) -1 : (uint64_t) req->off;
+      break;
+    case UV_FS_OPEN:
+      sqe->opcode = UV__IORING_OP_OPENAT;
+      sqe->fd = UV__AT_FDCWD;
+      sqe->addr = (uintptr_t) req->path;
+      sqe->len = req->mode;
+      sqe->rw_flags = req->flags | UV__O_CLOEXEC;
+      break;
+    case UV_FS_CLOSE:
+      sqe->opcode = UV__IORING_OP_CLOSE;
+      sqe->fd = req->file;
+      break;
+    case UV_FS_FSYNC:
+    case UV_FS_FDATASYNC:
+      sqe->opcode = UV__IORING_OP_FSYNC;
+      sqe->fd = req->file;
+      if (req->fs_type == UV_FS_FDATASYNC)
+        sqe->rw_flags = UV__IORING_FSYNC_DATASYNC;
+      break;
+    default:
+      sqe->opcode = UV__IORING_OP_STATX;
+      sqe->len = UV__STATX_BASIC_STATS;
+      sqe->off = (uintptr_t) statxbuf;
+      if (req->fs_type == UV_FS_FSTAT) {
+        sqe->fd = req->file;
+        sqe->addr = (uintptr_t) "";
+        sqe->rw_flags = UV__AT_EMPTY_PATH;
+      } else {
+        sqe->fd = UV__AT_FDCWD;
+        sqe->addr = (uintptr_t) req->path;
+        if (req->fs_type == UV_FS_LSTAT)
+          sqe->rw_flags = UV__AT_SYMLINK_NOFOLLOW;
+      }
+      req->ptr = statxbuf;
+      break;
+  }
+
+  sqe->user_data = (uintptr_t) req;
+
+  /* Off the thread pool's queue, uv_cancel() takes uv__fs_iou_cancel(). */
+  req->work_req.loop = loop;
+  req->work_req.work = NULL;
+  req->work_req.done = uv__fs_done;
+  QUEUE_INIT(&req->work_req.wq);
+
+  uv__iou_submit(loop);
+  return 1;
+}
+
+
+/* An IORING_OP_ASYNC_CANCEL for a request the kernel already has.  It holds
+ * on to req->ptr until the request completes.
+ */
+struct uv__fs_iou_cancel {
+  struct uv__iou_cancel cancel;
+  void* ptr;
+};
+
+
+/* Mark requests that uv__fs_iou_cancel() called off, like uv__cancelled() in
+ * threadpool.c.  A request is cancelled for sure when it never reached the
+ * kernel, a request that did may complete before the kernel calls it off.
+ */
+static void uv__fs_iou_cancelled(struct uv__work* w) {
+  abort();
+}
+
+
+static void uv__fs_iou_canceling(struct uv__work* w) {
+  abort();
+}
+
+
+int uv__fs_iou_cancel(uv_fs_t* req) {
+  struct uv__fs_iou_cancel* c;
+
+  /* Not handed to the kernel yet, the entry runs as a no-op. */
+  if (uv__iou_cancel(req->loop, req) == 0) {
+    req->work_req.work = uv__fs_iou_cancelled;
+    return 0;
+  }
+
+  c = uv__malloc(sizeof(*c));
+  if (c == NULL)
+    return UV_EBUSY;
+
+  QUEUE_INIT(&c->cancel.queue);
+  c->cancel.data = (uintptr_t) req;
+  c->ptr = req->ptr;
+  req->ptr = c;
+  req->work_req.work = uv__fs_iou_canceling;
+  uv__iou_async_cancel(req->loop, &c->cancel);
+
+  return 0;
+}
+
+
+void uv__fs_iou_done(uv_fs_t* req, int32_t res) {
+  struct uv__fs_iou_cancel* c;
+  struct uv__statx* statxbuf;
+  int status;
+
+  /* The entry ran as a no-op, report the request as canceled. */
+  status = 0;
+  if (req->work_req.work == uv__fs_iou_cancelled) {
+    status = -ECANCELED;
+    res = 0;
+  }
+
+  /* The kernel may have finished the request before the cancellation got to
+   * it, the result stands then.  A request that is interrupted while it runs
+   * fails with EINTR rather than ECANCELED.
+   */
+  if (req->work_req.work == uv__fs_iou_canceling) {
+    c = req->ptr;
+    req->ptr = c->ptr;
+    if (!QUEUE_EMPTY(&c->cancel.queue))
+      QUEUE_REMOVE(&c->cancel.queue);
+    uv__free(c);
+
+    if (res == -ECANCELED || res == -EINTR) {
+      status = -ECANCELED;
+      res = 0;
+    }
+  }
+
+  switch (req->fs_type) {
+    case UV_FS_READ:
+    case UV_FS_WRITE:
+      if (req->bufs != req->bufsml)
+        uv__free(req->bufs);
+      req->bufs = NULL;
+      req->nbufs = 0;
+      break;
+    case UV_FS_STAT:
+    case UV_FS_LSTAT:
+    case UV_FS_FSTAT:
+      statxbuf = req->ptr;
+      req->ptr = NULL;
+      if (res == 0 && status == 0) {
+        uv__statx_to_stat(statxbuf, &req->statbuf);
+        req->ptr = &req->statbuf;
+      }
+      uv__free(statxbuf);
+      break;
+    default:
+      break;
+  }
+
+  req->result = res;
+  uv__fs_done(&req->work_req, status);
+}
+#else
+# define uv__fs_iou_submit(loop, req) 0
+#endif /* __linux__ */
+
+
 int uv_fs_access(uv_loop_t* loop,
                  uv_fs_t* req,
                  const char* path,
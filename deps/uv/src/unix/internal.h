@@ -133,12 +133,16 @@ enum {
   UV_TCP_SINGLE_ACCEPT    = 0x1000, /* Only accept() when idle. */
   UV_HANDLE_IPV6          = 0x10000, /* Handle is bound to a IPv6 socket. */
   UV_UDP_PROCESSING       = 0x20000, /* Handle is running the send callback queue. */
-  UV_HANDLE_BOUND         = 0x40000  /* Handle is bound to an address and port */
+  UV_HANDLE_BOUND         = 0x40000, /* Handle is bound to an address and port */
+  UV_HANDLE_UDP_RECVMMSG  = 0x80000, /* Read datagrams with recvmmsg(2). */
+  UV_HANDLE_UDP_CONNECTED = 0x100000, /* UDP handle has a default peer. */
+  UV_STREAM_IOU           = 0x200000  /* Stream reads through io_uring. */
 };
 
 /* loop flags */
 enum {
-  UV_LOOP_BLOCK_SIGPROF = 1
+  UV_LOOP_BLOCK_SIGPROF = 1,
+  UV_LOOP_ENABLE_IO_URING = 2
 };
 
 typedef enum {
@@ -235,6 +239,31 @@ int uv__kqueue_init(uv_loop_t* loop);
 int uv__platform_loop_init(uv_loop_t* loop);
 void uv__platform_loop_delete(uv_loop_t* loop);
 void uv__platform_invalidate_fd(uv_loop_t* loop, int fd);
+#if defined(__linux__)
+#define UV__IOU_BUF_GROUP 1
+#define UV__IOU_BUF_SIZE (16 * 1024)
+/* An IORING_OP_ASYNC_CANCEL for |data| that waits for a free submission
+ * queue entry while |queue| isn't empty.
+ */
+struct uv__iou_cancel {
+  QUEUE queue;
+  uint64_t data;
+};
+struct uv__io_uring_sqe* uv__iou_get_sqe(uv_loop_t* loop);
+struct uv__io_uring_sqe* uv__iou_get_fs_sqe(uv_loop_t* loop);
+void uv__iou_submit(uv_loop_t* loop);
+int uv__iou_cancel(uv_loop_t* loop, void* data);
+void uv__iou_async_cancel(uv_loop_t* loop, struct uv__iou_cancel* c);
+int uv__iou_flush(uv_loop_t* loop);
+int uv__iou_streams(uv_loop_t* loop);
+char* uv__iou_buf(uv_loop_t* loop, unsigned int bid);
+void uv__iou_buf_release(uv_loop_t* loop, unsigned int bid);
+void uv__iou_orphan(uv_loop_t* loop, void* q);
+void* uv__iou_stream_tree(uv_loop_t* loop);
+void uv__fs_iou_done(uv_fs_t* req, int32_t res);
+int uv__fs_iou_cancel(uv_fs_t* req);
+void uv__stream_iou_done(void* data, int32_t res, uint32_t flags);
+#endif /* __linux__ */
 
 /* various */
 void uv__async_close(uv_async_t* handle);
@@ -24,6 +24,7 @@
  */
 
 #include "uv.h"
+#include "tree.h"
 #include "internal.h"
 
 #include <stdint.h>
@@ -34,9 +35,11 @@
 #include <errno.h>
 
 #include <net/if.h>
+#include <sys/mman.h>
 #include <sys/param.h>
 #include <sys/prctl.h>
 #include <sys/sysinfo.h>
+#include <sys/utsname.h>
 #include <unistd.h>
 #include <fcntl.h>
 #include <time.h>
@@ -80,6 +83,126 @@ static int read_times(FILE* statfile_fp,
 static void read_speeds(unsigned int numcpus, uv_cpu_info_t* ci);
 static unsigned long read_cpufreq(unsigned int cpunum);
 
+/* Number of submission queue entries per loop.  The kernel sizes the
+ * completion queue at twice that.
+ */
+#define UV__IOU_SQ_ENTRIES 64
+
+/* With UV_IO_URING_STREAMS=1, TCP reads go through the ring as well and a
+ * receive is in flight for every reading stream, so both queues are larger.
+ * The kernel picks one of the provided buffers when data arrives.
+ */
+#define UV__IOU_STREAMS_SQ_ENTRIES 256
+#define UV__IOU_STREAMS_CQ_ENTRIES 8192
+#define UV__IOU_BUF_COUNT 256
+
+/* Earlier kernels have io_uring but with enough bugs in the file operations
+ * that the thread pool is the safer choice there.
+ */
+#define UV__IOU_MIN_KERNEL 0x050ABA  /* 5.10.186 */
+
+/* Earlier kernels hold on to the provided buffer while a receive waits for
+ * data, one idle socket per buffer is enough to starve the pool.
+ */
+#define UV__IOU_STREAMS_MIN_KERNEL 0x060100  /* 6.1 */
+
+/* The ring of a loop is found through a process-wide tree keyed by loop, so
+ * uv_loop_t keeps its size.  A loop that can't have a ring gets an entry
+ * with a |ringfd| of -1 so that it isn't tried again.
+ */
+struct uv__iou {
+  RB_ENTRY(uv__iou) entry;
+  uv_loop_t* loop;
+  uv__io_t watcher;
+  uint32_t* sqhead;
+  uint32_t* sqtail;
+  uint32_t* sqarray;
+  uint32_t* sqflags;
+  uint32_t sqmask;
+  uint32_t sqentries;
+  uint32_t* cqhead;
+  uint32_t* cqtail;
+  uint32_t cqmask;
+  uint32_t cqentries;
+  struct uv__io_uring_cqe* cqe;
+  struct uv__io_uring_sqe* sqe;
+  void* sq;
+  size_t sqlen;
+  size_t sqelen;
+  uint32_t unsubmitted;
+  uint32_t fs_in_flight;
+  /* Receive buffers, NULL unless streams are enabled.  Buffers that are done
+   * with wait in |returned| until uv__iou_flush() provides them again.
+   */
+  char* bufs;
+  uint16_t* returned;
+  uint32_t nreturned;
+  /* Read state of streams, see stream.c.  Closed streams that still have a
+   * receive in flight are moved to |orphans|.
+   */
+  void* streams;
+  QUEUE orphans;
+  /* Cancellations that didn't get a submission queue entry. */
+  QUEUE cancels;
+  int ringfd;
+};
+
+struct uv__iou_tree {
+  struct uv__iou* rbh_root;
+};
+
+static struct uv__iou_tree uv__iou_rings = RB_INITIALIZER(&uv__iou_rings);
+static uv_once_t uv__iou_once = UV_ONCE_INIT;
+static uv_mutex_t uv__iou_mutex;
+
+
+static int uv__iou_compare(const struct uv__iou* a, const struct uv__iou* b) {
+  if (a->loop < b->loop) return -1;
+  if (a->loop > b->loop) return 1;
+  return 0;
+}
+
+
+RB_GENERATE_STATIC(uv__iou_tree, uv__iou, entry, uv__iou_compare)
+
+
+static void uv__iou_init_once(void) {
+  if (uv_mutex_init(&uv__iou_mutex))
+    abort();
+}
+
+
+/* Returns the entry of |loop|, if any.  With |remove| set the entry is taken
+ * out of the tree.
+ */
+static struct uv__iou* uv__iou_lookup(uv_loop_t* loop, int remove) {
+  struct uv__iou* iou;
+  struct uv__iou key;
+
+  uv_once(&uv__iou_once, uv__iou_init_once);
+
+  key.loop = loop;
+  uv_mutex_lock(&uv__iou_mutex);
+  iou = RB_FIND(uv__iou_tree, &uv__iou_rings, &key);
+  if (iou != NULL && remove)
+    RB_REMOVE(uv__iou_tree, &uv__iou_rings, iou);
+  uv_mutex_unlock(&uv__iou_mutex);
+
+  return iou;
+}
+
+
+/* Returns the ring of |loop| or NULL when the loop doesn't have one. */
+static struct uv__iou* uv__iou_find(uv_loop_t* loop) {
+  struct uv__iou* iou;
+
+  iou = uv__iou_lookup(loop, 0);
+  if (iou == NULL || iou->ringfd == -1)
+    return NULL;
+
+  return iou;
+}
+
 
 int uv__platform_loop_init(uv_loop_t* loop) {
   int fd;
@@ -108,6 +231,28 @@ int uv__platform_loop_init(uv_loop_t* loop) {
 
 
 void uv__platform_loop_delete(uv_loop_t* loop) {
+  struct uv__iou* iou;
+  QUEUE* q;
+
+  iou = uv__iou_lookup(loop, 1);
+  if (iou != NULL && iou->ringfd != -1) {
+    uv__io_stop(loop, &iou->watcher, POLLIN);
+    munmap(iou->sqe, iou->sqelen);
+    munmap(iou->sq, iou->sqlen);
+    uv__close(iou->ringfd);
+
+    /* Nothing completes once the ring is gone. */
+    while (!QUEUE_EMPTY(&iou->orphans)) {
+      q = QUEUE_HEAD(&iou->orphans);
+      QUEUE_REMOVE(q);
+      uv__free(q);
+    }
+
+    uv__free(iou->returned);
+    uv__free(iou->bufs);
+  }
+  uv__free(iou);
+
   if (loop->inotify_fd == -1) return;
   uv__io_stop(loop, &loop->inotify_read_watcher, POLLIN);
   uv__close(loop->inotify_fd);
@@ -167,6 +312,514 @@ int uv__io_check_fd(uv_loop_t* loop, int fd) {
 }
 
 
+static unsigned uv__kernel_version(void) {
+  struct utsname u;
+  unsigned major;
+  unsigned minor;
+  unsigned patch;
+
+  if (uname(&u))
+    return 0;
+
+  patch = 0;
+  if (sscanf(u.release, "%u.%u.%u", &major, &minor, &patch) < 2)
+    return 0;
+
+  if (patch > 255)
+    patch = 255;
+
+  return major * 65536 + minor * 256 + patch;
+}
+
+
+static void uv__iou_cb(uv_loop_t* loop, uv__io_t* w, unsigned int events) {
+  struct uv__io_uring_cqe* cqe;
+  struct uv__iou* iou;
+  uint64_t data;
+  uint32_t flags;
+  uint32_t head;
+  uint32_t tail;
+  int32_t res;
+
+  iou = container_of(w, struct uv__iou, watcher);
+  head = *iou->cqhead;
+  tail = __atomic_load_n(iou->cqtail, __ATOMIC_ACQUIRE);
+
+  for (; head != tail; head++) {
+    cqe = &iou->cqe[head & iou->cqmask];
+    data = cqe->user_data;
+    res = cqe->res;
+    flags = cqe->flags;
+
+    /* Hand the slot back before running the callback, it may submit again. */
+    __atomic_store_n(iou->cqhead, head + 1, __ATOMIC_RELEASE);
+
+    /* Provided buffers and cancellations, there's nothing to do for them.
+     * Stream reads are tagged with the low bit, file system requests are not.
+     */
+    if (data == 0)
+      continue;
+
+    if (data & 1) {
+      uv__stream_iou_done((void*) (uintptr_t) (data & ~(uint64_t) 1),
+                          res,
+                          flags);
+    } else {
+      iou->fs_in_flight--;
+      uv__fs_iou_done((uv_fs_t*) (uintptr_t) data, res);
+    }
+  }
+
+  /* Completions that didn't fit in the queue are held by the kernel until
+   * it's asked for them.  They make the ring readable again.
+   */
+  if (__atomic_load_n(iou->sqflags, __ATOMIC_ACQUIRE) &
+      UV__IORING_SQ_CQ_OVERFLOW) {
+    uv__io_uring_enter(iou->ringfd, 0, 0, UV__IORING_ENTER_GETEVENTS);
+  }
+}
+
+
+static int uv__iou_streams_wanted(void) {
+  const char* val;
+
+  val = getenv("UV_IO_URING_STREAMS");
+  if (val == NULL || strcmp(val, "1") != 0)
+    return 0;
+
+  return uv__kernel_version() >= UV__IOU_STREAMS_MIN_KERNEL;
+}
+
+
+static struct uv__iou* uv__iou_create(uv_loop_t* loop) {
+  struct uv__io_uring_params params;
+  struct uv__iou* iou;
+  const char* val;
+  uint32_t entries;
+  uint32_t i;
+  size_t cqlen;
+  size_t sqlen;
+  size_t maxlen;
+  char* bufs;
+  uint16_t* returned;
+  char* sq;
+  char* sqe;
+  int streams;
+  int ringfd;
+
+  val = getenv("UV_USE_IO_URING");
+  if (val != NULL && strcmp(val, "0") == 0)
+    return NULL;
+
+  if (uv__kernel_version() < UV__IOU_MIN_KERNEL)
+    return NULL;
+
+  streams = uv__iou_streams_wanted();
+
+  memset(&params, 0, sizeof(params));
+  entries = UV__IOU_SQ_ENTRIES;
+  if (streams) {
+    entries = UV__IOU_STREAMS_SQ_ENTRIES;
+    params.flags = UV__IORING_SETUP_CQSIZE;
+    params.cq_entries = UV__IOU_STREAMS_CQ_ENTRIES;
+  }
+
+  ringfd = uv__io_uring_setup(entries, &params);
+  if (ringfd == -1)
+    return NULL;
+
+  sq = MAP_FAILED;
+  sqe = MAP_FAILED;
+  maxlen = 0;
+  bufs = NULL;
+  returned = NULL;
+
+  /* Both are 5.4 features, they're listed for the sake of completeness. */
+  if (!(params.features & UV__IORING_FEAT_SINGLE_MMAP))
+    goto fail;
+
+  if (!(params.features & UV__IORING_FEAT_NODROP))
+    goto fail;
+
+  /* The submission and completion queues share a single mapping. */
+  sqlen = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+  cqlen = params.cq_off.cqes +
+          params.cq_entries * sizeof(struct uv__io_uring_cqe);
+  maxlen = sqlen < cqlen ? cqlen : sqlen;
+
+  sq = mmap(0,
+            maxlen,
+            PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE,
+            ringfd,
+            (uint64_t) UV__IORING_OFF_SQ_RING);
+
+  sqe = mmap(0,
+             params.sq_entries * sizeof(struct uv__io_uring_sqe),
+             PROT_READ | PROT_WRITE,
+             MAP_SHARED | MAP_POPULATE,
+             ringfd,
+             (uint64_t) UV__IORING_OFF_SQES);
+
+  if (sq == MAP_FAILED || sqe == MAP_FAILED)
+    goto fail;
+
+  if (streams) {
+    bufs = uv__malloc(UV__IOU_BUF_COUNT * UV__IOU_BUF_SIZE);
+    returned = uv__malloc(UV__IOU_BUF_COUNT * sizeof(*returned));
+    if (bufs == NULL || returned == NULL)
+      goto fail;
+  }
+
+  iou = uv__malloc(sizeof(*iou));
+  if (iou == NULL)
+    goto fail;
+
+  iou->sqhead = (uint32_t*) (sq + params.sq_off.head);
+  iou->sqtail = (uint32_t*) (sq + params.sq_off.tail);
+  iou->sqarray = (uint32_t*) (sq + params.sq_off.array);
+  iou->sqflags = (uint32_t*) (sq + params.sq_off.flags);
+  iou->sqmask = *(uint32_t*) (sq + params.sq_off.ring_mask);
+  iou->sqentries = *(uint32_t*) (sq + params.sq_off.ring_entries);
+  iou->cqhead = (uint32_t*) (sq + params.cq_off.head);
+  iou->cqtail = (uint32_t*) (sq + params.cq_off.tail);
+  iou->cqmask = *(uint32_t*) (sq + params.cq_off.ring_mask);
+  iou->cqentries = *(uint32_t*) (sq + params.cq_off.ring_entries);
+  iou->cqe = (struct uv__io_uring_cqe*) (sq + params.cq_off.cqes);
+  iou->sqe = (struct uv__io_uring_sqe*) sqe;
+  iou->sq = sq;
+  iou->sqlen = maxlen;
+  iou->sqelen = params.sq_entries * sizeof(struct uv__io_uring_sqe);
+  iou->unsubmitted = 0;
+  iou->fs_in_flight = 0;
+  iou->bufs = bufs;
+  iou->returned = returned;
+  iou->nreturned = 0;
+  iou->streams = NULL;
+  QUEUE_INIT(&iou->orphans);
+  QUEUE_INIT(&iou->cancels);
+  iou->ringfd = ringfd;
+
+  /* Submission queue entries are used in order, the indirection array is
+   * never changed after this.
+   */
+  for (i = 0; i <= iou->sqmask; i++)
+    iou->sqarray[i] = i;
+
+  /* The whole pool goes to the kernel with the first flush. */
+  if (streams)
+    for (i = 0; i < UV__IOU_BUF_COUNT; i++)
+      returned[iou->nreturned++] = i;
+
+  /* The ring fd polls readable while there are completions to reap. */
+  uv__io_init(&iou->watcher, uv__iou_cb, ringfd);
+  uv__io_start(loop, &iou->watcher, POLLIN);
+
+  return iou;
+
+fail:
+  uv__free(returned);
+  uv__free(bufs);
+
+  if (sqe != MAP_FAILED)
+    munmap(sqe, params.sq_entries * sizeof(struct uv__io_uring_sqe));
+
+  if (sq != MAP_FAILED)
+    munmap(sq, maxlen);
+
+  uv__close(ringfd);
+
+  return NULL;
+}
+
+
+/* Like uv__iou_find() but sets up the ring on first use. */
+static struct uv__iou* uv__iou_get(uv_loop_t* loop) {
+  struct uv__iou* iou;
+
+  iou = uv__iou_lookup(loop, 0);
+  if (iou != NULL)
+    return iou->ringfd == -1 ? NULL : iou;
+
+  iou = uv__iou_create(loop);
+  if (iou == NULL) {
+    iou = uv__malloc(sizeof(*iou));
+    if (iou == NULL)
+      return NULL;  /* Try again next time. */
+    iou->ringfd = -1;
+  }
+
+  iou->loop = loop;
+  uv_mutex_lock(&uv__iou_mutex);
+  RB_INSERT(uv__iou_tree, &uv__iou_rings, iou);
+  uv_mutex_unlock(&uv__iou_mutex);
+
+  return iou->ringfd == -1 ? NULL : iou;
+}
+
+
+static struct uv__io_uring_sqe* uv__iou_next_sqe(struct uv__iou* iou) {
+  struct uv__io_uring_sqe* sqe;
+  uint32_t head;
+  uint32_t tail;
+
+  tail = *iou->sqtail;
+  head = __atomic_load_n(iou->sqhead, __ATOMIC_ACQUIRE);
+  if (tail - head >= iou->sqentries)
+    return NULL;
+
+  sqe = &iou->sqe[tail & iou->sqmask];
+  memset(sqe, 0, sizeof(*sqe));
+
+  return sqe;
+}
+
+
+static void uv__iou_push_sqe(struct uv__iou* iou) {
+  __atomic_store_n(iou->sqtail, *iou->sqtail + 1, __ATOMIC_RELEASE);
+  iou->unsubmitted++;
+}
+
+
+/* Gives returned receive buffers back to the kernel, one entry for each run
+ * of consecutive buffer ids.
+ */
+static void uv__iou_provide_buffers(struct uv__iou* iou) {
+  struct uv__io_uring_sqe* sqe;
+  uint32_t first;
+  uint32_t n;
+
+  while (iou->nreturned > 0) {
+    sqe = uv__iou_next_sqe(iou);
+    if (sqe == NULL)
+      return;
+
+    first = iou->returned[--iou->nreturned];
+    n = 1;
+    while (iou->nreturned > 0 &&
+           iou->returned[iou->nreturned - 1] == first + n) {
+      iou->nreturned--;
+      n++;
+    }
+
+    sqe->opcode = UV__IORING_OP_PROVIDE_BUFFERS;
+    sqe->fd = n;
+    sqe->addr = (uintptr_t) (iou->bufs + first * UV__IOU_BUF_SIZE);
+    sqe->len = UV__IOU_BUF_SIZE;
+    sqe->off = first;
+    sqe->buf_group = UV__IOU_BUF_GROUP;
+    uv__iou_push_sqe(iou);
+  }
+}
+
+
+static void uv__iou_submit_cancels(struct uv__iou* iou) {
+  struct uv__io_uring_sqe* sqe;
+  struct uv__iou_cancel* c;
+  QUEUE* q;
+
+  while (!QUEUE_EMPTY(&iou->cancels)) {
+    sqe = uv__iou_next_sqe(iou);
+    if (sqe == NULL)
+      return;
+
+    q = QUEUE_HEAD(&iou->cancels);
+    QUEUE_REMOVE(q);
+    QUEUE_INIT(q);
+
+    c = QUEUE_DATA(q, struct uv__iou_cancel, queue);
+    sqe->opcode = UV__IORING_OP_ASYNC_CANCEL;
+    sqe->addr = c->data;
+    uv__iou_push_sqe(iou);
+  }
+}
+
+
+/* Returns non-zero when entries are left that the kernel did not take. */
+static int uv__iou_flush_ring(struct uv__iou* iou) {
+  int rc;
+
+  for (;;) {
+    uv__iou_submit_cancels(iou);
+    uv__iou_provide_buffers(iou);
+
+    if (iou->unsubmitted == 0)
+      return 0;
+
+    rc = uv__io_uring_enter(iou->ringfd, iou->unsubmitted, 0, 0);
+
+    if (rc > 0) {
+      iou->unsubmitted -= rc;
+      continue;
+    }
+
+    if (rc == -1 && errno == EINTR)
+      continue;
+
+    /* Out of kernel resources or too many completions that haven't been
+     * reaped yet, try again on the next tick.
+     */
+    if (rc == 0 || errno == EAGAIN || errno == EBUSY)
+      return 1;
+
+    abort();
+  }
+}
+
+
+int uv__iou_flush(uv_loop_t* loop) {
+  struct uv__iou* iou;
+
+  iou = uv__iou_find(loop);
+  if (iou == NULL)
+    return 0;
+
+  return uv__iou_flush_ring(iou);
+}
+
+
+static struct uv__io_uring_sqe* uv__iou_sqe(struct uv__iou* iou) {
+  struct uv__io_uring_sqe* sqe;
+
+  sqe = uv__iou_next_sqe(iou);
+  if (sqe == NULL) {
+    uv__iou_flush_ring(iou);
+    sqe = uv__iou_next_sqe(iou);
+  }
+
+  return sqe;
+}
+
+
+struct uv__io_uring_sqe* uv__iou_get_sqe(uv_loop_t* loop) {
+  struct uv__iou* iou;
+
+  iou = uv__iou_get(loop);
+  if (iou == NULL)
+    return NULL;
+
+  return uv__iou_sqe(iou);
+}
+
+
+struct uv__io_uring_sqe* uv__iou_get_fs_sqe(uv_loop_t* loop) {
+  struct uv__io_uring_sqe* sqe;
+  struct uv__iou* iou;
+
+  iou = uv__iou_get(loop);
+  if (iou == NULL)
+    return NULL;
+
+  /* Never have more file system requests in flight than fit in the
+   * completion queue, a busy disk shouldn't push completions into kernel
+   * memory.
+   */
+  if (iou->fs_in_flight >= iou->cqentries)
+    return NULL;
+
+  sqe = uv__iou_sqe(iou);
+  if (sqe != NULL)
+    iou->fs_in_flight++;
+
+  return sqe;
+}
+
+
+void uv__iou_submit(uv_loop_t* loop) {
+  uv__iou_push_sqe(uv__iou_find(loop));
+}
+
+
+/* Turns the entry for |data| into a no-op if the kernel hasn't seen it yet.
+ * Its completion still carries |data|.  Returns UV_EBUSY when there's no such
+ * entry: the kernel has it or it's done.
+ */
+int uv__iou_cancel(uv_loop_t* loop, void* data) {
+  struct uv__io_uring_sqe* sqe;
+  struct uv__iou* iou;
+  uint32_t tail;
+  uint32_t i;
+
+  iou = uv__iou_find(loop);
+  if (iou == NULL)
+    return UV_EBUSY;
+
+  tail = *iou->sqtail;
+  for (i = tail - iou->unsubmitted; i != tail; i++) {
+    sqe = &iou->sqe[i & iou->sqmask];
+    if (sqe->user_data != (uintptr_t) data)
+      continue;
+
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = UV__IORING_OP_NOP;
+    sqe->user_data = (uintptr_t) data;
+    return 0;
+  }
+
+  return UV_EBUSY;
+}
+
+
+/* Never fails: when there's no submission queue entry to spare, the
+ * cancellation waits for the next uv__iou_flush() that frees one.
+ */
+void uv__iou_async_cancel(uv_loop_t* loop, struct uv__iou_cancel* c) {
+  struct uv__io_uring_sqe* sqe;
+  struct uv__iou* iou;
+
+  iou = uv__iou_find(loop);
+  sqe = uv__iou_sqe(iou);
+  if (sqe == NULL) {
+    QUEUE_INSERT_TAIL(&iou->cancels, &c->queue);
+    return;
+  }
+
+  sqe->opcode = UV__IORING_OP_ASYNC_CANCEL;
+  sqe->addr = c->data;
+  uv__iou_push_sqe(iou);
+}
+
+
+int uv__iou_streams(uv_loop_t* loop) {
+  struct uv__iou* iou;
+
+  iou = uv__iou_get(loop);
+  return iou != NULL && iou->bufs != NULL;
+}
+
+
+char* uv__iou_buf(uv_loop_t* loop, unsigned int bid) {
+  struct uv__iou* iou;
+
+  iou = uv__iou_find(loop);
+  return iou->bufs + bid * UV__IOU_BUF_SIZE;
+}
+
+
+void uv__iou_buf_release(uv_loop_t* loop, unsigned int bid) {
+  struct uv__iou* iou;
+
+  iou = uv__iou_find(loop);
+  iou->returned[iou->nreturned++] = bid;
+}
+
+
+void uv__iou_orphan(uv_loop_t* loop, void* q) {
+  struct uv__iou* iou;
+
+  iou = uv__iou_find(loop);
+  QUEUE_INSERT_TAIL(&iou->orphans, (QUEUE*) q);
+}
+
+
+void* uv__iou_stream_tree(uv_loop_t* loop) {
+  struct uv__iou* iou;
+
+  iou = uv__iou_find(loop);
+  return &iou->streams;
+}
+
+
 void uv__io_poll(uv_loop_t* loop, int timeout) {
   /* A bug in kernels < 2.6.37 makes timeouts larger than ~30 minutes
    * effectively infinite on 32 bits architectures.  To avoid blocking
@@ -196,6 +849,14 @@ void uv__io_poll(uv_loop_t* loop, int timeout) {
   int op;
   int i;
 
+  /* Everything queued on the ring since the last poll goes to the kernel
+   * with a single system call.  Entries that the kernel can't take yet are
+   * retried on the next tick, don't block in epoll_wait() until then: no
+   * completion may ever wake it up.
+   */
+  if (uv__iou_flush(loop))
+    timeout = 0;
+
   if (loop->nfds == 0) {
     assert(QUEUE_EMPTY(&loop->watcher_queue));
     return;
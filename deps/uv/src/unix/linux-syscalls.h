@@ -111,6 +111,134 @@ struct uv__mmsghdr {
   unsigned int msg_len;
 };
 
+/* io_uring, see <linux/io_uring.h> */
+#define UV__IORING_OP_NOP         0
+#define UV__IORING_OP_READV       1
+#define UV__IORING_OP_WRITEV      2
+#define UV__IORING_OP_FSYNC       3
+#define UV__IORING_OP_OPENAT      18
+#define UV__IORING_OP_ASYNC_CANCEL 14
+#define UV__IORING_OP_CLOSE       19
+#define UV__IORING_OP_STATX       21
+#define UV__IORING_OP_RECV        27
+#define UV__IORING_OP_PROVIDE_BUFFERS 31
+
+#define UV__IORING_FSYNC_DATASYNC 1u
+
+#define UV__IOSQE_BUFFER_SELECT   32u
+
+#define UV__IORING_CQE_F_BUFFER   1u
+#define UV__IORING_CQE_BUFFER_SHIFT 16
+
+#define UV__IORING_SETUP_CQSIZE   8u
+#define UV__IORING_SQ_CQ_OVERFLOW 2u
+#define UV__IORING_ENTER_GETEVENTS 1u
+
+#define UV__IORING_FEAT_SINGLE_MMAP 1u
+#define UV__IORING_FEAT_NODROP      2u
+
+#define UV__IORING_OFF_SQ_RING    0
+#define UV__IORING_OFF_SQES       0x10000000
+
+/* statx flags */
+#define UV__AT_FDCWD              -100
+#define UV__AT_SYMLINK_NOFOLLOW   0x100
+#define UV__AT_EMPTY_PATH         0x1000
+#define UV__STATX_BASIC_STATS     0x7ff
+
+struct uv__io_sqring_offsets {
+  uint32_t head;
+  uint32_t tail;
+  uint32_t ring_mask;
+  uint32_t ring_entries;
+  uint32_t flags;
+  uint32_t dropped;
+  uint32_t array;
+  uint32_t reserved0;
+  uint64_t reserved1;
+};
+
+struct uv__io_cqring_offsets {
+  uint32_t head;
+  uint32_t tail;
+  uint32_t ring_mask;
+  uint32_t ring_entries;
+  uint32_t overflow;
+  uint32_t cqes;
+  uint64_t reserved0;
+  uint64_t reserved1;
+};
+
+struct uv__io_uring_params {
+  uint32_t sq_entries;
+  uint32_t cq_entries;
+  uint32_t flags;
+  uint32_t sq_thread_cpu;
+  uint32_t sq_thread_idle;
+  uint32_t features;
+  uint32_t reserved[4];
+  struct uv__io_sqring_offsets sq_off;
+  struct uv__io_cqring_offsets cq_off;
+};
+
+/* The kernel overlays several fields with unions, they are named here after
+ * their most common use: |off| is the statx buffer for UV__IORING_OP_STATX
+ * and the first buffer id for UV__IORING_OP_PROVIDE_BUFFERS, |fd| the number
+ * of buffers for the latter, |len| the mode for UV__IORING_OP_OPENAT and the
+ * mask for UV__IORING_OP_STATX, |rw_flags| the flags of every operation.
+ */
+struct uv__io_uring_sqe {
+  uint8_t opcode;
+  uint8_t flags;
+  uint16_t ioprio;
+  int32_t fd;
+  uint64_t off;
+  uint64_t addr;
+  uint32_t len;
+  uint32_t rw_flags;
+  uint64_t user_data;
+  uint16_t buf_group;
+  uint16_t personality;
+  int32_t splice_fd_in;
+  uint64_t pad[2];
+};
+
+struct uv__io_uring_cqe {
+  uint64_t user_data;
+  int32_t res;
+  uint32_t flags;
+};
+
+struct uv__statx_timestamp {
+  int64_t tv_sec;
+  uint32_t tv_nsec;
+  int32_t reserved;
+};
+
+struct uv__statx {
+  uint32_t stx_mask;
+  uint32_t stx_blksize;
+  uint64_t stx_attributes;
+  uint32_t stx_nlink;
+  uint32_t stx_uid;
+  uint32_t stx_gid;
+  uint16_t stx_mode;
+  uint16_t reserved0;
+  uint64_t stx_ino;
+  uint64_t stx_size;
+  uint64_t stx_blocks;
+  uint64_t stx_attributes_mask;
+  struct uv__statx_timestamp stx_atime;
+  struct uv__statx_timestamp stx_btime;
+  struct uv__statx_timestamp stx_ctime;
+  struct uv__statx_timestamp stx_mtime;
+  uint32_t stx_rdev_major;
+  uint32_t stx_rdev_minor;
+  uint32_t stx_dev_major;
+  uint32_t stx_dev_minor;
+  uint64_t reserved1[14];
+};
+
 int uv__accept4(int fd, struct sockaddr* addr, socklen_t* addrlen, int flags);
 int uv__eventfd(unsigned int count);
 int uv__epoll_create(int size);
@@ -147,5 +275,11 @@ int uv__utimesat(int dirfd,
 ssize_t uv__preadv(int fd, const struct iovec *iov, int iovcnt, int64_t offset);
 ssize_t uv__pwritev(int fd, const struct iovec *iov, int iovcnt, int64_t offset);
 int uv__dup3(int oldfd, int newfd, int flags);
+int uv__io_uring_setup(unsigned int entries,
+                       struct uv__io_uring_params* params);
+int uv__io_uring_enter(int fd,
+                       unsigned int to_submit,
+                       unsigned int min_complete,
+                       unsigned int flags);
 
 #endif /* UV_LINUX_SYSCALL_H_ */
@@ -148,6 +148,13 @@ void uv__loop_close(uv_loop_t* loop) {
 
 
 int uv__loop_configure(uv_loop_t* loop, uv_loop_option option, va_list ap) {
+#if defined(__linux__)
+  if (option == UV_LOOP_USE_IO_URING) {
+    loop->flags |= UV_LOOP_ENABLE_IO_URING;
+    return 0;
+  }
+#endif
+
   if (option != UV_LOOP_BLOCK_SIGNAL)
     return UV_ENOSYS;
 
@@ -21,6 +21,7 @@
 
 #include "uv.h"
 #include "internal.h"
+#include "tree.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -67,6 +68,58 @@ static void uv__stream_io(uv_loop_t* loop, uv__io_t* w, unsigned int events);
 static void uv__write_callbacks(uv_stream_t* stream);
 static size_t uv__write_req_size(uv_write_t* req);
 
+#if defined(__linux__)
+/* A stream that reads through the loop's io_uring keeps a receive in flight
+ * while it's reading, its fd is never polled for POLLIN.  The kernel picks
+ * one of the loop's buffers when data arrives and the data is copied out to
+ * the buffer from alloc_cb.  The state lives in a tree on the loop's ring,
+ * keyed by stream, so uv_stream_t keeps its size.  It outlives the stream
+ * when a receive is still in flight at close time.
+ */
+struct uv__stream_iou {
+  QUEUE queue;  /* Must come first, see uv__iou_orphan(). */
+  RB_ENTRY(uv__stream_iou) entry;
+  struct uv__iou_cancel cancel;
+  uv_loop_t* loop;
+  uv_stream_t* stream;
+  char* data;  /* Received but not yet passed to read_cb. */
+  size_t len;
+  char* heap;  /* Set when |data| was moved out of the loop's buffers. */
+  unsigned int bid;
+  int armed;
+  int canceling;
+};
+
+struct uv__stream_iou_tree {
+  struct uv__stream_iou* rbh_root;
+};
+#define CAST(p) ((struct uv__stream_iou_tree*)(p))
+
+
+static int uv__stream_iou_compare(const struct uv__stream_iou* a,
+                                  const struct uv__stream_iou* b) {
+  if (a->stream < b->stream) return -1;
+  if (a->stream > b->stream) return 1;
+  return 0;
+}
+
+
+RB_GENERATE_STATIC(uv__stream_iou_tree,
+                   uv__stream_iou,
+                   entry,
+                   uv__stream_iou_compare)
+
+static int uv__stream_iou_start(uv_stream_t* stream);
+static void uv__stream_iou_read(uv_stream_t* stream);
+static void uv__stream_iou_stop(uv_stream_t* stream);
+static void uv__stream_iou_close(uv_stream_t* stream);
+
+# define uv__stream_iou_reading(stream)                                       \
+  (((stream)->flags & UV_STREAM_IOU) && ((stream)->flags & UV_STREAM_READING))
+#else
+# define uv__stream_iou_reading(stream) 0
+#endif /* __linux__ */
+
 
 void uv__stream_init(uv_loop_t* loop,
                      uv_stream_t* stream,
@@ -851,7 +904,8 @@ start:
       req->error = -errno;
       uv__write_req_finish(req);
       uv__io_stop(stream->loop, &stream->io_watcher, POLLOUT);
-      if (!uv__io_active(&stream->io_watcher, POLLIN))
+      if (!uv__io_active(&stream->io_watcher, POLLIN) &&
+          !uv__stream_iou_reading(stream))
         uv__handle_stop(stream);
       uv__stream_osx_interrupt_select(stream);
       return;
@@ -1210,6 +1264,266 @@ static void uv__read(uv_stream_t* stream) {
 # pragma clang diagnostic pop
 #endif
 
+
+#if defined(__linux__)
+static struct uv__stream_iou* uv__stream_iou_get(uv_stream_t* stream) {
+  struct uv__stream_iou key;
+
+  if (!(stream->flags & UV_STREAM_IOU))
+    return NULL;
+
+  key.stream = stream;
+  return RB_FIND(uv__stream_iou_tree,
+                 CAST(uv__iou_stream_tree(stream->loop)),
+                 &key);
+}
+
+
+static int uv__stream_iou_arm(uv_stream_t* stream) {
+  struct uv__io_uring_sqe* sqe;
+  struct uv__stream_iou* op;
+
+  op = uv__stream_iou_get(stream);
+  sqe = uv__iou_get_sqe(stream->loop);
+  if (sqe == NULL)
+    return -ENOBUFS;
+
+  sqe->opcode = UV__IORING_OP_RECV;
+  sqe->flags = UV__IOSQE_BUFFER_SELECT;
+  sqe->fd = uv__stream_fd(stream);
+  sqe->len = UV__IOU_BUF_SIZE;
+  sqe->buf_group = UV__IOU_BUF_GROUP;
+  sqe->user_data = (uintptr_t) op | 1;
+  uv__iou_submit(stream->loop);
+  op->armed = 1;
+
+  return 0;
+}
+
+
+/* Gives back the storage of received data. */
+static void uv__stream_iou_drop(struct uv__stream_iou* op) {
+  if (op->data == NULL)
+    return;
+
+  if (op->heap != NULL)
+    uv__free(op->heap);
+  else
+    uv__iou_buf_release(op->loop, op->bid);
+
+  op->heap = NULL;
+  op->data = NULL;
+  op->len = 0;
+}
+
+
+static int uv__stream_iou_start(uv_stream_t* stream) {
+  struct uv__stream_iou* op;
+
+  op = uv__stream_iou_get(stream);
+  if (op == NULL) {
+    if (stream->type != UV_TCP ||
+        uv__io_active(&stream->io_watcher, POLLIN) ||
+        !uv__iou_streams(stream->loop)) {
+      return -1;
+    }
+
+    op = uv__malloc(sizeof(*op));
+    if (op == NULL)
+      return -1;
+
+    QUEUE_INIT(&op->queue);
+    QUEUE_INIT(&op->cancel.queue);
+    op->cancel.data = (uintptr_t) op | 1;
+    op->loop = stream->loop;
+    op->stream = stream;
+    op->data = NULL;
+    op->len = 0;
+    op->heap = NULL;
+    op->bid = 0;
+    op->armed = 0;
+    op->canceling = 0;
+    RB_INSERT(uv__stream_iou_tree,
+              CAST(uv__iou_stream_tree(stream->loop)),
+              op);
+    stream->flags |= UV_STREAM_IOU;
+  }
+
+  /* read_cb is never called from here, data that was received while the
+   * stream wasn't reading waits for uv__stream_io().  A receive that is
+   * being canceled is armed again when it completes, a connecting stream
+   * starts receiving in uv__stream_connect().
+   */
+  if (op->len > 0)
+    uv__io_feed(stream->loop, &stream->io_watcher);
+  else if (!op->armed && stream->connect_req == NULL)
+    if (uv__stream_iou_arm(stream))
+      uv__io_feed(stream->loop, &stream->io_watcher);
+
+  return 0;
+}
+
+
+/* Passes on what was received and receives again while the stream is
+ * reading.  Runs from the ring's completion callback or, when that has to
+ * wait, from uv__stream_io() after uv__io_feed().
+ */
+static void uv__stream_iou_read(uv_stream_t* stream) {
+  struct uv__stream_iou* op;
+  uv_buf_t buf;
+  size_t n;
+
+  op = uv__stream_iou_get(stream);
+
+  while (op->len > 0 && (stream->flags & UV_STREAM_READING)) {
+    buf = uv_buf_init(NULL, 0);
+    stream->alloc_cb((uv_handle_t*) stream, 64 * 1024, &buf);
+    if (buf.base == NULL || buf.len == 0) {
+      /* User indicates it can't or won't handle the read. */
+      stream->read_cb(stream, UV_ENOBUFS, &buf);
+      if (uv__stream_iou_reading(stream))
+        uv__io_feed(stream->loop, &stream->io_watcher);
+      return;
+    }
+
+    n = op->len < buf.len ? op->len : buf.len;
+    memcpy(buf.base, op->data, n);
+    op->data += n;
+    op->len -= n;
+    if (op->len == 0)
+      uv__stream_iou_drop(op);
+
+    stream->read_cb(stream, n, &buf);
+
+    if (!(stream->flags & UV_STREAM_IOU))
+      return;  /* read_cb closed the stream. */
+  }
+
+  if (op->len > 0) {
+    /* Don't hold on to one of the loop's buffers while the stream is paused,
+     * there are only so many of them.
+     */
+    if (op->heap == NULL) {
+      op->heap = uv__malloc(op->len);
+      if (op->heap != NULL) {
+        memcpy(op->heap, op->data, op->len);
+        uv__iou_buf_release(op->loop, op->bid);
+        op->data = op->heap;
+      }
+    }
+    return;
+  }
+
+  if (op->armed || !(stream->flags & UV_STREAM_READING))
+    return;
+
+  if (uv__stream_iou_arm(stream))
+    uv__io_feed(stream->loop, &stream->io_watcher);
+}
+
+
+void uv__stream_iou_done(void* data, int32_t res, uint32_t flags) {
+  struct uv__stream_iou* op;
+  uv_stream_t* stream;
+  uv_buf_t buf;
+
+  op = data;
+  op->armed = 0;
+  op->canceling = 0;
+  stream = op->stream;
+
+  /* Completed before the cancellation found a submission queue entry. */
+  if (!QUEUE_EMPTY(&op->cancel.queue)) {
+    QUEUE_REMOVE(&op->cancel.queue);
+    QUEUE_INIT(&op->cancel.queue);
+  }
+
+  if (stream == NULL) {
+    /* The stream was closed in the meantime. */
+    if (flags & UV__IORING_CQE_F_BUFFER)
+      uv__iou_buf_release(op->loop, flags >> UV__IORING_CQE_BUFFER_SHIFT);
+    QUEUE_REMOVE(&op->queue);
+    uv__free(op);
+    return;
+  }
+
+  if (res > 0) {
+    assert(flags & UV__IORING_CQE_F_BUFFER);
+    op->bid = flags >> UV__IORING_CQE_BUFFER_SHIFT;
+    op->data = uv__iou_buf(op->loop, op->bid);
+    op->len = res;
+    uv__stream_iou_read(stream);
+    return;
+  }
+
+  /* End of file and errors are reported again by the next receive if the
+   * stream was stopped in the meantime.  Running out of buffers lasts until
+   * the next flush, which gives back the ones that were passed on.
+   */
+  if (!(stream->flags & UV_STREAM_READING) ||
+      res == -ECANCELED ||
+      res == -EINTR ||
+      res == -EAGAIN ||
+      res == -ENOBUFS) {
+    uv__stream_iou_read(stream);
+    return;
+  }
+
+  buf = uv_buf_init(NULL, 0);
+  if (res == 0) {
+    uv__stream_eof(stream, &buf);
+    return;
+  }
+
+  /* Error. User should call uv_close(). */
+  stream->read_cb(stream, res, &buf);
+  if (stream->flags & UV_STREAM_READING) {
+    stream->flags &= ~UV_STREAM_READING;
+    if (!uv__io_active(&stream->io_watcher, POLLOUT))
+      uv__handle_stop(stream);
+  }
+}
+
+
+static void uv__stream_iou_stop(uv_stream_t* stream) {
+  struct uv__stream_iou* op;
+
+  op = uv__stream_iou_get(stream);
+  if (!op->armed || op->canceling)
+    return;
+
+  /* Data that arrives before the cancellation waits for the next
+   * uv_read_start().  The receive has to go even when the ring is full, it
+   * holds on to the socket after close.
+   */
+  uv__iou_async_cancel(stream->loop, &op->cancel);
+  op->canceling = 1;
+}
+
+
+static void uv__stream_iou_close(uv_stream_t* stream) {
+  struct uv__stream_iou* op;
+
+  op = uv__stream_iou_get(stream);
+  if (op == NULL)
+    return;
+
+  uv__stream_iou_stop(stream);
+  uv__stream_iou_drop(op);
+  RB_REMOVE(uv__stream_iou_tree, CAST(uv__iou_stream_tree(stream->loop)), op);
+  stream->flags &= ~UV_STREAM_IOU;
+
+  if (op->armed) {
+    op->stream = NULL;
+    uv__iou_orphan(stream->loop, &op->queue);
+  } else {
+    uv__free(op);
+  }
+}
+
+#undef CAST
+#endif /* __linux__ */
+
 #undef UV__CMSG_FD_COUNT
 #undef UV__CMSG_FD_SIZE
 
@@ -1243,6 +1557,7 @@ int uv_shutdown(uv_shutdown_t* req, uv_stream_t* stream, uv_shutdown_cb cb) {
 
 static void uv__stream_io(uv_loop_t* loop, uv__io_t* w, unsigned int events) {
   uv_stream_t* stream;
+  unsigned int revents;
 
   stream = container_of(w, uv_stream_t, io_watcher);
 
@@ -1258,8 +1573,22 @@ static void uv__stream_io(uv_loop_t* loop, uv__io_t* w, unsigned int events) {
 
   assert(uv__stream_fd(stream) >= 0);
 
+  revents = events;
+
+#if defined(__linux__)
+  /* The ring reports errors and end of file for the receive in flight, the
+   * events of the fd are only of interest to the writer.
+   */
+  if (stream->flags & UV_STREAM_IOU) {
+    uv__stream_iou_read(stream);
+    if (uv__stream_fd(stream) == -1)
+      return;  /* read_cb closed stream. */
+    revents = 0;
+  }
+#endif /* __linux__ */
+
   /* Ignore POLLHUP here. Even it it's set, there may still be data to read. */
-  if (events & (POLLIN | POLLERR | POLLHUP))
+  if (revents & (POLLIN | POLLERR | POLLHUP))
     uv__read(stream);
 
   if (uv__stream_fd(stream) == -1)
@@ -1271,7 +1600,7 @@ static void uv__stream_io(uv_loop_t* loop, uv__io_t* w, unsigned int events) {
    * have to do anything. If the partial read flag is not set, we can't
    * report the EOF yet because there is still data to read.
    */
-  if ((events & POLLHUP) &&
+  if ((revents & POLLHUP) &&
       (stream->flags & UV_STREAM_READING) &&
       (stream->flags & UV_STREAM_READ_PARTIAL) &&
       !(stream->flags & UV_STREAM_READ_EOF)) {
@@ -1344,6 +1673,11 @@ static void uv__stream_connect(uv_stream_t* stream) {
     uv__stream_flush_write_queue(stream, -ECANCELED);
     uv__write_callbacks(stream);
   }
+
+#if defined(__linux__)
+  if ((stream->flags & UV_STREAM_IOU) && uv__stream_fd(stream) != -1)
+    uv__stream_iou_read(stream);
+#endif /* __linux__ */
 }
 
 
@@ -1524,6 +1858,13 @@ int uv_read_start(uv_stream_t* stream,
   stream->read_cb = read_cb;
   stream->alloc_cb = alloc_cb;
 
+#if defined(__linux__)
+  if (uv__stream_iou_start(stream) == 0) {
+    uv__handle_start(stream);
+    return 0;
+  }
+#endif /* __linux__ */
+
   uv__io_start(stream->loop, &stream->io_watcher, POLLIN);
   uv__handle_start(stream);
   uv__stream_osx_interrupt_select(stream);
@@ -1542,6 +1883,11 @@ int uv_read_stop(uv_stream_t* stream) {
     uv__handle_stop(stream);
   uv__stream_osx_interrupt_select(stream);
 
+#if defined(__linux__)
+  if (stream->flags & UV_STREAM_IOU)
+    uv__stream_iou_stop(stream);
+#endif /* __linux__ */
+
   stream->read_cb = NULL;
   stream->alloc_cb = NULL;
   return 0;
@@ -1604,6 +1950,10 @@ void uv__stream_close(uv_stream_t* handle) {
   uv_read_stop(handle);
   uv__handle_stop(handle);
 
+#if defined(__linux__)
+  uv__stream_iou_close(handle);
+#endif /* __linux__ */
+
   if (handle->io_watcher.fd != -1) {
     /* Don't close stdio file descriptors.  Nothing good comes from it. */
     if (handle->io_watcher.fd > STDERR_FILENO)
@@ -39,6 +39,15 @@
 # define IPV6_DROP_MEMBERSHIP IPV6_LEAVE_GROUP
 #endif
 
+#define UV__UDP_DGRAM_MAXSIZE (64 * 1024)
+
+#if defined(__linux__)
+# define UV__MMSG_MAXWIDTH 20
+static uv_once_t once = UV_ONCE_INIT;
+static int uv__recvmmsg_avail;
+static int uv__sendmmsg_avail;
+#endif
+
 
 static void uv__udp_run_completed(uv_udp_t* handle);
 static void uv__udp_io(uv_loop_t* loop, uv__io_t* w, unsigned int revents);
@@ -48,6 +57,24 @@ static int uv__udp_maybe_deferred_bind(uv_udp_t* handle,
                                        int domain,
                                        unsigned int flags);
 
+#if defined(__linux__)
+static void uv__udp_mmsg_init(void) {
+  int ret;
+  int s;
+
+  s = uv__socket(AF_INET, SOCK_DGRAM, 0);
+  if (s < 0)
+    return;
+  ret = uv__sendmmsg(s, NULL, 0, 0);
+  if (ret == 0 || errno != ENOSYS)
+    uv__sendmmsg_avail = 1;
+  ret = uv__recvmmsg(s, NULL, 0, MSG_DONTWAIT, NULL);
+  if (ret == 0 || errno != ENOSYS)
+    uv__recvmmsg_avail = 1;
+  uv__close(s);
+}
+#endif
+
 
 void uv__udp_close(uv_udp_t* handle) {
   uv__io_close(handle->loop, &handle->io_watcher);
@@ -148,6 +175,67 @@ static void uv__udp_io(uv_loop_t* loop, uv__io_t* w, unsigned int revents) {
 }
 
 
+#if defined(__linux__)
+static ssize_t uv__udp_recvmmsg(uv_udp_t* handle, uv_buf_t* buf) {
+  struct sockaddr_storage peers[UV__MMSG_MAXWIDTH];
+  struct iovec iov[UV__MMSG_MAXWIDTH];
+  struct uv__mmsghdr msgs[UV__MMSG_MAXWIDTH];
+  ssize_t nread;
+  uv_buf_t chunk_buf;
+  size_t chunks;
+  int flags;
+  size_t k;
+
+  /* prepare structures for recvmmsg */
+  chunks = buf->len / UV__UDP_DGRAM_MAXSIZE;
+  if (chunks > ARRAY_SIZE(iov))
+    chunks = ARRAY_SIZE(iov);
+  for (k = 0; k < chunks; ++k) {
+    iov[k].iov_base = buf->base + k * UV__UDP_DGRAM_MAXSIZE;
+    iov[k].iov_len = UV__UDP_DGRAM_MAXSIZE;
+    memset(&msgs[k].msg_hdr, 0, sizeof(msgs[k].msg_hdr));
+    msgs[k].msg_hdr.msg_iov = iov + k;
+    msgs[k].msg_hdr.msg_iovlen = 1;
+    msgs[k].msg_hdr.msg_name = peers + k;
+    msgs[k].msg_hdr.msg_namelen = sizeof(peers[0]);
+  }
+
+  do
+    nread = uv__recvmmsg(handle->io_watcher.fd, msgs, chunks, 0, NULL);
+  while (nread == -1 && errno == EINTR);
+
+  if (nread < 1) {
+    if (nread == 0 || errno == EAGAIN || errno == EWOULDBLOCK)
+      handle->recv_cb(handle, 0, buf, NULL, 0);
+    else
+      handle->recv_cb(handle, -errno, buf, NULL, 0);
+    return -1;
+  }
+
+  /* pass each chunk to the application */
+  for (k = 0; k < (size_t) nread && handle->recv_cb != NULL; k++) {
+    flags = UV_UDP_MMSG_CHUNK;
+    if (msgs[k].msg_hdr.msg_flags & MSG_TRUNC)
+      flags |= UV_UDP_PARTIAL;
+
+    chunk_buf = uv_buf_init(iov[k].iov_base, iov[k].iov_len);
+    handle->recv_cb(handle,
+                    msgs[k].msg_len,
+                    &chunk_buf,
+                    msgs[k].msg_hdr.msg_namelen == 0 ?
+                        NULL : msgs[k].msg_hdr.msg_name,
+                    flags);
+  }
+
+  /* one last callback so the original buffer is freed */
+  if (handle->recv_cb != NULL)
+    handle->recv_cb(handle, 0, buf, NULL, 0);
+
+  return nread;
+}
+#endif
+
+
 static void uv__udp_recvmsg(uv_udp_t* handle) {
   struct sockaddr_storage peer;
   struct msghdr h;
@@ -169,13 +257,26 @@ static void uv__udp_recvmsg(uv_udp_t* handle) {
 
   do {
     buf = uv_buf_init(NULL, 0);
-    handle->alloc_cb((uv_handle_t*) handle, 64 * 1024, &buf);
+    handle->alloc_cb((uv_handle_t*) handle, UV__UDP_DGRAM_MAXSIZE, &buf);
     if (buf.base == NULL || buf.len == 0) {
       handle->recv_cb(handle, UV_ENOBUFS, &buf, NULL, 0);
       return;
     }
     assert(buf.base != NULL);
 
+#if defined(__linux__)
+    if ((handle->flags & UV_HANDLE_UDP_RECVMMSG) &&
+        buf.len >= UV__UDP_DGRAM_MAXSIZE) {
+      uv_once(&once, uv__udp_mmsg_init);
+      if (uv__recvmmsg_avail) {
+        nread = uv__udp_recvmmsg(handle, &buf);
+        if (nread > 0)
+          count -= nread;
+        continue;
+      }
+    }
+#endif
+
     h.msg_namelen = sizeof(peer);
     h.msg_iov = (void*) &buf;
     h.msg_iovlen = 1;
@@ -213,12 +314,84 @@ static void uv__udp_recvmsg(uv_udp_t* handle) {
 }
 
 
+#if defined(__linux__)
+static void uv__udp_sendmmsg(uv_udp_t* handle) {
+  struct uv__mmsghdr h[UV__MMSG_MAXWIDTH];
+  struct uv__mmsghdr* p;
+  uv_udp_send_t* req;
+  QUEUE* q;
+  ssize_t npkts;
+  size_t pkts;
+  size_t i;
+
+  while (!QUEUE_EMPTY(&handle->write_queue)) {
+    for (pkts = 0, q = QUEUE_HEAD(&handle->write_queue);
+         pkts < UV__MMSG_MAXWIDTH && q != &handle->write_queue;
+         ++pkts, q = QUEUE_NEXT(q)) {
+      req = QUEUE_DATA(q, uv_udp_send_t, queue);
+      assert(req != NULL);
+
+      p = &h[pkts];
+      memset(p, 0, sizeof(*p));
+      if (req->addr.ss_family != AF_UNSPEC) {
+        p->msg_hdr.msg_name = &req->addr;
+        p->msg_hdr.msg_namelen = (req->addr.ss_family == AF_INET6 ?
+          sizeof(struct sockaddr_in6) : sizeof(struct sockaddr_in));
+      }
+      p->msg_hdr.msg_iov = (struct iovec*) req->bufs;
+      p->msg_hdr.msg_iovlen = req->nbufs;
+    }
+
+    do {
+      npkts = uv__sendmmsg(handle->io_watcher.fd, h, pkts, 0);
+    } while (npkts == -1 && errno == EINTR);
+
+    if (npkts == -1) {
+      if (errno == EAGAIN || errno == EWOULDBLOCK)
+        break;
+
+      /* sendmmsg() only fails when the first datagram could not be sent,
+       * fail that request and carry on with the rest of the queue.
+       */
+      q = QUEUE_HEAD(&handle->write_queue);
+      req = QUEUE_DATA(q, uv_udp_send_t, queue);
+      req->status = -errno;
+      QUEUE_REMOVE(&req->queue);
+      QUEUE_INSERT_TAIL(&handle->write_completed_queue, &req->queue);
+      uv__io_feed(handle->loop, &handle->io_watcher);
+      continue;
+    }
+
+    /* Same as uv__udp_sendmsg(): datagrams are sent atomically, so every
+     * request that made it into the kernel is complete.
+     */
+    for (i = 0; i < (size_t) npkts; i++) {
+      q = QUEUE_HEAD(&handle->write_queue);
+      req = QUEUE_DATA(q, uv_udp_send_t, queue);
+      req->status = h[i].msg_len;
+      QUEUE_REMOVE(&req->queue);
+      QUEUE_INSERT_TAIL(&handle->write_completed_queue, &req->queue);
+    }
+    uv__io_feed(handle->loop, &handle->io_watcher);
+  }
+}
+#endif
+
+
 static void uv__udp_sendmsg(uv_udp_t* handle) {
   uv_udp_send_t* req;
   QUEUE* q;
   struct msghdr h;
   ssize_t size;
 
+#if defined(__linux__)
+  uv_once(&once, uv__udp_mmsg_init);
+  if (uv__sendmmsg_avail) {
+    uv__udp_sendmmsg(handle);
+    return;
+  }
+#endif
+
   while (!QUEUE_EMPTY(&handle->write_queue)) {
     q = QUEUE_HEAD(&handle->write_queue);
     assert(q != NULL);
@@ -227,9 +400,11 @@ static void uv__udp_sendmsg(uv_udp_t* handle) {
     assert(req != NULL);
 
     memset(&h, 0, sizeof h);
-    h.msg_name = &req->addr;
-    h.msg_namelen = (req->addr.ss_family == AF_INET6 ?
-      sizeof(struct sockaddr_in6) : sizeof(struct sockaddr_in));
+    if (req->addr.ss_family != AF_UNSPEC) {
+      h.msg_name = &req->addr;
+      h.msg_namelen = (req->addr.ss_family == AF_INET6 ?
+        sizeof(struct sockaddr_in6) : sizeof(struct sockaddr_in));
+    }
     h.msg_iov = (struct iovec*) req->bufs;
     h.msg_iovlen = req->nbufs;
 
@@ -383,6 +558,56 @@ static int uv__udp_maybe_deferred_bind(uv_udp_t* handle,
 }
 
 
+int uv__udp_connect(uv_udp_t* handle,
+                    const struct sockaddr* addr,
+                    unsigned int addrlen) {
+  int err;
+
+  if (handle->flags & UV_HANDLE_UDP_CONNECTED)
+    return -EISCONN;
+
+  err = uv__udp_maybe_deferred_bind(handle, addr->sa_family, 0);
+  if (err)
+    return err;
+
+  do {
+    errno = 0;
+    err = connect(handle->io_watcher.fd, addr, addrlen);
+  } while (err == -1 && errno == EINTR);
+
+  if (err)
+    return -errno;
+
+  handle->flags |= UV_HANDLE_UDP_CONNECTED;
+
+  return 0;
+}
+
+
+int uv__udp_disconnect(uv_udp_t* handle) {
+  struct sockaddr addr;
+  int r;
+
+  if (!(handle->flags & UV_HANDLE_UDP_CONNECTED))
+    return -ENOTCONN;
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sa_family = AF_UNSPEC;
+
+  do {
+    errno = 0;
+    r = connect(handle->io_watcher.fd, &addr, sizeof(addr));
+  } while (r == -1 && errno == EINTR);
+
+  /* Some BSDs report EAFNOSUPPORT although the socket was dissolved. */
+  if (r == -1 && errno != EAFNOSUPPORT)
+    return -errno;
+
+  handle->flags &= ~UV_HANDLE_UDP_CONNECTED;
+  return 0;
+}
+
+
 int uv__udp_send(uv_udp_send_t* req,
                  uv_udp_t* handle,
                  const uv_buf_t bufs[],
@@ -395,9 +620,17 @@ int uv__udp_send(uv_udp_send_t* req,
 
   assert(nbufs > 0);
 
-  err = uv__udp_maybe_deferred_bind(handle, addr->sa_family, 0);
-  if (err)
-    return err;
+  if (addr == NULL) {
+    if (!(handle->flags & UV_HANDLE_UDP_CONNECTED))
+      return -EDESTADDRREQ;
+  } else {
+    if (handle->flags & UV_HANDLE_UDP_CONNECTED)
+      return -EISCONN;
+
+    err = uv__udp_maybe_deferred_bind(handle, addr->sa_family, 0);
+    if (err)
+      return err;
+  }
 
   /* It's legal for send_queue_count > 0 even when the write_queue is empty;
    * it means there are error-state requests in the write_completed_queue that
@@ -407,7 +640,10 @@ int uv__udp_send(uv_udp_send_t* req,
 
   uv__req_init(handle->loop, req, UV_UDP_SEND);
   assert(addrlen <= sizeof(req->addr));
-  memcpy(&req->addr, addr, addrlen);
+  if (addr == NULL)
+    req->addr.ss_family = AF_UNSPEC;
+  else
+    memcpy(&req->addr, addr, addrlen);
   req->send_cb = send_cb;
   req->handle = handle;
   req->nbufs = nbufs;
@@ -452,9 +688,17 @@ int uv__udp_try_send(uv_udp_t* handle,
   if (handle->send_queue_count != 0)
     return -EAGAIN;
 
-  err = uv__udp_maybe_deferred_bind(handle, addr->sa_family, 0);
-  if (err)
-    return err;
+  if (addr == NULL) {
+    if (!(handle->flags & UV_HANDLE_UDP_CONNECTED))
+      return -EDESTADDRREQ;
+  } else {
+    if (handle->flags & UV_HANDLE_UDP_CONNECTED)
+      return -EISCONN;
+
+    err = uv__udp_maybe_deferred_bind(handle, addr->sa_family, 0);
+    if (err)
+      return err;
+  }
 
   memset(&h, 0, sizeof h);
   h.msg_name = (struct sockaddr*) addr;
@@ -581,7 +825,7 @@ int uv_udp_init_ex(uv_loop_t* loop, uv_udp_t* handle, unsigned int flags) {
   if (domain != AF_INET && domain != AF_INET6 && domain != AF_UNSPEC)
     return -EINVAL;
 
-  if (flags & ~0xFF)
+  if (flags & ~0xFF & ~UV_UDP_RECVMMSG)
     return -EINVAL;
 
   if (domain != AF_UNSPEC) {
@@ -594,6 +838,8 @@ int uv_udp_init_ex(uv_loop_t* loop, uv_udp_t* handle, unsigned int flags) {
   }
 
   uv__handle_init(loop, (uv_handle_t*)handle, UV_UDP);
+  if (flags & UV_UDP_RECVMMSG)
+    handle->flags |= UV_HANDLE_UDP_RECVMMSG;
   handle->alloc_cb = NULL;
   handle->recv_cb = NULL;
   handle->send_queue_size = 0;
@@ -838,6 +1084,25 @@ int uv_udp_set_multicast_interface(uv_udp_t* handle, const char* interface_addr)
 }
 
 
+int uv_udp_getpeername(const uv_udp_t* handle,
+                       struct sockaddr* name,
+                       int* namelen) {
+  socklen_t socklen;
+
+  if (handle->io_watcher.fd == -1)
+    return -EINVAL;  /* FIXME(bnoordhuis) -EBADF */
+
+  /* sizeof(socklen_t) != sizeof(int) on some systems. */
+  socklen = (socklen_t) *namelen;
+
+  if (getpeername(handle->io_watcher.fd, name, &socklen))
+    return -errno;
+
+  *namelen = (int) socklen;
+  return 0;
+}
+
+
 int uv_udp_getsockname(const uv_udp_t* handle,
                        struct sockaddr* name,
                        int* namelen) {
@@ -284,6 +284,27 @@ int uv_tcp_connect(uv_connect_t* req,
 }
 
 
+int uv_udp_connect(uv_udp_t* handle, const struct sockaddr* addr) {
+  unsigned int addrlen;
+
+  if (handle->type != UV_UDP)
+    return UV_EINVAL;
+
+  /* Disconnect the handle */
+  if (addr == NULL)
+    return uv__udp_disconnect(handle);
+
+  if (addr->sa_family == AF_INET)
+    addrlen = sizeof(struct sockaddr_in);
+  else if (addr->sa_family == AF_INET6)
+    addrlen = sizeof(struct sockaddr_in6);
+  else
+    return UV_EINVAL;
+
+  return uv__udp_connect(handle, addr, addrlen);
+}
+
+
 int uv_udp_send(uv_udp_send_t* req,
                 uv_udp_t* handle,
                 const uv_buf_t bufs[],
@@ -295,7 +316,10 @@ int uv_udp_send(uv_udp_send_t* req,
   if (handle->type != UV_UDP)
     return UV_EINVAL;
 
-  if (addr->sa_family == AF_INET)
+  /* A NULL address sends to the peer of a connected handle. */
+  if (addr == NULL)
+    addrlen = 0;
+  else if (addr->sa_family == AF_INET)
     addrlen = sizeof(struct sockaddr_in);
   else if (addr->sa_family == AF_INET6)
     addrlen = sizeof(struct sockaddr_in6);
@@ -315,7 +339,9 @@ int uv_udp_try_send(uv_udp_t* handle,
   if (handle->type != UV_UDP)
     return UV_EINVAL;
 
-  if (addr->sa_family == AF_INET)
+  if (addr == NULL)
+    addrlen = 0;
+  else if (addr->sa_family == AF_INET)
     addrlen = sizeof(struct sockaddr_in);
   else if (addr->sa_family == AF_INET6)
     addrlen = sizeof(struct sockaddr_in6);
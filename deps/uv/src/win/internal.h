@@ -88,6 +88,9 @@ extern UV_THREAD_LOCAL int uv__crt_assert_enabled;
 /* Used by uv_tcp_t and uv_udp_t handles */
 #define UV_HANDLE_IPV6                          0x01000000
 
+/* Only used by uv_udp_t handles. */
+#define UV_HANDLE_UDP_CONNECTED                 0x02000000
+
 /* Only used by uv_tcp_t handles. */
 #define UV_HANDLE_TCP_NODELAY                   0x02000000
 #define UV_HANDLE_TCP_KEEPALIVE                 0x04000000
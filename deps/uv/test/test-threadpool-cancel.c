@@ -22,6 +22,13 @@
 #include "uv.h"
 #include "task.h"
 
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#ifndef _WIN32
+# include <unistd.h>
+#endif
+
 #define INIT_CANCEL_INFO(ci, what)                                            \
   do {                                                                        \
     (ci)->reqs = (what);                                                      \
@@ -287,6 +294,110 @@ TEST_IMPL(threadpool_cancel_fs) {
 }
 
 
+/* Like threadpool_cancel_fs but on a loop that submits file system requests
+ * through io_uring where it can: requests the loop hasn't handed to the
+ * kernel yet can be canceled too.
+ */
+TEST_IMPL(threadpool_cancel_fs_queued) {
+  uv_fs_t reqs[5];
+  uv_fs_t req;
+  uv_loop_t* loop;
+  unsigned n;
+  unsigned i;
+  uv_buf_t iov;
+
+  loop = uv_default_loop();
+  uv_loop_configure(loop, UV_LOOP_USE_IO_URING);
+  saturate_threadpool();
+  iov = uv_buf_init(NULL, 0);
+
+  uv_fs_unlink(NULL, &req, "test_file", NULL);
+  uv_fs_req_cleanup(&req);
+
+  n = 0;
+  ASSERT(0 == uv_fs_open(loop,
+                         reqs + n++,
+                         "test_file",
+                         O_WRONLY | O_CREAT,
+                         S_IWUSR | S_IRUSR,
+                         fs_cb));
+  ASSERT(0 == uv_fs_stat(loop, reqs + n++, ".", fs_cb));
+  ASSERT(0 == uv_fs_lstat(loop, reqs + n++, ".", fs_cb));
+  ASSERT(0 == uv_fs_fstat(loop, reqs + n++, 0, fs_cb));
+  ASSERT(0 == uv_fs_read(loop, reqs + n++, 0, &iov, 1, 0, fs_cb));
+  ASSERT(n == ARRAY_SIZE(reqs));
+
+  for (i = 0; i < n; i++)
+    ASSERT(0 == uv_cancel((uv_req_t*) (reqs + i)));
+
+  unblock_threadpool();
+  ASSERT(0 == uv_run(loop, UV_RUN_DEFAULT));
+  ASSERT(n == fs_cb_called);
+
+  /* The open never ran. */
+  ASSERT(UV_ENOENT == uv_fs_stat(NULL, &req, "test_file", NULL));
+  uv_fs_req_cleanup(&req);
+
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+}
+
+
+static void fs_in_kernel_cb(uv_fs_t* req) {
+  /* The read only completes when the cancellation didn't get to it. */
+  if (req->data != NULL)
+    ASSERT(req->result == 1);
+  else
+    ASSERT(req->result == UV_ECANCELED);
+  uv_fs_req_cleanup(req);
+  fs_cb_called++;
+}
+
+
+/* A read from an empty pipe waits in the kernel when it goes through io_uring,
+ * uv_cancel() asks the kernel to call it off.  It runs on the threadpool and
+ * can't be canceled everywhere else.
+ */
+TEST_IMPL(threadpool_cancel_fs_in_kernel) {
+#ifdef _WIN32
+  RETURN_SKIP("Test does not currently work in Windows");
+#else
+  uv_loop_t* loop;
+  uv_fs_t req;
+  uv_buf_t iov;
+  char buf[1];
+  int fds[2];
+  int r;
+
+  loop = uv_default_loop();
+  uv_loop_configure(loop, UV_LOOP_USE_IO_URING);
+  ASSERT(0 == pipe(fds));
+  iov = uv_buf_init(buf, sizeof(buf));
+
+  req.data = NULL;
+  ASSERT(0 == uv_fs_read(loop, &req, fds[0], &iov, 1, -1, fs_in_kernel_cb));
+  ASSERT(0 != uv_run(loop, UV_RUN_NOWAIT));
+
+  r = uv_cancel((uv_req_t*) &req);
+  if (r == UV_EBUSY) {
+    req.data = &req;
+    ASSERT(1 == write(fds[1], "x", 1));
+  } else {
+    ASSERT(r == 0);
+  }
+
+  ASSERT(0 == uv_run(loop, UV_RUN_DEFAULT));
+  ASSERT(1 == fs_cb_called);
+
+  ASSERT(0 == close(fds[0]));
+  ASSERT(0 == close(fds[1]));
+
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+#endif
+}
+
+
 TEST_IMPL(threadpool_cancel_single) {
   uv_loop_t* loop;
   uv_work_t req;
@@ -9,6 +9,9 @@ const incoming = require('_http_incoming');
 const IncomingMessage = incoming.IncomingMessage;
 const readStart = incoming.readStart;
 const readStop = incoming.readStop;
+// The binding builds `parsedHeaders` the way this method would. When it has
+// been replaced, the replacement gets to see every header line instead.
+const addHeaderLine = IncomingMessage.prototype._addHeaderLine;
 
 const debug = require('util').debuglog('http');
 exports.debug = debug;
@@ -42,9 +45,11 @@ function parserOnHeaders(headers, url) {
 // this request.
 // `url` is not set for response parsers but that's not applicable here since
 // all our parsers are request parsers.
+// `parsedHeaders` is what IncomingMessage#_addHeaderLines() would make of
+// `headers`, when the binding was able to build it.
 function parserOnHeadersComplete(versionMajor, versionMinor, headers, method,
                                  url, statusCode, statusMessage, upgrade,
-                                 shouldKeepAlive) {
+                                 shouldKeepAlive, parsedHeaders) {
   var parser = this;
 
   if (!headers) {
@@ -69,7 +74,13 @@ function parserOnHeadersComplete(versionMajor, versionMinor, headers, method,
   if (parser.maxHeaderPairs > 0)
     n = Math.min(n, parser.maxHeaderPairs);
 
-  parser.incoming._addHeaderLines(headers, n);
+  if (parsedHeaders !== undefined && n === headers.length &&
+      parser.incoming._addHeaderLine === addHeaderLine) {
+    parser.incoming.rawHeaders = headers;
+    parser.incoming.headers = parsedHeaders;
+  } else {
+    parser.incoming._addHeaderLines(headers, n);
+  }
 
   if (typeof method === 'number') {
     // server only
@@ -130,6 +130,9 @@ function _addHeaderLines(headers, n) {
 // multiple values this way. If not, we declare the first instance the winner
 // and drop the second. Extended header fields (those beginning with 'x-') are
 // always joined.
+//
+// The HTTP parser binding applies the same rules when it builds the headers
+// object itself, keep GetHeaderKind() in src/node_http_parser.cc in sync.
 IncomingMessage.prototype._addHeaderLine = _addHeaderLine;
 function _addHeaderLine(field, value, dest) {
   field = field.toLowerCase();
@@ -7,8 +7,10 @@ const util = require('util');
 const internalUtil = require('internal/util');
 const Buffer = require('buffer').Buffer;
 const common = require('_http_common');
+const binding = process.binding('http_parser');
 
 const CRLF = common.CRLF;
+const serializeHeaders = binding.serializeHeaders;
 const trfrEncChunkExpression = common.chunkExpression;
 const debug = common.debug;
 
@@ -160,7 +162,12 @@ function _writeRaw(data, encoding, callback) {
     // There might be pending data in the this.output buffer.
     var outputLength = this.output.length;
     if (outputLength > 0) {
-      this._flushOutput(connection);
+      // Hand the pending data, usually the headers, and this chunk to the
+      // socket together so that they go out in a single writev.
+      this.output.push(data);
+      this.outputEncodings.push(encoding);
+      this.outputCallbacks.push(callback);
+      return this._flushOutput(connection);
     } else if (data.length === 0) {
       if (typeof callback === 'function')
         process.nextTick(callback);
@@ -208,27 +215,15 @@ function _storeHeader(firstLine, headers) {
   };
 
   if (headers) {
-    var keys = Object.keys(headers);
-    var isArray = Array.isArray(headers);
-    var field, value;
-
-    for (var i = 0, l = keys.length; i < l; i++) {
-      var key = keys[i];
-      if (isArray) {
-        field = headers[key][0];
-        value = headers[key][1];
-      } else {
-        field = key;
-        value = headers[key];
-      }
-
-      if (Array.isArray(value)) {
-        for (var j = 0; j < value.length; j++) {
-          storeHeader(this, state, field, value[j]);
-        }
-      } else {
-        storeHeader(this, state, field, value);
-      }
+    var fields = headerFields(headers);
+    var flags = serializeHeaders(state, fields);
+    if (flags >= 0) {
+      applyHeaderFlags(this, state, flags);
+    } else {
+      // Throws the usual error for an invalid header, or stores headers with
+      // values the binding does not convert itself.
+      for (var i = 0; i < fields.length; i += 2)
+        storeHeader(this, state, fields[i], fields[i + 1]);
     }
   }
 
@@ -311,6 +306,63 @@ function _storeHeader(firstLine, headers) {
   if (state.sentExpect) this._send('');
 }
 
+// Flattens the header object or array into [field, value, field, ...].
+function headerFields(headers) {
+  var fields = [];
+  var keys = Object.keys(headers);
+  var isArray = Array.isArray(headers);
+  var field, value;
+
+  for (var i = 0, l = keys.length; i < l; i++) {
+    var key = keys[i];
+    if (isArray) {
+      field = headers[key][0];
+      value = headers[key][1];
+    } else {
+      field = key;
+      value = headers[key];
+    }
+
+    if (Array.isArray(value)) {
+      for (var j = 0; j < value.length; j++) {
+        fields.push(field, value[j]);
+      }
+    } else {
+      fields.push(field, value);
+    }
+  }
+  return fields;
+}
+
+// Does for the headers that serializeHeaders() stored what storeHeader()
+// does for a single one.
+function applyHeaderFlags(self, state, flags) {
+  if (flags & binding.kSentConnectionHeader) {
+    state.sentConnectionHeader = true;
+    if (flags & binding.kConnectionClose)
+      self._last = true;
+    if (flags & binding.kConnectionKeepAlive)
+      self.shouldKeepAlive = true;
+    if (flags & binding.kConnectionUpgrade)
+      state.sentConnectionUpgrade = true;
+  }
+  if (flags & binding.kSentTransferEncodingHeader) {
+    state.sentTransferEncodingHeader = true;
+    if (flags & binding.kChunkedEncoding)
+      self.chunkedEncoding = true;
+  }
+  if (flags & binding.kSentContentLengthHeader)
+    state.sentContentLengthHeader = true;
+  if (flags & binding.kSentDateHeader)
+    state.sentDateHeader = true;
+  if (flags & binding.kSentExpect)
+    state.sentExpect = true;
+  if (flags & binding.kSentTrailer)
+    state.sentTrailer = true;
+  if (flags & binding.kSentUpgrade)
+    state.sentUpgrade = true;
+}
+
 function storeHeader(self, state, field, value) {
   if (!common._checkIsHttpToken(field)) {
     throw new TypeError(
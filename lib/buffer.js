@@ -1361,6 +1361,24 @@ Buffer.prototype.swap64 = function swap64() {
 
 Buffer.prototype.toLocaleString = Buffer.prototype.toString;
 
+function checkBytesArgument(input) {
+  if (!ArrayBuffer.isView(input) && !isArrayBuffer(input) &&
+      !isSharedArrayBuffer(input)) {
+    throw new TypeError('"input" argument must be an ArrayBuffer, ' +
+                        'TypedArray or DataView');
+  }
+}
+
+exports.isAscii = function isAscii(input) {
+  checkBytesArgument(input);
+  return binding.isAscii(input);
+};
+
+exports.isUtf8 = function isUtf8(input) {
+  checkBytesArgument(input);
+  return binding.isUtf8(input);
+};
+
 // Put this at the end because internal/buffer has a circular
 // dependency on Buffer.
 exports.transcode = require('internal/buffer').transcode;
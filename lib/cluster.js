@@ -324,7 +324,8 @@ function masterInit() {
       execArgv: execArgv,
       stdio: cluster.settings.stdio,
       gid: cluster.settings.gid,
-      uid: cluster.settings.uid
+      uid: cluster.settings.uid,
+      serialization: cluster.settings.serialization
     });
   }
 
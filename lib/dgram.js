@@ -4,7 +4,9 @@ const assert = require('assert');
 const Buffer = require('buffer').Buffer;
 const util = require('util');
 const EventEmitter = require('events');
-const UV_UDP_REUSEADDR = process.binding('constants').os.UV_UDP_REUSEADDR;
+const constants = process.binding('constants').os;
+const UV_UDP_REUSEADDR = constants.UV_UDP_REUSEADDR;
+const UV_UDP_RECVMMSG = constants.UV_UDP_RECVMMSG;
 
 const UDP = process.binding('udp_wrap').UDP;
 const SendWrap = process.binding('udp_wrap').SendWrap;
@@ -13,6 +15,10 @@ const BIND_STATE_UNBOUND = 0;
 const BIND_STATE_BINDING = 1;
 const BIND_STATE_BOUND = 2;
 
+const CONNECT_STATE_DISCONNECTED = 0;
+const CONNECT_STATE_CONNECTING = 1;
+const CONNECT_STATE_CONNECTED = 2;
+
 // lazily loaded
 var cluster = null;
 var dns = null;
@@ -38,18 +44,22 @@ function lookup6(address, callback) {
 }
 
 
-function newHandle(type) {
+function newHandle(type, batchReceive) {
+  const flags = batchReceive ? UV_UDP_RECVMMSG : 0;
+
   if (type === 'udp4') {
-    const handle = new UDP();
+    const handle = new UDP(flags);
     handle.lookup = lookup4;
     return handle;
   }
 
   if (type === 'udp6') {
-    const handle = new UDP();
+    const handle = new UDP(flags);
     handle.lookup = lookup6;
     handle.bind = handle.bind6;
+    handle.connect = handle.connect6;
     handle.send = handle.send6;
+    handle.sendBatch = handle.sendBatch6;
     return handle;
   }
 
@@ -83,12 +93,14 @@ function Socket(type, listener) {
     type = options.type;
   }
 
-  var handle = newHandle(type);
+  var handle = newHandle(type, options && options.batchReceive);
   handle.owner = this;
 
   this._handle = handle;
   this._receiving = false;
   this._bindState = BIND_STATE_UNBOUND;
+  this._connectState = CONNECT_STATE_DISCONNECTED;
+  this._connectQueue = undefined;
   this.type = type;
   this.fd = null; // compatibility hack
 
@@ -123,7 +135,9 @@ function replaceHandle(self, newHandle) {
   // Set up the handle that we got from master.
   newHandle.lookup = self._handle.lookup;
   newHandle.bind = self._handle.bind;
+  newHandle.connect = self._handle.connect;
   newHandle.send = self._handle.send;
+  newHandle.sendBatch = self._handle.sendBatch;
   newHandle.owner = self;
 
   // Replace the existing handle by the handle we got from master.
@@ -230,6 +244,123 @@ Socket.prototype.bind = function(port_ /*, address, callback*/) {
 };
 
 
+Socket.prototype.connect = function(port, address, callback) {
+  port = port >>> 0;
+  if (port === 0 || port > 65535)
+    throw new RangeError('Port should be > 0 and < 65536');
+
+  if (typeof address === 'function') {
+    callback = address;
+    address = '';
+  } else if (address === undefined) {
+    address = '';
+  } else if (typeof address !== 'string') {
+    throw new TypeError('Address must be a string');
+  }
+
+  this._healthCheck();
+
+  if (this._connectState !== CONNECT_STATE_DISCONNECTED)
+    throw new Error('Socket is already connected');
+
+  this._connectState = CONNECT_STATE_CONNECTING;
+
+  if (typeof callback === 'function')
+    this.once('connect', callback);
+
+  if (this._bindState === BIND_STATE_UNBOUND)
+    this.bind({port: 0, exclusive: true}, null);
+
+  if (this._bindState !== BIND_STATE_BOUND) {
+    enqueue(this, lookupConnect.bind(null, this, port, address, callback));
+    return;
+  }
+
+  lookupConnect(this, port, address, callback);
+};
+
+
+function lookupConnect(self, port, address, callback) {
+  self._handle.lookup(address, function afterDns(ex, ip) {
+    doConnect(ex, self, ip, address, port, callback);
+  });
+}
+
+
+function doConnect(ex, self, ip, address, port, callback) {
+  if (!self._handle)
+    return;
+
+  if (!ex) {
+    const err = self._handle.connect(ip, port);
+    if (err)
+      ex = exceptionWithHostPort(err, 'connect', address, port);
+  }
+
+  if (ex) {
+    self._connectState = CONNECT_STATE_DISCONNECTED;
+    const queue = self._connectQueue;
+    self._connectQueue = undefined;
+    process.nextTick(function() {
+      if (typeof callback === 'function') {
+        self.removeListener('connect', callback);
+        callback(ex);
+      } else {
+        self.emit('error', ex);
+      }
+      if (queue)
+        failConnectQueue(queue, ex);
+    });
+    return;
+  }
+
+  self._connectState = CONNECT_STATE_CONNECTED;
+  process.nextTick(emitConnectNT, self);
+}
+
+
+function emitConnectNT(self) {
+  self.emit('connect');
+
+  const queue = self._connectQueue;
+  self._connectQueue = undefined;
+  if (queue) {
+    for (var i = 0; i < queue.length; i++)
+      self.send.apply(self, queue[i]);
+  }
+}
+
+
+// Packets that were waiting for connect() never go out if it fails, their
+// callbacks get the connect error.  Packets sent without a callback have no
+// one to tell, the error is reported through connect() already.
+function failConnectQueue(queue, ex) {
+  for (var i = 0; i < queue.length; i++) {
+    const args = queue[i];
+    for (var j = args.length - 1; j >= 0; j--) {
+      if (typeof args[j] === 'function') {
+        args[j](ex);
+        break;
+      }
+    }
+  }
+}
+
+
+Socket.prototype.disconnect = function() {
+  this._healthCheck();
+
+  if (this._connectState !== CONNECT_STATE_CONNECTED)
+    throw new Error('Socket is not connected');
+
+  var err = this._handle.disconnect();
+  if (err)
+    throw errnoException(err, 'connect');
+
+  this._connectState = CONNECT_STATE_DISCONNECTED;
+};
+
+
 // thin wrapper around `send`, here for compatibility with dgram_legacy.js
 Socket.prototype.sendto = function(buffer,
                                    offset,
@@ -306,6 +437,11 @@ function clearQueue() {
 // send(bufferOrList, port, address, callback)
 // send(bufferOrList, port, address)
 // send(bufferOrList, port)
+// and on connected sockets, without port and address
+// send(buffer, offset, length, callback)
+// send(buffer, offset, length)
+// send(bufferOrList, callback)
+// send(bufferOrList)
 Socket.prototype.send = function(buffer,
                                  offset,
                                  length,
@@ -315,7 +451,32 @@ Socket.prototype.send = function(buffer,
   const self = this;
   let list;
 
-  if (address || (port && typeof port !== 'function')) {
+  // Packets sent while connect() is still resolving the peer go out once
+  // the socket is connected.
+  if (self._connectState === CONNECT_STATE_CONNECTING) {
+    if (!self._connectQueue)
+      self._connectQueue = [];
+    self._connectQueue.push([buffer, offset, length, port, address, callback]);
+    return;
+  }
+
+  const connected = self._connectState === CONNECT_STATE_CONNECTED;
+
+  if (connected) {
+    if (typeof length === 'number') {
+      buffer = sliceBuffer(buffer, offset, length);
+      if (typeof port === 'function') {
+        callback = port;
+        port = undefined;
+      }
+    } else {
+      callback = offset;
+      offset = undefined;
+    }
+
+    if (port !== undefined || address !== undefined)
+      throw new Error('Connected sockets send only to their peer');
+  } else if (address || (port && typeof port !== 'function')) {
     buffer = sliceBuffer(buffer, offset, length);
   } else {
     callback = port;
@@ -335,9 +496,11 @@ Socket.prototype.send = function(buffer,
     throw new TypeError('Buffer list arguments must be buffers or strings');
   }
 
-  port = port >>> 0;
-  if (port === 0 || port > 65535)
-    throw new RangeError('Port should be > 0 and < 65536');
+  if (!connected) {
+    port = port >>> 0;
+    if (port === 0 || port > 65535)
+      throw new RangeError('Port should be > 0 and < 65536');
+  }
 
   // Normalize callback so it's either a function or undefined but not anything
   // else.
@@ -359,6 +522,12 @@ Socket.prototype.send = function(buffer,
     return;
   }
 
+  // The peer of a connected socket is resolved once, in connect().
+  if (connected) {
+    doSend(null, self, null, list, address, port, callback);
+    return;
+  }
+
   self._handle.lookup(address, function afterDns(ex, ip) {
     doSend(ex, self, ip, list, address, port, callback);
   });
@@ -386,12 +555,17 @@ function doSend(ex, self, ip, list, address, port, callback) {
     req.callback = callback;
     req.oncomplete = afterSend;
   }
-  var err = self._handle.send(req,
-                              list,
-                              list.length,
-                              port,
-                              ip,
-                              !!callback);
+  var err;
+  if (port === undefined) {
+    err = self._handle.send(req, list, list.length, !!callback);
+  } else {
+    err = self._handle.send(req,
+                            list,
+                            list.length,
+                            port,
+                            ip,
+                            !!callback);
+  }
   if (err && callback) {
     // don't emit as error, dgram_legacy.js compatibility
     const ex = exceptionWithHostPort(err, 'send', address, port);
@@ -409,6 +583,145 @@ function afterSend(err, sent) {
   this.callback(err, sent);
 }
 
+
+// sendBatch([{ msg, port, address }, ...][, callback])
+Socket.prototype.sendBatch = function(messages, callback) {
+  const self = this;
+
+  if (!Array.isArray(messages))
+    throw new TypeError('First argument must be an array');
+
+  if (self._connectState !== CONNECT_STATE_DISCONNECTED)
+    throw new Error('Connected sockets send only to their peer');
+
+  const list = new Array(messages.length);
+  for (var i = 0; i < messages.length; i++) {
+    const message = messages[i];
+    if (message === null || typeof message !== 'object')
+      throw new TypeError('Batch entries must be objects');
+
+    var msg = message.msg;
+    if (typeof msg === 'string')
+      msg = Buffer.from(msg);
+    else if (!(msg instanceof Buffer))
+      throw new TypeError('msg must be a buffer or a string');
+
+    const port = message.port >>> 0;
+    if (port === 0 || port > 65535)
+      throw new RangeError('Port should be > 0 and < 65536');
+
+    list[i] = { msg, port, address: message.address };
+  }
+
+  // Normalize callback so it's either a function or undefined but not anything
+  // else.
+  if (typeof callback !== 'function')
+    callback = undefined;
+
+  self._healthCheck();
+
+  if (list.length === 0) {
+    if (callback)
+      process.nextTick(callback, null, 0);
+    return;
+  }
+
+  if (self._bindState === BIND_STATE_UNBOUND)
+    self.bind({port: 0, exclusive: true}, null);
+
+  // If the socket hasn't been bound yet, push the outbound packets onto the
+  // send queue and send after binding is complete.
+  if (self._bindState !== BIND_STATE_BOUND) {
+    enqueue(self, lookupBatch.bind(null, self, list, callback));
+    return;
+  }
+
+  lookupBatch(self, list, callback);
+};
+
+
+// Resolves every distinct address of the batch once.
+function lookupBatch(self, list, callback) {
+  const ips = new Map();
+  const addresses = [];
+  var failed = false;
+
+  for (var i = 0; i < list.length; i++) {
+    if (!ips.has(list[i].address)) {
+      ips.set(list[i].address, null);
+      addresses.push(list[i].address);
+    }
+  }
+
+  var pending = addresses.length;
+  addresses.forEach(function(address) {
+    self._handle.lookup(address, function afterDns(ex, ip) {
+      if (failed)
+        return;
+      if (ex) {
+        failed = true;
+        doSendBatch(ex, self, ips, list, callback);
+        return;
+      }
+      ips.set(address, ip);
+      if (--pending === 0)
+        doSendBatch(null, self, ips, list, callback);
+    });
+  });
+}
+
+
+function doSendBatch(ex, self, ips, list, callback) {
+  if (ex) {
+    if (typeof callback === 'function') {
+      callback(ex);
+      return;
+    }
+
+    self.emit('error', ex);
+    return;
+  } else if (!self._handle) {
+    return;
+  }
+
+  const count = list.length;
+  const buffers = new Array(count);
+  const ports = new Array(count);
+  const addresses = new Array(count);
+  for (var i = 0; i < count; i++) {
+    buffers[i] = list[i].msg;
+    ports[i] = list[i].port;
+    addresses[i] = ips.get(list[i].address);
+  }
+
+  var req = new SendWrap();
+  req.buffers = buffers;  // Keep reference alive.
+  if (callback) {
+    req.callback = callback;
+    req.oncomplete = afterSendBatch;
+  }
+  var err = self._handle.sendBatch(req,
+                                   buffers,
+                                   ports,
+                                   addresses,
+                                   count,
+                                   !!callback);
+  if (err && callback) {
+    // Like send(), don't emit as error.
+    process.nextTick(callback, errnoException(err, 'sendBatch'));
+  }
+}
+
+function afterSendBatch(err, sent) {
+  if (err) {
+    err = errnoException(err, 'sendBatch');
+  } else {
+    err = null;
+  }
+
+  this.callback(err, sent);
+}
+
 Socket.prototype.close = function(callback) {
   if (typeof callback === 'function')
     this.on('close', callback);
@@ -446,6 +759,22 @@ Socket.prototype.address = function() {
 };
 
 
+Socket.prototype.remoteAddress = function() {
+  this._healthCheck();
+
+  if (this._connectState !== CONNECT_STATE_CONNECTED)
+    throw new Error('Socket is not connected');
+
+  var out = {};
+  var err = this._handle.getpeername(out);
+  if (err) {
+    throw errnoException(err, 'getpeername');
+  }
+
+  return out;
+};
+
+
 Socket.prototype.setBroadcast = function(arg) {
   var err = this._handle.setBroadcast(arg ? 1 : 0);
   if (err) {
@@ -543,6 +872,14 @@ function onMessage(nread, handle, buf, rinfo) {
   if (nread < 0) {
     return self.emit('error', errnoException(nread, 'recvmsg'));
   }
+  if (Array.isArray(buf)) {
+    // A batch of datagrams read by a single recvmmsg() call.
+    for (var i = 0; i < nread && self._handle === handle; i++) {
+      rinfo[i].size = buf[i].length; // compatibility
+      self.emit('message', buf[i], rinfo[i]);
+    }
+    return;
+  }
   rinfo.size = buf.length; // compatibility
   self.emit('message', buf, rinfo);
 }
@@ -29,7 +29,6 @@ const Readable = Stream.Readable;
 const Writable = Stream.Writable;
 
 const kMinPoolSpace = 128;
-const kMaxLength = require('buffer').kMaxLength;
 
 const isWindows = process.platform === 'win32';
 
@@ -195,6 +194,113 @@ fs.Stats.prototype.isSocket = function() {
   return this._checkModeProperty(constants.S_IFSOCK);
 };
 
+const kType = Symbol('type');
+
+// Directory entries returned by readdir() with the withFileTypes option.
+fs.Dirent = function(name, type) {
+  this.name = name;
+  this[kType] = type;
+};
+
+fs.Dirent.prototype.isDirectory = function() {
+  return this[kType] === constants.UV_DIRENT_DIR;
+};
+
+fs.Dirent.prototype.isFile = function() {
+  return this[kType] === constants.UV_DIRENT_FILE;
+};
+
+fs.Dirent.prototype.isBlockDevice = function() {
+  return this[kType] === constants.UV_DIRENT_BLOCK;
+};
+
+fs.Dirent.prototype.isCharacterDevice = function() {
+  return this[kType] === constants.UV_DIRENT_CHAR;
+};
+
+fs.Dirent.prototype.isSymbolicLink = function() {
+  return this[kType] === constants.UV_DIRENT_LINK;
+};
+
+fs.Dirent.prototype.isFIFO = function() {
+  return this[kType] === constants.UV_DIRENT_FIFO;
+};
+
+fs.Dirent.prototype.isSocket = function() {
+  return this[kType] === constants.UV_DIRENT_SOCKET;
+};
+
+function direntTypeFromStats(stats) {
+  if (stats.isFile()) return constants.UV_DIRENT_FILE;
+  if (stats.isDirectory()) return constants.UV_DIRENT_DIR;
+  if (stats.isSymbolicLink()) return constants.UV_DIRENT_LINK;
+  if (stats.isFIFO()) return constants.UV_DIRENT_FIFO;
+  if (stats.isSocket()) return constants.UV_DIRENT_SOCKET;
+  if (stats.isCharacterDevice()) return constants.UV_DIRENT_CHAR;
+  if (stats.isBlockDevice()) return constants.UV_DIRENT_BLOCK;
+  return constants.UV_DIRENT_UNKNOWN;
+}
+
+function direntPath(path, name) {
+  if (typeof path === 'string' && typeof name === 'string')
+    return pathModule.join(path, name);
+  return Buffer.concat([Buffer.from(path),
+                        Buffer.from(pathModule.sep),
+                        Buffer.from(name)]);
+}
+
+// Turns the [names, types] pair from binding.readdir() into Dirents. Some
+// file systems don't report entry types, those entries are lstat'ed.
+function getDirents(path, result, callback) {
+  const names = result[0];
+  const types = result[1];
+  const dirents = new Array(names.length);
+  var pending = 1;
+  var failed = false;
+
+  function done(err) {
+    if (failed)
+      return;
+    if (err) {
+      failed = true;
+      return callback(err);
+    }
+    if (--pending === 0)
+      callback(null, dirents);
+  }
+
+  for (var i = 0; i < names.length; i++) {
+    if (types[i] !== constants.UV_DIRENT_UNKNOWN) {
+      dirents[i] = new fs.Dirent(names[i], types[i]);
+      continue;
+    }
+    pending++;
+    lstatDirent(i);
+  }
+  done(null);
+
+  function lstatDirent(i) {
+    fs.lstat(direntPath(path, names[i]), function(err, stats) {
+      if (!err)
+        dirents[i] = new fs.Dirent(names[i], direntTypeFromStats(stats));
+      done(err);
+    });
+  }
+}
+
+function getDirentsSync(path, result) {
+  const names = result[0];
+  const types = result[1];
+  const dirents = new Array(names.length);
+  for (var i = 0; i < names.length; i++) {
+    var type = types[i];
+    if (type === constants.UV_DIRENT_UNKNOWN)
+      type = direntTypeFromStats(fs.lstatSync(direntPath(path, names[i])));
+    dirents[i] = new fs.Dirent(names[i], type);
+  }
+  return dirents;
+}
+
 // Don't allow mode to accidentally be overwritten.
 ['F_OK', 'R_OK', 'W_OK', 'X_OK'].forEach(function(key) {
   Object.defineProperty(fs, key, {
@@ -257,171 +363,17 @@ fs.readFile = function(path, options, callback) {
   if (!nullCheck(path, callback))
     return;
 
-  var context = new ReadFileContext(callback, options.encoding);
-  context.isUserFd = isFd(path); // file descriptor ownership
-  var req = new FSReqWrap();
-  req.context = context;
-  req.oncomplete = readFileAfterOpen;
-
-  if (context.isUserFd) {
-    process.nextTick(function() {
-      req.oncomplete(null, path);
-    });
-    return;
-  }
-
-  binding.open(pathModule._makeLong(path),
-               stringToFlags(options.flag || 'r'),
-               0o666,
-               req);
-};
-
-const kReadFileBufferLength = 8 * 1024;
-
-function ReadFileContext(callback, encoding) {
-  this.fd = undefined;
-  this.isUserFd = undefined;
-  this.size = undefined;
-  this.callback = callback;
-  this.buffers = null;
-  this.buffer = null;
-  this.pos = 0;
-  this.encoding = encoding;
-  this.err = null;
-}
-
-ReadFileContext.prototype.read = function() {
-  var buffer;
-  var offset;
-  var length;
-
-  if (this.size === 0) {
-    buffer = this.buffer = Buffer.allocUnsafeSlow(kReadFileBufferLength);
-    offset = 0;
-    length = kReadFileBufferLength;
-  } else {
-    buffer = this.buffer;
-    offset = this.pos;
-    length = this.size - this.pos;
-  }
-
+  // Opening, reading and closing the file all happen in a single threadpool
+  // job, a file descriptor passed in by the user is left open.
   var req = new FSReqWrap();
-  req.oncomplete = readFileAfterRead;
-  req.context = this;
-
-  binding.read(this.fd, buffer, offset, length, -1, req);
-};
-
-ReadFileContext.prototype.close = function(err) {
-  var req = new FSReqWrap();
-  req.oncomplete = readFileAfterClose;
-  req.context = this;
-  this.err = err;
-
-  if (this.isUserFd) {
-    process.nextTick(function() {
-      req.oncomplete(null);
-    });
-    return;
-  }
+  req.oncomplete = callback;
 
-  binding.close(this.fd, req);
+  binding.readFile(isFd(path) ? path : pathModule._makeLong(path),
+                   stringToFlags(options.flag || 'r'),
+                   options.encoding,
+                   req);
 };
 
-function readFileAfterOpen(err, fd) {
-  var context = this.context;
-
-  if (err) {
-    context.callback(err);
-    return;
-  }
-
-  context.fd = fd;
-
-  var req = new FSReqWrap();
-  req.oncomplete = readFileAfterStat;
-  req.context = context;
-  binding.fstat(fd, req);
-}
-
-function readFileAfterStat(err, st) {
-  var context = this.context;
-
-  if (err)
-    return context.close(err);
-
-  var size = context.size = st.isFile() ? st.size : 0;
-
-  if (size === 0) {
-    context.buffers = [];
-    context.read();
-    return;
-  }
-
-  if (size > kMaxLength) {
-    err = new RangeError('File size is greater than possible Buffer: ' +
-                         `0x${kMaxLength.toString(16)} bytes`);
-    return context.close(err);
-  }
-
-  context.buffer = Buffer.allocUnsafeSlow(size);
-  context.read();
-}
-
-function readFileAfterRead(err, bytesRead) {
-  var context = this.context;
-
-  if (err)
-    return context.close(err);
-
-  if (bytesRead === 0)
-    return context.close();
-
-  context.pos += bytesRead;
-
-  if (context.size !== 0) {
-    if (context.pos === context.size)
-      context.close();
-    else
-      context.read();
-  } else {
-    // unknown size, just read until we don't get bytes.
-    context.buffers.push(context.buffer.slice(0, bytesRead));
-    context.read();
-  }
-}
-
-function readFileAfterClose(err) {
-  var context = this.context;
-  var buffer = null;
-  var callback = context.callback;
-
-  if (context.err || err)
-    return callback(context.err || err);
-
-  if (context.size === 0)
-    buffer = Buffer.concat(context.buffers, context.pos);
-  else if (context.pos < context.size)
-    buffer = context.buffer.slice(0, context.pos);
-  else
-    buffer = context.buffer;
-
-  if (context.encoding) {
-    return tryToString(buffer, context.encoding, callback);
-  }
-
-  callback(null, buffer);
-}
-
-function tryToString(buf, encoding, callback) {
-  try {
-    buf = buf.toString(encoding);
-  } catch (err) {
-    return callback(err);
-  }
-  callback(null, buf);
-}
-
 function tryStatSync(fd, isUserFd) {
   var threw = true;
   var st;
@@ -857,14 +809,25 @@ fs.readdir = function(path, options, callback) {
   options = getOptions(options, {});
   if (!nullCheck(path, callback)) return;
   var req = new FSReqWrap();
-  req.oncomplete = callback;
-  binding.readdir(pathModule._makeLong(path), options.encoding, req);
+  if (options.withFileTypes) {
+    req.oncomplete = function(err, result) {
+      if (err)
+        return callback(err);
+      getDirents(path, result, callback);
+    };
+  } else {
+    req.oncomplete = callback;
+  }
+  binding.readdir(pathModule._makeLong(path), options.encoding,
+                  !!options.withFileTypes, req);
 };
 
 fs.readdirSync = function(path, options) {
   options = getOptions(options, {});
   nullCheck(path);
-  return binding.readdir(pathModule._makeLong(path), options.encoding);
+  var result = binding.readdir(pathModule._makeLong(path), options.encoding,
+                               !!options.withFileTypes);
+  return options.withFileTypes ? getDirentsSync(path, result) : result;
 };
 
 fs.fstat = function(fd, callback) {
@@ -2015,6 +1978,236 @@ WriteStream.prototype.close = ReadStream.prototype.close;
 // There is no shutdown() for files.
 WriteStream.prototype.destroySoon = WriteStream.prototype.end;
 
+fs.walk = function(root, options) {
+  return new WalkStream(root, options);
+};
+
+// Entries emitted by fs.walk().
+function WalkEntry(path, name, type, depth, size, mtimeMs) {
+  fs.Dirent.call(this, name, type);
+  this.path = path;
+  this.depth = depth;
+  this.size = size;
+  this.mtime = new Date(mtimeMs);
+}
+util.inherits(WalkEntry, fs.Dirent);
+fs.WalkEntry = WalkEntry;
+
+// Directories handed to a single threadpool job.
+const kWalkDirsPerJob = 64;
+
+util.inherits(WalkStream, Readable);
+fs.WalkStream = WalkStream;
+
+function WalkStream(root, options) {
+  if (!(this instanceof WalkStream))
+    return new WalkStream(root, options);
+
+  options = copyObject(getOptions(options, {}));
+  const encoding = options.encoding || 'utf8';
+  // The names are encoded by the walk, not by the Readable.
+  delete options.encoding;
+  options.objectMode = true;
+
+  Readable.call(this, options);
+
+  if (typeof root !== 'string' && !(root instanceof Buffer))
+    throw new TypeError('"root" argument must be a string or Buffer');
+  nullCheck(root);
+  if (options.filter !== undefined && typeof options.filter !== 'function')
+    throw new TypeError('"filter" option must be a function');
+  if (options.onError !== undefined && typeof options.onError !== 'function')
+    throw new TypeError('"onError" option must be a function');
+  if (options.maxDepth !== undefined &&
+      (typeof options.maxDepth !== 'number' || !(options.maxDepth >= 0)))
+    throw new TypeError('"maxDepth" option must be a non-negative number');
+
+  this.root = root;
+  this.encoding = encoding;
+  this.filter = options.filter;
+  this.onError = options.onError;
+  this.maxDepth = options.maxDepth === undefined ? Infinity : options.maxDepth;
+  this.followSymlinks = !!options.followSymlinks;
+  this.destroyed = false;
+
+  // Directories left to scan, as they are handed to the threadpool and as
+  // they are handed out in entry.path, and their depth.  The root is at
+  // depth 0.
+  var path = root;
+  if (encoding === 'buffer')
+    path = walkBuffer(root);
+  else if (typeof root !== 'string')
+    path = root.toString();
+  this._dirs = this.maxDepth >= 1 ? [root] : [];
+  this._paths = this.maxDepth >= 1 ? [path] : [];
+  this._depths = this.maxDepth >= 1 ? [0] : [];
+  // Directories already queued, by device and inode, when following links.
+  this._seen = this.followSymlinks ? new Set() : null;
+  this._scanning = false;
+}
+
+WalkStream.prototype._read = function() {
+  if (this._scanning || this.destroyed)
+    return;
+
+  if (this._dirs.length === 0)
+    return this.push(null);
+
+  this._scanning = true;
+
+  // Links back to the root must not walk it a second time.
+  if (this._seen !== null && this._seen.size === 0) {
+    fs.stat(this.root, (err, stats) => {
+      if (err)
+        return this._walkError(err);
+      this._seen.add(stats.dev + ':' + stats.ino);
+      this._scan();
+    });
+    return;
+  }
+
+  this._scan();
+};
+
+WalkStream.prototype._scan = function() {
+  var req = new FSReqWrap();
+  req.oncomplete = walkAfterScan;
+  req.stream = this;
+  binding.walk(this._dirs.slice(0, kWalkDirsPerJob).map(pathModule._makeLong),
+               this.followSymlinks,
+               this.encoding,
+               req);
+};
+
+WalkStream.prototype._walkError = function(err) {
+  this.destroy();
+  this.emit('error', err);
+};
+
+WalkStream.prototype.destroy = function() {
+  if (this.destroyed)
+    return;
+  this.destroyed = true;
+  this._dirs = [];
+  this._paths = [];
+  this._depths = [];
+  process.nextTick(() => this.emit('close'));
+};
+
+function walkAfterScan(err, result) {
+  var stream = this.stream;
+  stream._scanning = false;
+
+  if (stream.destroyed)
+    return;
+  if (err)
+    return stream._walkError(err);
+
+  const consumed = result[0];
+  const names = result[1];
+  const parents = result[2];
+  const types = result[3];
+  const stats = result[4];
+  const raw = result[5];
+  const errors = result[6];
+  const dirs = stream._dirs.splice(0, consumed).map(walkPrefix);
+  const prefixes = stream._paths.splice(0, consumed).map(walkPrefix);
+  const depths = stream._depths.splice(0, consumed);
+  var pushed = false;
+  var i;
+
+  for (i = 0; i < errors.length; i += 2) {
+    if (depths[errors[i]] === 0)
+      return stream._walkError(errors[i + 1]);
+    // Removed or replaced since it was queued.
+    const code = errors[i + 1].code;
+    if (code === 'ENOENT' || code === 'ENOTDIR')
+      continue;
+    if (stream.onError !== undefined) {
+      try {
+        stream.onError(errors[i + 1]);
+      } catch (er) {
+        return stream._walkError(er);
+      }
+    }
+  }
+
+  // The exact bytes of the directory names that can't be told from the
+  // names as they are handed out.
+  var rawNames = null;
+  if (raw.length > 0) {
+    rawNames = new Map();
+    for (i = 0; i < raw.length; i += 2)
+      rawNames.set(raw[i], raw[i + 1]);
+  }
+
+  for (i = 0; i < names.length; i++) {
+    const parent = parents[i];
+    const depth = depths[parent] + 1;
+    const entry = new WalkEntry(walkJoin(prefixes[parent], names[i]),
+                                names[i],
+                                types[i],
+                                depth,
+                                stats[4 * i],
+                                stats[4 * i + 1]);
+
+    if (stream.filter !== undefined) {
+      var keep;
+      try {
+        keep = stream.filter(entry);
+      } catch (er) {
+        return stream._walkError(er);
+      }
+      if (!keep)
+        continue;
+    }
+
+    if (depth < stream.maxDepth && entry.isDirectory() &&
+        !walkSeen(stream, stats[4 * i + 2], stats[4 * i + 3])) {
+      const name = rawNames !== null && rawNames.get(i) || names[i];
+      stream._dirs.push(walkJoin(dirs[parent], name));
+      stream._paths.push(entry.path);
+      stream._depths.push(depth);
+    }
+
+    stream.push(entry);
+    pushed = true;
+  }
+
+  // Nothing was pushed, so nothing will ask for more.
+  if (!pushed)
+    stream._read();
+}
+
+function walkBuffer(path) {
+  return typeof path === 'string' ? Buffer.from(path) : path;
+}
+
+function walkPrefix(dir) {
+  if (typeof dir === 'string')
+    return dir.endsWith(pathModule.sep) ? dir : dir + pathModule.sep;
+  if (dir.length > 0 && dir[dir.length - 1] === pathModule.sep.charCodeAt(0))
+    return dir;
+  return Buffer.concat([dir, Buffer.from(pathModule.sep)]);
+}
+
+// Paths stay strings unless a part of them is a Buffer.
+function walkJoin(prefix, name) {
+  if (typeof prefix === 'string' && typeof name === 'string')
+    return prefix + name;
+  return Buffer.concat([walkBuffer(prefix), walkBuffer(name)]);
+}
+
+function walkSeen(stream, dev, ino) {
+  if (stream._seen === null)
+    return false;
+  const key = dev + ':' + ino;
+  if (stream._seen.has(key))
+    return true;
+  stream._seen.add(key);
+  return false;
+}
+
 // SyncWriteStream is internal. DO NOT USE.
 // todo(jasnell): "Docs-only" deprecation for now. This was never documented
 // so there's no documentation to modify. In the future, add a runtime
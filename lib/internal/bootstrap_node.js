@@ -9,6 +9,11 @@
 
 (function(process) {
 
+  // Set by node::LoadEnvironment() when node was built with a startup
+  // snapshot that contains the compiled core module wrappers.
+  const precompiledNatives = process._precompiledNatives;
+  delete process._precompiledNatives;
+
   function startup() {
     const EventEmitter = NativeModule.require('events');
     process._eventsCount = 0;
@@ -46,8 +51,10 @@
     _process.setupSignalHandlers();
 
     // Do not initialize channel in debugger agent, it deletes env variable
-    // and the main thread won't see it.
-    if (process.argv[1] !== '--debug-agent')
+    // and the main thread won't see it.  The same goes for workers, the
+    // channel belongs to the main thread.
+    if (process.argv[1] !== '--debug-agent' &&
+        process.binding('worker').isMainThread)
       _process.setupChannel();
 
     _process.setupRawDebug();
@@ -64,7 +71,12 @@
     // others like the debugger or running --eval arguments. Here we decide
     // which mode we run in.
 
-    if (NativeModule.exists('_third_party_main')) {
+    if (!process.binding('worker').isMainThread) {
+      // This is a worker thread started by the worker_threads module, it
+      // runs the script or the code that was passed to the Worker.
+      NativeModule.require('internal/worker').setupChild(evalScript);
+
+    } else if (NativeModule.exists('_third_party_main')) {
       // To allow people to extend Node in different ways, this hook allows
       // one to drop a file lib/_third_party_main.js into the build
       // directory which will be executed instead of Node's normal loading.
@@ -426,9 +438,19 @@
   // node binary, so they can be loaded faster.
 
   const ContextifyScript = process.binding('contextify').ContextifyScript;
-  function runInThisContext(code, options) {
-    const script = new ContextifyScript(code, options);
-    return script.runInThisContext();
+
+  // Set by --trace-native-module-load.
+  const traceNativeModuleLoad =
+      process.binding('config').traceNativeModuleLoad === true;
+
+  // The native process.hrtime(), internal/process replaces it with the public
+  // version only after the first core modules have been loaded.
+  const rawHrtime = process.hrtime;
+  const hrValues = new Uint32Array(3);
+  function hrtimeMs() {
+    rawHrtime(hrValues);
+    return (hrValues[0] * 0x100000000 + hrValues[1]) * 1e3 +
+           hrValues[2] / 1e6;
   }
 
   function NativeModule(id) {
@@ -440,6 +462,8 @@
   }
 
   NativeModule._source = process.binding('natives');
+  // Finds nothing unless node was configured with --with-code-cache.
+  NativeModule._getCodeCache = process.binding('code_cache').getCodeCache;
   NativeModule._cache = {};
 
   NativeModule.require = function(id) {
@@ -509,17 +533,39 @@
   ];
 
   NativeModule.prototype.compile = function() {
-    var source = NativeModule.getSource(this.id);
-    source = NativeModule.wrap(source);
-
     this.loading = true;
 
     try {
-      const fn = runInThisContext(source, {
-        filename: this.filename,
-        lineOffset: 0,
-        displayErrors: true
-      });
+      const start = traceNativeModuleLoad ? hrtimeMs() : undefined;
+      var from = 'snapshot';
+      var fn;
+      if (precompiledNatives !== undefined)
+        fn = precompiledNatives[this.id];
+
+      if (fn === undefined) {
+        var source = NativeModule.getSource(this.id);
+        source = NativeModule.wrap(source);
+        const cachedData = NativeModule._getCodeCache(this.id);
+        const script = new ContextifyScript(source, {
+          filename: this.filename,
+          lineOffset: 0,
+          displayErrors: true,
+          cachedData
+        });
+        if (cachedData === undefined)
+          from = 'source';
+        else if (script.cachedDataRejected)
+          from = 'source, code cache rejected';
+        else
+          from = 'code cache';
+        fn = script.runInThisContext();
+      }
+
+      if (start !== undefined) {
+        const ms = (hrtimeMs() - start).toFixed(3);
+        process._rawDebug(`native module ${this.id}: ${from}, ${ms} ms`);
+      }
+
       fn(this.exports, NativeModule.require, this, this.filename);
 
       this.loaded = true;
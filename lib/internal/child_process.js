@@ -1,6 +1,5 @@
 'use strict';
 
-const StringDecoder = require('string_decoder').StringDecoder;
 const Buffer = require('buffer').Buffer;
 const EventEmitter = require('events');
 const net = require('net');
@@ -17,6 +16,7 @@ const TTY = process.binding('tty_wrap').TTY;
 const TCP = process.binding('tcp_wrap').TCP;
 const UDP = process.binding('udp_wrap').UDP;
 const SocketList = require('internal/socket_list');
+const serializationModes = require('internal/child_process/serialization');
 
 const errnoException = util._errnoException;
 const SocketListSend = SocketList.SocketListSend;
@@ -277,10 +277,15 @@ ChildProcess.prototype.spawn = function(options) {
   ipcFd = stdio.ipcFd;
   stdio = options.stdio = stdio.stdio;
 
+  const serialization = options.serialization || 'json';
+  if (serialization !== 'json' && serialization !== 'advanced')
+    throw new TypeError('"serialization" must be "json" or "advanced"');
+
   if (ipc !== undefined) {
     // Let child process know about opened IPC channel
     options.envPairs = options.envPairs || [];
     options.envPairs.push('NODE_CHANNEL_FD=' + ipcFd);
+    options.envPairs.push('NODE_CHANNEL_SERIALIZATION_MODE=' + serialization);
   }
 
   this.spawnfile = options.file;
@@ -349,7 +354,7 @@ ChildProcess.prototype.spawn = function(options) {
   });
 
   // Add .send() method and start listening for IPC data
-  if (ipc !== undefined) setupChannel(this, ipc);
+  if (ipc !== undefined) setupChannel(this, ipc, serialization);
 
   return err;
 };
@@ -408,7 +413,7 @@ ChildProcess.prototype.unref = function() {
 };
 
 
-function setupChannel(target, channel) {
+function setupChannel(target, channel, serializationMode) {
   target.channel = channel;
 
   // _channel can be deprecated in version 8
@@ -440,20 +445,20 @@ function setupChannel(target, channel) {
     }
   }();
 
-  var decoder = new StringDecoder('utf8');
-  var jsonBuffer = '';
+  serializationMode = serializationMode || 'json';
+  if (!Object.prototype.hasOwnProperty.call(serializationModes,
+                                            serializationMode))
+    throw new TypeError(`Unknown serialization mode "${serializationMode}"`);
+  const serialization = serializationModes[serializationMode];
+  serialization.init(channel);
   channel.buffering = false;
   channel.onread = function(nread, pool, recvHandle) {
     // TODO(bnoordhuis) Check that nread > 0.
     if (pool) {
-      jsonBuffer += decoder.write(pool);
-
-      var i, start = 0;
+      const messages = serialization.parse(this, pool);
 
-      //Linebreak is used as a message end sign
-      while ((i = jsonBuffer.indexOf('\n', start)) >= 0) {
-        var json = jsonBuffer.slice(start, i);
-        var message = JSON.parse(json);
+      for (var i = 0; i < messages.length; i++) {
+        const message = messages[i];
 
         // There will be at most one NODE_HANDLE message in every chunk we
         // read because SCM_RIGHTS messages don't get coalesced. Make sure
@@ -462,11 +467,7 @@ function setupChannel(target, channel) {
           handleMessage(target, message, recvHandle);
         else
           handleMessage(target, message, undefined);
-
-        start = i + 1;
       }
-      jsonBuffer = jsonBuffer.slice(start);
-      this.buffering = jsonBuffer.length !== 0;
 
     } else {
       this.buffering = false;
@@ -631,8 +632,7 @@ function setupChannel(target, channel) {
     var req = new WriteWrap();
     req.async = false;
 
-    var string = JSON.stringify(message) + '\n';
-    var err = channel.writeUtf8String(req, string, handle);
+    var err = serialization.write(channel, req, message, handle);
 
     if (err === 0) {
       if (handle) {
@@ -0,0 +1,94 @@
+'use strict';
+
+const StringDecoder = require('string_decoder').StringDecoder;
+const Buffer = require('buffer').Buffer;
+const v8binding = process.binding('v8');
+
+// The wire formats of the IPC channel. Both sides of a channel must use the
+// same one, the parent passes it on to the child in the environment.
+//
+// Each format has the same three methods:
+// - init(channel) sets up the read state on the channel.
+// - parse(channel, pool) takes the data of a read and returns the messages
+//   that are complete now.
+// - write(channel, req, message, handle) writes a message, returns the
+//   error code of the write.
+
+// Line delimited JSON. Readable by anything that speaks JSON, but Buffers,
+// Maps, Dates and typed arrays do not survive the trip.
+const json = {
+  init(channel) {
+    channel.jsonBuffer = '';
+    channel.decoder = new StringDecoder('utf8');
+  },
+
+  parse(channel, pool) {
+    const messages = [];
+    channel.jsonBuffer += channel.decoder.write(pool);
+
+    var i, start = 0;
+
+    //Linebreak is used as a message end sign
+    while ((i = channel.jsonBuffer.indexOf('\n', start)) >= 0) {
+      messages.push(JSON.parse(channel.jsonBuffer.slice(start, i)));
+      start = i + 1;
+    }
+    channel.jsonBuffer = channel.jsonBuffer.slice(start);
+    channel.buffering = channel.jsonBuffer.length !== 0;
+    return messages;
+  },
+
+  write(channel, req, message, handle) {
+    const string = JSON.stringify(message) + '\n';
+    return channel.writeUtf8String(req, string, handle);
+  }
+};
+
+// Every message is a 4 byte big endian length followed by the structured
+// clone of the message, see src/node_serdes.h.
+const kHeaderSize = 4;
+
+const advanced = {
+  init(channel) {
+    channel.pendingChunks = [];
+    channel.pendingLength = 0;
+  },
+
+  parse(channel, pool) {
+    const messages = [];
+    var chunks = channel.pendingChunks;
+    var length = channel.pendingLength + pool.length;
+    chunks.push(pool);
+
+    while (length >= kHeaderSize) {
+      if (chunks[0].length < kHeaderSize)
+        chunks = [Buffer.concat(chunks, length)];
+
+      // Large messages span many reads, only join them once they are
+      // complete.
+      const end = kHeaderSize + chunks[0].readUInt32BE(0);
+      if (length < end)
+        break;
+
+      const data = chunks.length === 1 ? chunks[0] :
+                                         Buffer.concat(chunks, length);
+      messages.push(v8binding.deserialize(data.slice(kHeaderSize, end)));
+
+      chunks = length > end ? [data.slice(end)] : [];
+      length -= end;
+    }
+
+    channel.pendingChunks = chunks;
+    channel.pendingLength = length;
+    channel.buffering = length !== 0;
+    return messages;
+  },
+
+  write(channel, req, message, handle) {
+    const buffer = v8binding.serialize(message, kHeaderSize);
+    buffer.writeUInt32BE(buffer.length - kHeaderSize, 0);
+    return channel.writeBuffer(req, buffer, handle);
+  }
+};
+
+module.exports = { json, advanced };
@@ -0,0 +1,92 @@
+'use strict';
+
+// On-disk cache of V8 code caches for CommonJS modules. It is enabled by
+// pointing NODE_COMPILE_CACHE at a writable directory.
+//
+// An entry is keyed by the module's path, by a hash of its wrapped source and
+// by the V8 version. V8 additionally rejects caches that were produced for a
+// different source or with different flags, in which case the entry is
+// refreshed.
+
+const Buffer = require('buffer').Buffer;
+const fs = require('fs');
+const path = require('path');
+const threadId = process.binding('worker').threadId;
+
+exports.directory = init(process.env.NODE_COMPILE_CACHE);
+exports.entry = entry;
+exports.read = read;
+exports.write = write;
+
+function init(directory) {
+  if (!directory)
+    return null;
+
+  directory = path.resolve(directory);
+  try {
+    fs.mkdirSync(directory);
+  } catch (e) {
+    if (e.code !== 'EEXIST')
+      return null;
+  }
+  return directory;
+}
+
+// 32 bit FNV-1a. Used for the entry file names, where collisions only cause
+// cache misses because the entry header contains the full path, and for the
+// sources, where V8's own source check backs it up.
+function hash(str) {
+  var h = 0x811c9dc5;
+  for (var i = 0; i < str.length; i++) {
+    h ^= str.charCodeAt(i);
+    h = Math.imul(h, 0x01000193);
+  }
+  return (h >>> 0).toString(16);
+}
+
+// Returns the cache entry for the wrapped `source` of `filename`.
+function entry(filename, source) {
+  const header = JSON.stringify({
+    v8: process.versions.v8,
+    filename: filename,
+    length: source.length,
+    hash: hash(source)
+  });
+
+  return {
+    file: path.join(exports.directory, hash(filename) + '.cache'),
+    header: Buffer.from(header + '\n')
+  };
+}
+
+// Returns the cached data of the entry or undefined if there is no entry or
+// it is stale.
+function read(entry) {
+  var buf;
+  try {
+    buf = fs.readFileSync(entry.file);
+  } catch (e) {
+    return undefined;
+  }
+
+  const header = entry.header;
+  if (buf.length <= header.length ||
+      header.compare(buf, 0, header.length) !== 0) {
+    return undefined;
+  }
+  return buf.slice(header.length);
+}
+
+// Writes to a temporary file first, other processes and threads may be
+// reading or writing the entry concurrently.
+function write(entry, data) {
+  const tmp = `${entry.file}.${process.pid}.${threadId}`;
+  try {
+    fs.writeFileSync(tmp, Buffer.concat([entry.header, data]));
+    fs.renameSync(tmp, entry.file);
+  } catch (e) {
+    try {
+      fs.unlinkSync(tmp);
+    } catch (e) {}
+  }
+}
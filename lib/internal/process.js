@@ -188,10 +188,18 @@ function setupSignalHandlers() {
            lazyConstants().hasOwnProperty(event);
   }
 
+  const isMainThread = process.binding('worker').isMainThread;
+
   // Detect presence of a listener for the special signal types
   process.on('newListener', function(type, listener) {
     if (isSignal(type) &&
         !signalWraps.hasOwnProperty(type)) {
+      if (!isMainThread) {
+        const unsupportedOperation =
+            require('internal/worker').unsupportedOperation;
+        throw unsupportedOperation(`Listening for ${type}`);
+      }
+
       const Signal = process.binding('signal_wrap').Signal;
       const wrap = new Signal();
 
@@ -227,8 +235,18 @@ function setupChannel() {
     const fd = parseInt(process.env.NODE_CHANNEL_FD, 10);
     assert(fd >= 0);
 
+    // The parent may not be node, or a node that knows modes we don't.
+    var serializationMode =
+        process.env.NODE_CHANNEL_SERIALIZATION_MODE || 'json';
+    if (serializationMode !== 'json' && serializationMode !== 'advanced') {
+      process.emitWarning('Unknown NODE_CHANNEL_SERIALIZATION_MODE ' +
+                          `"${serializationMode}", using "json" instead`);
+      serializationMode = 'json';
+    }
+
     // Make sure it's not accidentally inherited by child processes.
     delete process.env.NODE_CHANNEL_FD;
+    delete process.env.NODE_CHANNEL_SERIALIZATION_MODE;
 
     const cp = require('child_process');
 
@@ -237,7 +255,7 @@ function setupChannel() {
     // FIXME is this really necessary?
     process.binding('tcp_wrap');
 
-    cp._forkChild(fd);
+    cp._forkChild(fd, serializationMode);
     assert(process.send);
   }
 }
@@ -2,6 +2,8 @@
 
 exports.setup = setupStdio;
 
+const isMainThread = process.binding('worker').isMainThread;
+
 function setupStdio() {
   var stdin, stdout, stderr;
 
@@ -34,6 +36,12 @@ function setupStdio() {
   function getStdin() {
     if (stdin) return stdin;
 
+    if (!isMainThread) {
+      const unsupportedOperation =
+          require('internal/worker').unsupportedOperation;
+      throw unsupportedOperation('process.stdin');
+    }
+
     const tty_wrap = process.binding('tty_wrap');
     const fd = 0;
 
@@ -137,7 +145,11 @@ function createWritableStdioStream(fd) {
 
   // Note stream._type is used for test-module-load-list.js
 
-  switch (tty_wrap.guessHandleType(fd)) {
+  // Workers write to the fds synchronously, a handle of their own would
+  // change the mode of the file description under the main thread.
+  const type = isMainThread ? tty_wrap.guessHandleType(fd) : 'FILE';
+
+  switch (type) {
     case 'TTY':
       const tty = require('tty');
       stream = new tty.WriteStream(fd);
@@ -0,0 +1,88 @@
+'use strict';
+
+// Persistent cache of module resolutions, enabled by pointing
+// NODE_RESOLUTION_CACHE at a file. Module._findPath() results are written to
+// that file when the process exits and loaded again on the next start, so
+// that repeated runs of the same application resolve each require() with a
+// single stat() of the cached file instead of walking the search paths.
+//
+// An entry is dropped when the file it points at no longer exists. The cache
+// does not notice files that would shadow a cached resolution, e.g. a newly
+// installed dependency higher up the node_modules hierarchy, so it should be
+// removed when dependencies change.
+//
+// Workers read the cache but leave saving it to the main thread.
+
+const fs = require('fs');
+const path = require('path');
+const worker = process.binding('worker');
+
+const file = process.env.NODE_RESOLUTION_CACHE ?
+  path.resolve(process.env.NODE_RESOLUTION_CACHE) : null;
+// Resolutions depend on the node version and on --preserve-symlinks.
+const preserveSymlinks = !!process.binding('config').preserveSymlinks;
+const tag = `${process.version}:${preserveSymlinks}`;
+
+var entries = null;
+var dirty = false;
+
+exports.enabled = file !== null;
+exports.get = get;
+exports.set = set;
+exports.delete = remove;
+
+if (file !== null) {
+  entries = load();
+  if (worker.isMainThread)
+    process.on('exit', save);
+}
+
+function load() {
+  try {
+    const manifest = JSON.parse(fs.readFileSync(file, 'utf8'));
+    if (manifest.tag === tag && manifest.entries !== null &&
+        typeof manifest.entries === 'object') {
+      return Object.assign(Object.create(null), manifest.entries);
+    }
+  } catch (e) {
+    // Missing or corrupt manifest, start over.
+  }
+  dirty = true;
+  return Object.create(null);
+}
+
+function save() {
+  if (!dirty)
+    return;
+  dirty = false;
+
+  // Write to a temporary file first, other processes may be reading the
+  // manifest concurrently.
+  const tmp = `${file}.${process.pid}.${worker.threadId}`;
+  try {
+    fs.writeFileSync(tmp, JSON.stringify({ tag, entries }));
+    fs.renameSync(tmp, file);
+  } catch (e) {
+    try {
+      fs.unlinkSync(tmp);
+    } catch (e) {}
+  }
+}
+
+function get(key) {
+  return entries[key];
+}
+
+function set(key, filename) {
+  if (entries[key] !== filename) {
+    entries[key] = filename;
+    dirty = true;
+  }
+}
+
+function remove(key) {
+  if (entries[key] !== undefined) {
+    delete entries[key];
+    dirty = true;
+  }
+}
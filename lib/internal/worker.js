@@ -0,0 +1,197 @@
+'use strict';
+
+const EventEmitter = require('events');
+const path = require('path');
+const util = require('util');
+const binding = process.binding('worker');
+
+const isMainThread = binding.isMainThread;
+const threadId = binding.threadId;
+
+// Every message that crosses the thread boundary is a [kind, payload] pair
+// so that the other side can tell user messages and uncaught errors apart.
+const kMessage = 0;
+const kError = 1;
+
+module.exports = {
+  Worker,
+  isMainThread,
+  threadId,
+  parentPort: null,
+  workerData: null,
+  setupChild,
+  unsupportedOperation
+};
+
+
+function Worker(filename, options) {
+  if (!(this instanceof Worker))
+    throw new TypeError('Class constructor Worker cannot be invoked ' +
+                        'without \'new\'');
+  if (!isMainThread)
+    throw new Error('Workers cannot be started from inside of a worker');
+  if (typeof filename !== 'string')
+    throw new TypeError('"filename" argument must be a string');
+  if (options === undefined || options === null)
+    options = {};
+  else if (typeof options !== 'object')
+    throw new TypeError('"options" argument must be an object');
+
+  EventEmitter.call(this);
+
+  const isEval = !!options.eval;
+  if (!isEval)
+    filename = path.resolve(filename);
+
+  // The worker gets a copy of the environment of its parent, as it is now.
+  const data = [options.workerData, Object.assign({}, process.env)];
+  this._handle = new binding.Worker(filename, isEval, data);
+  this._handle.owner = this;
+  this._handle.onmessage = onmessage;
+  this._handle.onexit = onexit;
+  this.threadId = this._handle.threadId;
+  this._handle.startThread();
+}
+util.inherits(Worker, EventEmitter);
+
+
+Worker.prototype.postMessage = function(value) {
+  if (this._handle === null)
+    return;
+  this._handle.postMessage([kMessage, value]);
+};
+
+
+Worker.prototype.terminate = function(callback) {
+  if (typeof callback === 'function')
+    this.once('exit', (code) => callback(null, code));
+  if (this._handle === null)
+    return;
+  this._handle.terminate();
+};
+
+
+Worker.prototype.ref = function() {
+  if (this._handle !== null)
+    this._handle.ref();
+  return this;
+};
+
+
+Worker.prototype.unref = function() {
+  if (this._handle !== null)
+    this._handle.unref();
+  return this;
+};
+
+
+function onmessage(message) {
+  const worker = this.owner;
+  if (message[0] === kError)
+    worker.emit('error', message[1]);
+  else
+    worker.emit('message', message[1]);
+}
+
+
+function onexit(code) {
+  const worker = this.owner;
+  worker._handle = null;
+  this.owner = null;
+  worker.emit('exit', code);
+}
+
+
+function postToParent(kind, value) {
+  binding.postMessage([kind, value]);
+}
+
+
+// Workers share the process with the main thread, what changes the state of
+// the whole process is left to the main thread.
+function unsupportedOperation(name) {
+  const err = new TypeError(`${name} is not supported in workers`);
+  err.code = 'ERR_WORKER_UNSUPPORTED_OPERATION';
+  return err;
+}
+
+
+function setupProcessObject(env) {
+  for (const name of ['chdir', 'setuid', 'setgid', 'seteuid', 'setegid',
+                      'setgroups', 'initgroups']) {
+    if (typeof process[name] !== 'function')
+      continue;
+    process[name] = function() {
+      throw unsupportedOperation(`process.${name}()`);
+    };
+  }
+
+  // Reading the mask does not change it.
+  const umask = process.umask;
+  process.umask = function(mask) {
+    if (mask !== undefined)
+      throw unsupportedOperation('Setting process.umask()');
+    return umask.call(process);
+  };
+
+  // Writes to the copy stay local to the worker, the environment of the
+  // process is never modified from a worker.
+  process.env = env;
+}
+
+
+// Called from bootstrap_node.js when it runs inside of a worker thread.
+function setupChild(evalScript) {
+  const parentPort = new EventEmitter();
+  parentPort.postMessage = function(value) {
+    postToParent(kMessage, value);
+  };
+
+  // Like a browser worker, the thread stays alive for as long as someone
+  // listens for messages from the parent.
+  parentPort.on('newListener', (name) => {
+    if (name === 'message' && parentPort.listenerCount('message') === 0)
+      binding.refParentPort();
+  });
+  parentPort.on('removeListener', (name) => {
+    if (name === 'message' && parentPort.listenerCount('message') === 0)
+      binding.unrefParentPort();
+  });
+
+  binding.onmessage = function(message) {
+    parentPort.emit('message', message[1]);
+  };
+
+  const data = binding.getWorkerData();
+  module.exports.parentPort = parentPort;
+  module.exports.workerData = data[0];
+  setupProcessObject(data[1]);
+
+  // An uncaught exception ends the worker, not the process. It is handed to
+  // the parent which emits it as an 'error' event on the Worker object.
+  const originalFatalException = process._fatalException;
+  process._fatalException = function(error) {
+    const caught = originalFatalException.call(this, error);
+    if (!caught) {
+      try {
+        postToParent(kError, error);
+      } catch (e) {
+        // The error cannot be cloned, send what we can.
+        postToParent(kError, new Error(util.inspect(error)));
+      }
+    }
+    return caught;
+  };
+
+  // Do not pick up the -e, -p and -i flags of the main thread.
+  delete process._print_eval;
+  delete process._forceRepl;
+
+  if (binding.isEval) {
+    process._eval = binding.entryPoint;
+    evalScript('[worker eval]');
+  } else {
+    delete process._eval;
+    require('module').runMain();
+  }
+}
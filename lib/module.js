@@ -3,6 +3,8 @@
 const NativeModule = require('native_module');
 const util = require('util');
 const internalModule = require('internal/module');
+const compileCache = require('internal/compile_cache');
+const resolutionCache = require('internal/resolution_cache');
 const vm = require('vm');
 const assert = require('assert').ok;
 const fs = require('fs');
@@ -157,6 +159,18 @@ Module._findPath = function(request, paths, isMain) {
     return Module._pathCache[cacheKey];
   }
 
+  if (resolutionCache.enabled) {
+    const cached = resolutionCache.get(cacheKey);
+    if (cached !== undefined) {
+      if (stat(cached) === 0) {
+        debug('resolution cache hit %s', cached);
+        Module._pathCache[cacheKey] = cached;
+        return cached;
+      }
+      resolutionCache.delete(cacheKey);
+    }
+  }
+
   var exts;
   const trailingSlash = request.length > 0 &&
                         request.charCodeAt(request.length - 1) === 47/*/*/;
@@ -218,6 +232,8 @@ Module._findPath = function(request, paths, isMain) {
       }
 
       Module._pathCache[cacheKey] = filename;
+      if (resolutionCache.enabled)
+        resolutionCache.set(cacheKey, filename);
       return filename;
     }
   }
@@ -540,11 +556,7 @@ Module.prototype._compile = function(content, filename) {
   // create wrapper function
   var wrapper = Module.wrap(content);
 
-  var compiledWrapper = vm.runInThisContext(wrapper, {
-    filename: filename,
-    lineOffset: 0,
-    displayErrors: true
-  });
+  var compiledWrapper = compileWrapper(wrapper, filename);
 
   if (process._debugWaitConnect && process._eval == null) {
     if (!resolvedArgv) {
@@ -574,6 +586,44 @@ Module.prototype._compile = function(content, filename) {
 };
 
 
+function compileWrapper(wrapper, filename) {
+  if (compileCache.directory === null) {
+    return vm.runInThisContext(wrapper, {
+      filename: filename,
+      lineOffset: 0,
+      displayErrors: true
+    });
+  }
+
+  const entry = compileCache.entry(filename, wrapper);
+  const cachedData = compileCache.read(entry);
+  var script = new vm.Script(wrapper, {
+    filename: filename,
+    lineOffset: 0,
+    displayErrors: true,
+    cachedData: cachedData,
+    produceCachedData: cachedData === undefined
+  });
+
+  if (cachedData !== undefined && script.cachedDataRejected) {
+    debug('compile cache rejected %s', filename);
+    script = new vm.Script(wrapper, {
+      filename: filename,
+      lineOffset: 0,
+      displayErrors: true,
+      produceCachedData: true
+    });
+  } else if (cachedData !== undefined) {
+    debug('compile cache hit %s', filename);
+  }
+
+  if (script.cachedDataProduced)
+    compileCache.write(entry, script.cachedData);
+
+  return script.runInThisContext({ displayErrors: true });
+}
+
+
 // Native extension for .js
 Module._extensions['.js'] = function(module, filename) {
   var content = fs.readFileSync(filename, 'utf8');
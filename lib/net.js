@@ -18,9 +18,11 @@ const TCPConnectWrap = process.binding('tcp_wrap').TCPConnectWrap;
 const PipeConnectWrap = process.binding('pipe_wrap').PipeConnectWrap;
 const ShutdownWrap = process.binding('stream_wrap').ShutdownWrap;
 const WriteWrap = process.binding('stream_wrap').WriteWrap;
+const SendFileWrap = process.binding('stream_wrap').SendFileWrap;
 
 
 var cluster;
+var fs;
 const errnoException = util._errnoException;
 const exceptionWithHostPort = util._exceptionWithHostPort;
 const isLegalPort = internalNet.isLegalPort;
@@ -123,6 +125,10 @@ function initSocketHandle(self) {
 
 
 const BYTES_READ = Symbol('bytesRead');
+const kSendFile = Symbol('sendFile');
+const kSendFileReq = Symbol('sendFileReq');
+const kSendFileChunkSize = 64 * 1024;
+const kCoalesceMaxBytes = 16 * 1024;
 
 
 function Socket(options) {
@@ -170,6 +176,11 @@ function Socket(options) {
   this._pendingData = null;
   this._pendingEncoding = '';
 
+  // See setWriteCoalescing().
+  this._coalesceWrites = true;
+  this._coalesceMaxBytes = kCoalesceMaxBytes;
+  this._coalescing = false;
+
   // handle strings directly
   this._writableState.decodeStrings = false;
 
@@ -358,6 +369,19 @@ Socket.prototype.setNoDelay = function(enable) {
 };
 
 
+Socket.prototype.setWriteCoalescing = function(enable, maxBytes) {
+  if (maxBytes !== undefined) {
+    if (typeof maxBytes !== 'number' || !(maxBytes >= 0))
+      throw new TypeError('"maxBytes" argument must be a non-negative number');
+    this._coalesceMaxBytes = maxBytes;
+  }
+  this._coalesceWrites = enable === undefined ? true : !!enable;
+  if (!this._coalesceWrites)
+    flushCoalesced(this);
+  return this;
+};
+
+
 Socket.prototype.setKeepAlive = function(setting, msecs) {
   if (!this._handle) {
     this.once('connect', () => this.setKeepAlive(setting, msecs));
@@ -496,6 +520,11 @@ Socket.prototype._destroy = function(exception, cb) {
     // `bytesRead` should be accessible after `.destroy()`
     this[BYTES_READ] = this._handle.bytesRead;
 
+    if (this[kSendFileReq]) {
+      this[kSendFileReq].cancel();
+      this[kSendFileReq] = null;
+    }
+
     this._handle.close(() => {
       debug('emit close');
       this.emit('close', isException);
@@ -524,6 +553,9 @@ Socket.prototype._destroy = function(exception, cb) {
 
 Socket.prototype.destroy = function(exception) {
   debug('destroy', exception);
+  // Writes held back for coalescing were accepted before the socket was
+  // destroyed, so hand them to the handle first.
+  flushCoalesced(this);
   this._destroy(exception);
 };
 
@@ -658,10 +690,40 @@ Socket.prototype.write = function(chunk, encoding, cb) {
     throw new TypeError(
       'Invalid data, chunk must be a string or buffer, not ' + typeof chunk);
   }
-  return stream.Duplex.prototype.write.apply(this, arguments);
+
+  // A write callback that is still pending means that there was a write
+  // earlier in this tick, or that one is still in flight. Either way more
+  // writes are likely to follow, so hold them back until the next tick and
+  // pass them to the handle in one writev.
+  const state = this._writableState;
+  if (state.pendingcb > 0 &&
+      this._coalesceWrites &&
+      this._writev !== null &&
+      !this._coalescing &&
+      !state.corked &&
+      !state.ending) {
+    this._coalescing = true;
+    this.cork();
+    process.nextTick(flushCoalesced, this);
+  }
+
+  const ret = stream.Duplex.prototype.write.apply(this, arguments);
+  if (this._coalescing && state.length >= this._coalesceMaxBytes)
+    flushCoalesced(this);
+  return ret;
 };
 
 
+function flushCoalesced(self) {
+  if (!self._coalescing)
+    return;
+  self._coalescing = false;
+  // end() uncorks on its own.
+  if (self._writableState.corked && !self.destroyed)
+    self.uncork();
+}
+
+
 Socket.prototype._writeGeneric = function(writev, data, encoding, cb) {
   // If we are still connecting, then buffer this for later.
   // The Writable logic will buffer up any more writes while
@@ -684,6 +746,16 @@ Socket.prototype._writeGeneric = function(writev, data, encoding, cb) {
     return false;
   }
 
+  const file = writev ? undefined : data[kSendFile];
+  if (file !== undefined) {
+    const state = this._writableState;
+    sendFileGeneric(this, file, function(err) {
+      state.length -= file.length;
+      cb(err);
+    });
+    return;
+  }
+
   var req = new WriteWrap();
   req.handle = this._handle;
   req.oncomplete = afterWrite;
@@ -726,10 +798,44 @@ Socket.prototype._writeGeneric = function(writev, data, encoding, cb) {
 
 
 Socket.prototype._writev = function(chunks, cb) {
+  for (var i = 0; i < chunks.length; i++) {
+    if (chunks[i].chunk[kSendFile] !== undefined) {
+      writevSplit(this, chunks, cb);
+      return;
+    }
+  }
   this._writeGeneric(true, chunks, '', cb);
 };
 
 
+// Files queued with sendFile() are transferred on their own, the buffers
+// around them are written in order.
+function writevSplit(self, chunks, cb) {
+  if (chunks.length === 0) {
+    cb();
+    return;
+  }
+
+  var n = 0;
+  while (n < chunks.length && chunks[n].chunk[kSendFile] === undefined)
+    n++;
+
+  if (n <= 1) {
+    n = 1;
+    self._writeGeneric(false, chunks[0].chunk, chunks[0].encoding, next);
+  } else {
+    self._writeGeneric(true, chunks.slice(0, n), '', next);
+  }
+
+  function next(err) {
+    if (err)
+      cb(err);
+    else
+      writevSplit(self, chunks.slice(n), cb);
+  }
+}
+
+
 Socket.prototype._write = function(data, encoding, cb) {
   this._writeGeneric(false, data, encoding, cb);
 };
@@ -762,6 +868,123 @@ function createWriteReq(req, handle, data, encoding) {
 }
 
 
+// sendFile(fd, offset, length[, callback])
+Socket.prototype.sendFile = function(fd, offset, length, cb) {
+  if (!Number.isInteger(fd) || fd < 0 || fd > 0x7fffffff)
+    throw new TypeError('"fd" must be a non-negative integer');
+  if (!Number.isSafeInteger(offset) || offset < 0)
+    throw new TypeError('"offset" must be a non-negative integer');
+  if (!Number.isSafeInteger(length) || length < 0)
+    throw new TypeError('"length" must be a non-negative integer');
+
+  // The file goes through the write queue as an empty marker chunk so that it
+  // is ordered with respect to other writes. Its length counts towards the
+  // queued length until it is sent, for backpressure and 'drain' to work as
+  // for any other chunk. Files sent after end() are rejected by write().
+  const marker = Buffer.alloc(0);
+  marker[kSendFile] = { fd, offset, length };
+  if (!this._writableState.ending)
+    this._writableState.length += length;
+  return this.write(marker, cb);
+};
+
+
+function sendFileGeneric(self, file, cb) {
+  if (file.length === 0) {
+    cb();
+    return;
+  }
+
+  if (typeof self._handle.sendFile !== 'function') {
+    sendFileFallback(self, file, cb);
+    return;
+  }
+
+  const req = new SendFileWrap();
+  req.handle = self._handle;
+  req.oncomplete = afterSendFile;
+  req.cb = cb;
+
+  const err = self._handle.sendFile(req, file.fd, file.offset, file.length);
+  if (err === uv.UV_ENOTSUP) {
+    sendFileFallback(self, file, cb);
+    return;
+  }
+  if (err) {
+    self._destroy(errnoException(err, 'sendfile'), cb);
+    return;
+  }
+
+  self[kSendFileReq] = req;
+}
+
+
+function afterSendFile(status, bytes) {
+  const self = this.handle.owner;
+  debug('afterSendFile', status, bytes);
+
+  // callback may come after call to destroy.
+  if (self.destroyed)
+    return;
+
+  self[kSendFileReq] = null;
+  self._bytesDispatched += bytes;
+
+  if (status < 0) {
+    self._destroy(errnoException(status, 'sendfile'), this.cb);
+    return;
+  }
+
+  self._unrefTimer();
+  this.cb();
+}
+
+
+// Copies the file through userland for handles that can't use sendfile(2),
+// e.g. TLS sockets.
+function sendFileFallback(self, file, cb) {
+  if (!fs)
+    fs = require('fs');
+
+  const buffer = Buffer.allocUnsafe(Math.min(file.length, kSendFileChunkSize));
+  var offset = file.offset;
+  var remaining = file.length;
+
+  function readChunk() {
+    const size = Math.min(remaining, buffer.length);
+    fs.read(file.fd, buffer, 0, size, offset, function(err, bytesRead) {
+      if (self.destroyed)
+        return;
+      if (err) {
+        self._destroy(err, cb);
+        return;
+      }
+      if (bytesRead === 0) {
+        cb();
+        return;
+      }
+
+      offset += bytesRead;
+      remaining -= bytesRead;
+      // The write callback only runs once the chunk is flushed, so it is
+      // safe to read the next one into the same buffer.
+      self._writeGeneric(false, buffer.slice(0, bytesRead), 'buffer', onwrite);
+    });
+  }
+
+  function onwrite(err) {
+    if (err)
+      cb(err);
+    else if (remaining === 0)
+      cb();
+    else
+      readChunk();
+  }
+
+  readChunk();
+}
+
+
 protoGetter('bytesWritten', function bytesWritten() {
   var bytes = this._bytesDispatched;
   const state = this._writableState;
@@ -772,7 +995,9 @@ protoGetter('bytesWritten', function bytesWritten() {
     return undefined;
 
   state.getBuffer().forEach(function(el) {
-    if (el.chunk instanceof Buffer)
+    if (el.chunk[kSendFile] !== undefined)
+      bytes += el.chunk[kSendFile].length;
+    else if (el.chunk instanceof Buffer)
       bytes += el.chunk.length;
     else
       bytes += Buffer.byteLength(el.chunk, el.encoding);
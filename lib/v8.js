@@ -14,6 +14,7 @@
 
 'use strict';
 
+const Buffer = require('buffer').Buffer;
 const v8binding = process.binding('v8');
 
 // Properties for heap statistics buffer extraction.
@@ -79,3 +80,39 @@ exports.getHeapSpaceStatistics = function() {
 
   return heapSpaceStatistics;
 };
+
+/* V8 serialization API */
+
+const Serializer = v8binding.Serializer;
+const Deserializer = v8binding.Deserializer;
+
+// Returns a view of the input, not a copy.
+Deserializer.prototype.readRawBytes = function(length) {
+  const offset = this._readRawBytes(length);
+  return Buffer.from(this.buffer.buffer,
+                     this.buffer.byteOffset + offset,
+                     length);
+};
+
+// Buffers and typed arrays are written as raw bytes by the native side, the
+// default classes have nothing to add to the base classes.
+class DefaultSerializer extends Serializer {}
+
+class DefaultDeserializer extends Deserializer {}
+
+exports.Serializer = Serializer;
+exports.Deserializer = Deserializer;
+exports.DefaultSerializer = DefaultSerializer;
+exports.DefaultDeserializer = DefaultDeserializer;
+
+// Shortcuts that skip the Serializer and Deserializer objects, the data is
+// the same as with them.
+exports.serialize = function(value) {
+  return v8binding.serialize(value);
+};
+
+exports.deserialize = function(buffer) {
+  if (!(buffer instanceof Uint8Array))
+    throw new TypeError('"buffer" argument must be a Buffer or Uint8Array');
+  return v8binding.deserialize(buffer);
+};
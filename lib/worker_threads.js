@@ -0,0 +1,11 @@
+'use strict';
+
+const internalWorker = require('internal/worker');
+
+module.exports = {
+  isMainThread: internalWorker.isMainThread,
+  parentPort: internalWorker.parentPort,
+  threadId: internalWorker.threadId,
+  Worker: internalWorker.Worker,
+  workerData: internalWorker.workerData
+};
@@ -7,6 +7,8 @@
     'node_use_perfctr%': 'false',
     'node_no_browser_globals%': 'false',
     'node_use_v8_platform%': 'true',
+    'node_use_node_snapshot%': 'false',
+    'node_use_code_cache%': 'false',
     'node_use_bundled_v8%': 'true',
     'node_shared%': 'false',
     'force_dynamic_crt%': 0,
@@ -73,9 +75,12 @@
       'lib/util.js',
       'lib/v8.js',
       'lib/vm.js',
+      'lib/worker_threads.js',
       'lib/zlib.js',
       'lib/internal/buffer.js',
       'lib/internal/child_process.js',
+      'lib/internal/child_process/serialization.js',
+      'lib/internal/compile_cache.js',
       'lib/internal/cluster.js',
       'lib/internal/freelist.js',
       'lib/internal/fs.js',
@@ -88,12 +93,14 @@
       'lib/internal/process/warning.js',
       'lib/internal/process.js',
       'lib/internal/readline.js',
+      'lib/internal/resolution_cache.js',
       'lib/internal/repl.js',
       'lib/internal/socket_list.js',
       'lib/internal/url.js',
       'lib/internal/util.js',
       'lib/internal/v8_prof_polyfill.js',
       'lib/internal/v8_prof_processor.js',
+      'lib/internal/worker.js',
       'lib/internal/streams/lazy_transform.js',
       'lib/internal/streams/BufferList.js',
       'deps/v8/tools/splaytree.js',
@@ -142,6 +149,7 @@
       'sources': [
         'src/debug-agent.cc',
         'src/async-wrap.cc',
+        'src/base64.cc',
         'src/env.cc',
         'src/fs_event_wrap.cc',
         'src/cares_wrap.cc',
@@ -151,6 +159,7 @@
         'src/js_stream.cc',
         'src/node.cc',
         'src/node_buffer.cc',
+        'src/node_code_cache.cc',
         'src/node_config.cc',
         'src/node_constants.cc',
         'src/node_contextify.cc',
@@ -161,15 +170,18 @@
         'src/node_main.cc',
         'src/node_os.cc',
         'src/node_revert.cc',
+        'src/node_serdes.cc',
         'src/node_url.cc',
         'src/node_util.cc',
         'src/node_v8.cc',
         'src/node_stat_watcher.cc',
         'src/node_watchdog.cc',
+        'src/node_worker.cc',
         'src/node_zlib.cc',
         'src/node_i18n.cc',
         'src/pipe_wrap.cc',
         'src/signal_wrap.cc',
+        'src/simd.cc',
         'src/spawn_sync.cc',
         'src/string_bytes.cc',
         'src/stream_base.cc',
@@ -178,6 +190,7 @@
         'src/timer_wrap.cc',
         'src/tty_wrap.cc',
         'src/process_wrap.cc',
+        'src/read_buffer_pool.cc',
         'src/udp_wrap.cc',
         'src/uv.cc',
         # headers to make for a more pleasant IDE experience
@@ -202,17 +215,23 @@
         'src/node_javascript.h',
         'src/node_mutex.h',
         'src/node_root_certs.h',
+        'src/node_serdes.h',
         'src/node_version.h',
         'src/node_watchdog.h',
+        'src/node_worker.h',
         'src/node_wrap.h',
         'src/node_revert.h',
         'src/node_i18n.h',
+        'src/node_snapshot.h',
+        'src/node_code_cache.h',
         'src/pipe_wrap.h',
+        'src/read_buffer_pool.h',
         'src/tty_wrap.h',
         'src/tcp_wrap.h',
         'src/udp_wrap.h',
         'src/req-wrap.h',
         'src/req-wrap-inl.h',
+        'src/simd.h',
         'src/string_bytes.h',
         'src/stream_base.h',
         'src/stream_base-inl.h',
@@ -277,6 +296,56 @@
             'NODE_USE_V8_PLATFORM=0',
           ],
         }],
+        [ 'node_use_node_snapshot=="true"', {
+          'dependencies': [
+            'node_mksnapshot',
+          ],
+          'actions': [
+            {
+              'action_name': 'node_mksnapshot',
+              'process_outputs_as_sources': 1,
+              'inputs': [
+                '<(PRODUCT_DIR)/<(EXECUTABLE_PREFIX)node_mksnapshot<(EXECUTABLE_SUFFIX)',
+              ],
+              'outputs': [
+                '<(SHARED_INTERMEDIATE_DIR)/node_snapshot.cc',
+              ],
+              'action': [
+                '<@(_inputs)',
+                '<@(_outputs)',
+              ],
+            },
+          ],
+        }, {
+          'sources': [
+            'src/node_snapshot_stub.cc',
+          ],
+        }],
+        [ 'node_use_code_cache=="true"', {
+          'dependencies': [
+            'node_mkcodecache',
+          ],
+          'actions': [
+            {
+              'action_name': 'node_mkcodecache',
+              'process_outputs_as_sources': 1,
+              'inputs': [
+                '<(PRODUCT_DIR)/<(EXECUTABLE_PREFIX)node_mkcodecache<(EXECUTABLE_SUFFIX)',
+              ],
+              'outputs': [
+                '<(SHARED_INTERMEDIATE_DIR)/node_code_cache.cc',
+              ],
+              'action': [
+                '<@(_inputs)',
+                '<@(_outputs)',
+              ],
+            },
+          ],
+        }, {
+          'sources': [
+            'src/node_code_cache_stub.cc',
+          ],
+        }],
         [ 'node_tag!=""', {
           'defines': [ 'NODE_TAG="<(node_tag)"' ],
         }],
@@ -886,6 +955,10 @@
         'NODE_WANT_INTERNALS=1',
       ],
       'sources': [
+        'src/base64.cc',
+        'src/simd.cc',
+        'test/cctest/test_base64.cc',
+        'test/cctest/test_simd.cc',
         'test/cctest/util.cc',
       ],
 
@@ -941,6 +1014,68 @@
   ], # end targets
 
   'conditions': [
+    [ 'node_use_node_snapshot=="true"', {
+      'targets': [
+        {
+          'target_name': 'node_mksnapshot',
+          'type': 'executable',
+          'dependencies': [
+            'node_js2c#host',
+            'deps/v8/src/v8.gyp:v8',
+            'deps/v8/src/v8.gyp:v8_libplatform',
+          ],
+          'include_dirs': [
+            'src',
+            'deps/v8/include',
+            '<(SHARED_INTERMEDIATE_DIR)',
+          ],
+          'defines': [ 'NODE_WANT_INTERNALS=1' ],
+          'sources': [
+            'src/node_snapshot.h',
+            'tools/snapshot/node_mksnapshot.cc',
+          ],
+          'conditions': [
+            [ 'v8_enable_i18n_support==1', {
+              'dependencies': [
+                '<(icu_gyp_path):icui18n',
+                '<(icu_gyp_path):icuuc',
+              ],
+            }],
+          ],
+        },
+      ],
+    }],
+    [ 'node_use_code_cache=="true"', {
+      'targets': [
+        {
+          'target_name': 'node_mkcodecache',
+          'type': 'executable',
+          'dependencies': [
+            'node_js2c#host',
+            'deps/v8/src/v8.gyp:v8',
+            'deps/v8/src/v8.gyp:v8_libplatform',
+          ],
+          'include_dirs': [
+            'src',
+            'deps/v8/include',
+            '<(SHARED_INTERMEDIATE_DIR)',
+          ],
+          'defines': [ 'NODE_WANT_INTERNALS=1' ],
+          'sources': [
+            'src/node_code_cache.h',
+            'tools/code_cache/node_mkcodecache.cc',
+          ],
+          'conditions': [
+            [ 'v8_enable_i18n_support==1', {
+              'dependencies': [
+                '<(icu_gyp_path):icui18n',
+                '<(icu_gyp_path):icuuc',
+              ],
+            }],
+          ],
+        },
+      ],
+    }],
     ['OS=="aix"', {
       'targets': [
         {
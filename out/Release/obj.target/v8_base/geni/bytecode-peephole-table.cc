@@ -0,0 +1,17055 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+// Autogenerated by ../deps/v8/src/interpreter/mkpeephole.cc. Do not edit.
+
+#include "src/interpreter/bytecode-peephole-table.h"
+
+namespace v8 {
+namespace internal {
+namespace interpreter {
+
+const PeepholeActionAndData PeepholeActionTable::row_data_[129][129] = {
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kTransformLdaZeroBinaryOpToBinaryOpWithZeroAction,Bytecode::kAddSmi},
+  {PeepholeAction::kTransformLdaZeroBinaryOpToBinaryOpWithZeroAction,Bytecode::kSubSmi},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kTransformLdaZeroBinaryOpToBinaryOpWithZeroAction,Bytecode::kBitwiseOrSmi},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kTransformLdaZeroBinaryOpToBinaryOpWithZeroAction,Bytecode::kBitwiseAndSmi},
+  {PeepholeAction::kTransformLdaZeroBinaryOpToBinaryOpWithZeroAction,Bytecode::kShiftLeftSmi},
+  {PeepholeAction::kTransformLdaZeroBinaryOpToBinaryOpWithZeroAction,Bytecode::kShiftRightSmi},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kTransformLdaSmiBinaryOpToBinaryOpWithSmiAction,Bytecode::kAddSmi},
+  {PeepholeAction::kTransformLdaSmiBinaryOpToBinaryOpWithSmiAction,Bytecode::kSubSmi},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kTransformLdaSmiBinaryOpToBinaryOpWithSmiAction,Bytecode::kBitwiseOrSmi},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kTransformLdaSmiBinaryOpToBinaryOpWithSmiAction,Bytecode::kBitwiseAndSmi},
+  {PeepholeAction::kTransformLdaSmiBinaryOpToBinaryOpWithSmiAction,Bytecode::kShiftLeftSmi},
+  {PeepholeAction::kTransformLdaSmiBinaryOpToBinaryOpWithSmiAction,Bytecode::kShiftRightSmi},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kTransformLdaStarToLdrLdarAction,Bytecode::kLdrUndefined},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kChangeBytecodeAction,Bytecode::kLogicalNot},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfTrue},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfTrueConstant},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfFalse},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfFalseConstant},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kChangeBytecodeAction,Bytecode::kLogicalNot},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfTrue},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfTrueConstant},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfFalse},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfFalseConstant},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kTransformLdaStarToLdrLdarAction,Bytecode::kLdrGlobal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kTransformLdaStarToLdrLdarAction,Bytecode::kLdrContextSlot},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideCurrentIfOperand0MatchesAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideCurrentIfOperand0MatchesAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideCurrentIfOperand0MatchesAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kTransformLdaStarToLdrLdarAction,Bytecode::kLdrNamedProperty},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kTransformLdaStarToLdrLdarAction,Bytecode::kLdrKeyedProperty},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kChangeBytecodeAction,Bytecode::kLogicalNot},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfTrue},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfTrueConstant},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfFalse},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfFalseConstant},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kChangeBytecodeAction,Bytecode::kLogicalNot},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfTrue},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfTrueConstant},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfFalse},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfFalseConstant},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kChangeBytecodeAction,Bytecode::kStar},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kChangeBytecodeAction,Bytecode::kLogicalNot},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfTrue},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfTrueConstant},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfFalse},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfFalseConstant},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kChangeBytecodeAction,Bytecode::kLogicalNot},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfTrue},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfTrueConstant},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfFalse},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfFalseConstant},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kChangeBytecodeAction,Bytecode::kLogicalNot},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfTrue},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfTrueConstant},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfFalse},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfFalseConstant},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kChangeBytecodeAction,Bytecode::kLogicalNot},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfTrue},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfTrueConstant},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfFalse},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfFalseConstant},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kChangeBytecodeAction,Bytecode::kLogicalNot},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfTrue},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfTrueConstant},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfFalse},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfFalseConstant},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kChangeBytecodeAction,Bytecode::kLogicalNot},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfTrue},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfTrueConstant},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfFalse},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfFalseConstant},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kChangeBytecodeAction,Bytecode::kLogicalNot},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfTrue},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfTrueConstant},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfFalse},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfFalseConstant},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kChangeBytecodeAction,Bytecode::kLogicalNot},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfTrue},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfTrueConstant},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfFalse},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfFalseConstant},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kChangeBytecodeAction,Bytecode::kLogicalNot},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfTrue},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfTrueConstant},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfFalse},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfFalseConstant},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kChangeBytecodeAction,Bytecode::kLogicalNot},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfTrue},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfTrueConstant},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfFalse},
+  {PeepholeAction::kChangeJumpBytecodeAction,Bytecode::kJumpIfFalseConstant},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+  {PeepholeAction::kDefaultAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kUpdateLastIfSourceInfoPresentAction,Bytecode::kIllegal},
+},
+{
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastBeforeJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastBeforeJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastBeforeJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastBeforeJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastBeforeJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastBeforeJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastBeforeJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastBeforeJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastBeforeJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastBeforeJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastBeforeJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastBeforeJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastBeforeJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastBeforeJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastBeforeJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastBeforeJumpAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+  {PeepholeAction::kElideLastAction,Bytecode::kIllegal},
+},
+};
+
+const PeepholeActionAndData* const PeepholeActionTable::row_[129] = {
+   PeepholeActionTable::row_data_[0], 
+   PeepholeActionTable::row_data_[1], 
+   PeepholeActionTable::row_data_[2], 
+   PeepholeActionTable::row_data_[3], 
+   PeepholeActionTable::row_data_[4], 
+   PeepholeActionTable::row_data_[5], 
+   PeepholeActionTable::row_data_[6], 
+   PeepholeActionTable::row_data_[7], 
+   PeepholeActionTable::row_data_[8], 
+   PeepholeActionTable::row_data_[9], 
+   PeepholeActionTable::row_data_[10], 
+   PeepholeActionTable::row_data_[11], 
+   PeepholeActionTable::row_data_[12], 
+   PeepholeActionTable::row_data_[13], 
+   PeepholeActionTable::row_data_[14], 
+   PeepholeActionTable::row_data_[15], 
+   PeepholeActionTable::row_data_[16], 
+   PeepholeActionTable::row_data_[17], 
+   PeepholeActionTable::row_data_[18], 
+   PeepholeActionTable::row_data_[19], 
+   PeepholeActionTable::row_data_[20], 
+   PeepholeActionTable::row_data_[21], 
+   PeepholeActionTable::row_data_[22], 
+   PeepholeActionTable::row_data_[23], 
+   PeepholeActionTable::row_data_[24], 
+   PeepholeActionTable::row_data_[25], 
+   PeepholeActionTable::row_data_[26], 
+   PeepholeActionTable::row_data_[27], 
+   PeepholeActionTable::row_data_[28], 
+   PeepholeActionTable::row_data_[29], 
+   PeepholeActionTable::row_data_[30], 
+   PeepholeActionTable::row_data_[31], 
+   PeepholeActionTable::row_data_[32], 
+   PeepholeActionTable::row_data_[33], 
+   PeepholeActionTable::row_data_[34], 
+   PeepholeActionTable::row_data_[35], 
+   PeepholeActionTable::row_data_[36], 
+   PeepholeActionTable::row_data_[37], 
+   PeepholeActionTable::row_data_[38], 
+   PeepholeActionTable::row_data_[39], 
+   PeepholeActionTable::row_data_[40], 
+   PeepholeActionTable::row_data_[41], 
+   PeepholeActionTable::row_data_[42], 
+   PeepholeActionTable::row_data_[43], 
+   PeepholeActionTable::row_data_[44], 
+   PeepholeActionTable::row_data_[45], 
+   PeepholeActionTable::row_data_[46], 
+   PeepholeActionTable::row_data_[47], 
+   PeepholeActionTable::row_data_[48], 
+   PeepholeActionTable::row_data_[49], 
+   PeepholeActionTable::row_data_[50], 
+   PeepholeActionTable::row_data_[51], 
+   PeepholeActionTable::row_data_[52], 
+   PeepholeActionTable::row_data_[53], 
+   PeepholeActionTable::row_data_[54], 
+   PeepholeActionTable::row_data_[55], 
+   PeepholeActionTable::row_data_[56], 
+   PeepholeActionTable::row_data_[57], 
+   PeepholeActionTable::row_data_[58], 
+   PeepholeActionTable::row_data_[59], 
+   PeepholeActionTable::row_data_[60], 
+   PeepholeActionTable::row_data_[61], 
+   PeepholeActionTable::row_data_[62], 
+   PeepholeActionTable::row_data_[63], 
+   PeepholeActionTable::row_data_[64], 
+   PeepholeActionTable::row_data_[65], 
+   PeepholeActionTable::row_data_[66], 
+   PeepholeActionTable::row_data_[67], 
+   PeepholeActionTable::row_data_[68], 
+   PeepholeActionTable::row_data_[69], 
+   PeepholeActionTable::row_data_[70], 
+   PeepholeActionTable::row_data_[71], 
+   PeepholeActionTable::row_data_[72], 
+   PeepholeActionTable::row_data_[73], 
+   PeepholeActionTable::row_data_[74], 
+   PeepholeActionTable::row_data_[75], 
+   PeepholeActionTable::row_data_[76], 
+   PeepholeActionTable::row_data_[77], 
+   PeepholeActionTable::row_data_[78], 
+   PeepholeActionTable::row_data_[79], 
+   PeepholeActionTable::row_data_[80], 
+   PeepholeActionTable::row_data_[81], 
+   PeepholeActionTable::row_data_[82], 
+   PeepholeActionTable::row_data_[83], 
+   PeepholeActionTable::row_data_[84], 
+   PeepholeActionTable::row_data_[85], 
+   PeepholeActionTable::row_data_[86], 
+   PeepholeActionTable::row_data_[87], 
+   PeepholeActionTable::row_data_[88], 
+   PeepholeActionTable::row_data_[89], 
+   PeepholeActionTable::row_data_[90], 
+   PeepholeActionTable::row_data_[91], 
+   PeepholeActionTable::row_data_[92], 
+   PeepholeActionTable::row_data_[93], 
+   PeepholeActionTable::row_data_[94], 
+   PeepholeActionTable::row_data_[95], 
+   PeepholeActionTable::row_data_[96], 
+   PeepholeActionTable::row_data_[97], 
+   PeepholeActionTable::row_data_[98], 
+   PeepholeActionTable::row_data_[99], 
+   PeepholeActionTable::row_data_[100], 
+   PeepholeActionTable::row_data_[101], 
+   PeepholeActionTable::row_data_[102], 
+   PeepholeActionTable::row_data_[103], 
+   PeepholeActionTable::row_data_[104], 
+   PeepholeActionTable::row_data_[105], 
+   PeepholeActionTable::row_data_[106], 
+   PeepholeActionTable::row_data_[107], 
+   PeepholeActionTable::row_data_[108], 
+   PeepholeActionTable::row_data_[109], 
+   PeepholeActionTable::row_data_[110], 
+   PeepholeActionTable::row_data_[111], 
+   PeepholeActionTable::row_data_[112], 
+   PeepholeActionTable::row_data_[113], 
+   PeepholeActionTable::row_data_[114], 
+   PeepholeActionTable::row_data_[115], 
+   PeepholeActionTable::row_data_[116], 
+   PeepholeActionTable::row_data_[117], 
+   PeepholeActionTable::row_data_[118], 
+   PeepholeActionTable::row_data_[119], 
+   PeepholeActionTable::row_data_[120], 
+   PeepholeActionTable::row_data_[121], 
+   PeepholeActionTable::row_data_[122], 
+   PeepholeActionTable::row_data_[123], 
+   PeepholeActionTable::row_data_[124], 
+   PeepholeActionTable::row_data_[125], 
+   PeepholeActionTable::row_data_[126], 
+   PeepholeActionTable::row_data_[127], 
+   PeepholeActionTable::row_data_[128], 
+};
+
+// static
+const PeepholeActionAndData*
+PeepholeActionTable::Lookup(Bytecode last, Bytecode current) {
+  return &row_[Bytecodes::ToByte(last)][Bytecodes::ToByte(current)];
+}
+
+}  // namespace v8
+}  // namespace internal
+}  // namespace interpreter
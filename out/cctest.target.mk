@@ -0,0 +1,159 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := cctest
+DEFS_Debug := \
+	'-DGTEST_DONT_DEFINE_ASSERT_EQ=1' \
+	'-DGTEST_DONT_DEFINE_ASSERT_GE=1' \
+	'-DGTEST_DONT_DEFINE_ASSERT_GT=1' \
+	'-DGTEST_DONT_DEFINE_ASSERT_LE=1' \
+	'-DGTEST_DONT_DEFINE_ASSERT_LT=1' \
+	'-DGTEST_DONT_DEFINE_ASSERT_NE=1' \
+	'-DNODE_WANT_INTERNALS=1' \
+	'-DHAVE_INSPECTOR=1' \
+	'-DHTTP_PARSER_STRICT=0' \
+	'-D_LARGEFILE_SOURCE' \
+	'-D_FILE_OFFSET_BITS=64' \
+	'-D_POSIX_C_SOURCE=200112' \
+	'-DDEBUG' \
+	'-D_DEBUG'
+
+# Flags passed to all source files.
+CFLAGS_Debug := \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wno-unused-parameter \
+	-m64 \
+	-g \
+	-O0
+
+# Flags passed to only C files.
+CFLAGS_C_Debug :=
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Debug := \
+	-fno-rtti \
+	-fno-exceptions \
+	-std=gnu++0x
+
+INCS_Debug := \
+	-I$(srcdir)/src \
+	-I$(srcdir)/deps/v8/include \
+	-I$(obj)/gen \
+	-I$(srcdir)/deps/gtest/include \
+	-I$(srcdir)/deps/zlib \
+	-I$(srcdir)/deps/openssl/openssl/include \
+	-I$(srcdir)/deps/http_parser \
+	-I$(srcdir)/deps/uv/include
+
+DEFS_Release := \
+	'-DGTEST_DONT_DEFINE_ASSERT_EQ=1' \
+	'-DGTEST_DONT_DEFINE_ASSERT_GE=1' \
+	'-DGTEST_DONT_DEFINE_ASSERT_GT=1' \
+	'-DGTEST_DONT_DEFINE_ASSERT_LE=1' \
+	'-DGTEST_DONT_DEFINE_ASSERT_LT=1' \
+	'-DGTEST_DONT_DEFINE_ASSERT_NE=1' \
+	'-DNODE_WANT_INTERNALS=1' \
+	'-DHAVE_INSPECTOR=1' \
+	'-DHTTP_PARSER_STRICT=0' \
+	'-D_LARGEFILE_SOURCE' \
+	'-D_FILE_OFFSET_BITS=64' \
+	'-D_POSIX_C_SOURCE=200112'
+
+# Flags passed to all source files.
+CFLAGS_Release := \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wno-unused-parameter \
+	-m64 \
+	-O3 \
+	-fno-omit-frame-pointer
+
+# Flags passed to only C files.
+CFLAGS_C_Release :=
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Release := \
+	-fno-rtti \
+	-fno-exceptions \
+	-std=gnu++0x
+
+INCS_Release := \
+	-I$(srcdir)/src \
+	-I$(srcdir)/deps/v8/include \
+	-I$(obj)/gen \
+	-I$(srcdir)/deps/gtest/include \
+	-I$(srcdir)/deps/zlib \
+	-I$(srcdir)/deps/openssl/openssl/include \
+	-I$(srcdir)/deps/http_parser \
+	-I$(srcdir)/deps/uv/include
+
+OBJS := \
+	$(obj).target/$(TARGET)/test/cctest/util.o \
+	$(obj).target/$(TARGET)/src/inspector_socket.o \
+	$(obj).target/$(TARGET)/src/inspector_socket_server.o \
+	$(obj).target/$(TARGET)/test/cctest/test_inspector_socket.o \
+	$(obj).target/$(TARGET)/test/cctest/test_inspector_socket_server.o
+
+# Add to the list of files we specially track dependencies for.
+all_deps += $(OBJS)
+
+# Make sure our dependencies are built before any of us.
+$(OBJS): | $(obj).target/deps/gtest/libgtest.a $(obj).target/deps/zlib/libzlib.a $(obj).host/v8_inspector_compress_protocol_json.stamp $(obj).target/deps/openssl/libopenssl.a $(obj).target/deps/http_parser/libhttp_parser.a $(obj).target/deps/uv/libuv.a $(obj).target/deps/v8/src/libv8_libplatform.a $(obj).target/deps/v8/src/v8.stamp $(obj).target/deps/v8/src/libv8_libbase.a $(obj).target/deps/v8/src/v8_maybe_snapshot.stamp $(obj).target/deps/v8/src/libv8_base.a $(obj).target/deps/v8/src/libv8_libsampler.a $(obj).target/tools/icu/libicui18n.a $(obj).target/tools/icu/libicuucx.a $(obj).target/tools/icu/icu_implementation.stamp $(obj).target/tools/icu/icu_uconfig.stamp $(obj).target/tools/icu/icu_uconfig_target.stamp $(obj).target/tools/icu/icuuc.stamp $(obj).target/tools/icu/libicudata.a $(obj).target/tools/icu/libicustubdata.a $(obj).target/deps/v8/src/libv8_snapshot.a $(obj).target/deps/v8/src/js2c.stamp
+
+# CFLAGS et al overrides must be target-local.
+# See "Target-specific Variable Values" in the GNU Make manual.
+$(OBJS): TOOLSET := $(TOOLSET)
+$(OBJS): GYP_CFLAGS := $(DEFS_$(BUILDTYPE)) $(INCS_$(BUILDTYPE))  $(CFLAGS_$(BUILDTYPE)) $(CFLAGS_C_$(BUILDTYPE))
+$(OBJS): GYP_CXXFLAGS := $(DEFS_$(BUILDTYPE)) $(INCS_$(BUILDTYPE))  $(CFLAGS_$(BUILDTYPE)) $(CFLAGS_CC_$(BUILDTYPE))
+
+# Suffix rules, putting all outputs into $(obj).
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(srcdir)/%.cc FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+# Try building from generated source, too.
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(obj).$(TOOLSET)/%.cc FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(obj)/%.cc FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+# End of this set of suffix rules
+### Rules for final target.
+LDFLAGS_Debug := \
+	-pthread \
+	-rdynamic \
+	-m64 \
+	-pthread
+
+LDFLAGS_Release := \
+	-pthread \
+	-rdynamic \
+	-m64 \
+	-pthread
+
+LIBS := \
+	-lm \
+	-ldl \
+	-lrt
+
+$(builddir)/cctest: GYP_LDFLAGS := $(LDFLAGS_$(BUILDTYPE))
+$(builddir)/cctest: LIBS := $(LIBS)
+$(builddir)/cctest: LD_INPUTS := $(OBJS) $(obj).target/deps/gtest/libgtest.a $(obj).target/deps/zlib/libzlib.a $(obj).target/deps/openssl/libopenssl.a $(obj).target/deps/http_parser/libhttp_parser.a $(obj).target/deps/uv/libuv.a $(obj).target/deps/v8/src/libv8_libplatform.a $(obj).target/deps/v8/src/libv8_libbase.a $(obj).target/deps/v8/src/libv8_base.a $(obj).target/deps/v8/src/libv8_libsampler.a $(obj).target/tools/icu/libicui18n.a $(obj).target/tools/icu/libicuucx.a $(obj).target/tools/icu/libicudata.a $(obj).target/tools/icu/libicustubdata.a $(obj).target/deps/v8/src/libv8_snapshot.a
+$(builddir)/cctest: TOOLSET := $(TOOLSET)
+$(builddir)/cctest: $(OBJS) $(obj).target/deps/gtest/libgtest.a $(obj).target/deps/zlib/libzlib.a $(obj).target/deps/openssl/libopenssl.a $(obj).target/deps/http_parser/libhttp_parser.a $(obj).target/deps/uv/libuv.a $(obj).target/deps/v8/src/libv8_libplatform.a $(obj).target/deps/v8/src/libv8_libbase.a $(obj).target/deps/v8/src/libv8_base.a $(obj).target/deps/v8/src/libv8_libsampler.a $(obj).target/tools/icu/libicui18n.a $(obj).target/tools/icu/libicuucx.a $(obj).target/tools/icu/libicudata.a $(obj).target/tools/icu/libicustubdata.a $(obj).target/deps/v8/src/libv8_snapshot.a FORCE_DO_CMD
+	$(call do_cmd,link)
+
+all_deps += $(builddir)/cctest
+# Add target alias
+.PHONY: cctest
+cctest: $(builddir)/cctest
+
+# Add executable to "all" target.
+.PHONY: all
+all: $(builddir)/cctest
+
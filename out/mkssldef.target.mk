@@ -0,0 +1,18 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := mkssldef
+### Rules for final target.
+$(obj).target/mkssldef.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/mkssldef.stamp:  FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/mkssldef.stamp
+# Add target alias
+.PHONY: mkssldef
+mkssldef: $(obj).target/mkssldef.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: mkssldef
+
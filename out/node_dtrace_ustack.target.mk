@@ -0,0 +1,18 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := node_dtrace_ustack
+### Rules for final target.
+$(obj).target/node_dtrace_ustack.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/node_dtrace_ustack.stamp:  FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/node_dtrace_ustack.stamp
+# Add target alias
+.PHONY: node_dtrace_ustack
+node_dtrace_ustack: $(obj).target/node_dtrace_ustack.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: node_dtrace_ustack
+
@@ -24,6 +24,7 @@ using v8::Number;
 using v8::Object;
 using v8::RetainedObjectInfo;
 using v8::TryCatch;
+using v8::Undefined;
 using v8::Value;
 
 namespace node {
@@ -293,6 +294,9 @@ Local<Value> AsyncWrap::MakeCallback(const Local<Function> cb,
                                      Local<Value>* argv) {
   CHECK(env()->context() == env()->isolate()->GetCurrentContext());
 
+  if (env()->is_stopping_worker())
+    return Undefined(env()->isolate());
+
   Local<Function> pre_fn = env()->async_hooks_pre_function();
   Local<Function> post_fn = env()->async_hooks_post_function();
   Local<Value> uid = Number::New(env()->isolate(), get_uid());
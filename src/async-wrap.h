@@ -26,6 +26,7 @@ namespace node {
   V(PIPECONNECTWRAP)                                                          \
   V(PROCESSWRAP)                                                              \
   V(QUERYWRAP)                                                                \
+  V(SENDFILEWRAP)                                                             \
   V(SHUTDOWNWRAP)                                                             \
   V(SIGNALWRAP)                                                               \
   V(STATWATCHER)                                                              \
@@ -36,6 +37,7 @@ namespace node {
   V(TTYWRAP)                                                                  \
   V(UDPWRAP)                                                                  \
   V(UDPSENDWRAP)                                                              \
+  V(WORKER)                                                                   \
   V(WRITEWRAP)                                                                \
   V(ZLIB)
 
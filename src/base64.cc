@@ -0,0 +1,371 @@
+#include "base64.h"
+#include "simd.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef NODE_SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace node {
+
+// supports regular and URL-safe base64
+const int8_t unbase64_table[256] =
+  { -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -1, -1, -2, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 62, -1, 62, -1, 63,
+    52, 53, 54, 55, 56, 57, 58, 59, 60, 61, -1, -1, -1, -1, -1, -1,
+    -1,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, -1, -1, -1, -1, 63,
+    -1, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+    41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+  };
+
+
+#ifdef NODE_SIMD_X86
+
+// Encoding follows Wojciech Muła's and Daniel Lemire's "Faster Base64
+// Encoding and Decoding using AVX2 Instructions": every 3 input bytes are
+// spread over 4 bytes with 6 bits each, which are then mapped to ASCII by
+// adding an offset that depends on the range they are in.
+
+NODE_SIMD_SSSE3
+static inline __m128i EncodeSplit(__m128i in) {
+  // Byte order within the 32 bit lanes: b1 b0 b2 b1.
+  in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7,
+                                         4, 5, 3, 4, 1, 2, 0, 1));
+  const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+  const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+  const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+  const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+  return _mm_or_si128(t1, t3);
+}
+
+
+NODE_SIMD_SSSE3
+static inline __m128i EncodeTranslate(__m128i indices) {
+  // 0..25 -> 13, 26..51 -> 0, 52..61 -> 1..10, 62 -> 11, 63 -> 12.
+  __m128i offset_index = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+  const __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+  offset_index =
+      _mm_or_si128(offset_index, _mm_and_si128(less, _mm_set1_epi8(13)));
+  const __m128i offsets = _mm_setr_epi8(
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+  return _mm_add_epi8(_mm_shuffle_epi8(offsets, offset_index), indices);
+}
+
+
+NODE_SIMD_AVX2
+static inline __m256i EncodeSplit(__m256i in) {
+  in = _mm256_shuffle_epi8(in, _mm256_set_epi8(
+      10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+      10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+  const __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+  const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+  const __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+  const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+  return _mm256_or_si256(t1, t3);
+}
+
+
+NODE_SIMD_AVX2
+static inline __m256i EncodeTranslate(__m256i indices) {
+  __m256i offset_index = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+  const __m256i less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+  offset_index = _mm256_or_si256(offset_index,
+                                 _mm256_and_si256(less, _mm256_set1_epi8(13)));
+  const __m256i offsets = _mm256_setr_epi8(
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+  return _mm256_add_epi8(_mm256_shuffle_epi8(offsets, offset_index), indices);
+}
+
+
+// Every iteration reads 16 bytes but only encodes the first 12 of them.
+NODE_SIMD_SSSE3
+static size_t EncodeSSSE3(const char* src, size_t slen, char* dst) {
+  size_t i = 0;
+  size_t k = 0;
+  while (i + 16 <= slen) {
+    const __m128i in =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    const __m128i out = EncodeTranslate(EncodeSplit(in));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + k), out);
+    i += 12;
+    k += 16;
+  }
+  return i;
+}
+
+
+// Like EncodeSSSE3() with 24 of the 28 bytes that it reads, 12 per lane.
+NODE_SIMD_AVX2
+static size_t EncodeAVX2(const char* src, size_t slen, char* dst) {
+  size_t i = 0;
+  size_t k = 0;
+  while (i + 28 <= slen) {
+    const __m128i lo =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    const __m128i hi =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 12));
+    const __m256i in =
+        _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+    const __m256i out = EncodeTranslate(EncodeSplit(in));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + k), out);
+    i += 24;
+    k += 32;
+  }
+  return i;
+}
+
+
+// Decoding maps the characters back to 6 bit values and rejects everything
+// that is not in the standard alphabet with two nibble lookups: a character
+// is invalid when the bits of its low and its high nibble overlap. The
+// tables are those of Alfred Klomp's base64 library.
+
+NODE_SIMD_SSSE3
+static inline bool DecodeTranslate(__m128i* str) {
+  const __m128i lut_lo = _mm_setr_epi8(
+      0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+      0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+  const __m128i lut_hi = _mm_setr_epi8(
+      0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+      0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+  const __m128i lut_roll = _mm_setr_epi8(
+      0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+  const __m128i nibble_mask = _mm_set1_epi8(0x0f);
+
+  const __m128i hi_nibbles =
+      _mm_and_si128(_mm_srli_epi32(*str, 4), nibble_mask);
+  const __m128i lo_nibbles = _mm_and_si128(*str, nibble_mask);
+  const __m128i hi = _mm_shuffle_epi8(lut_hi, hi_nibbles);
+  const __m128i lo = _mm_shuffle_epi8(lut_lo, lo_nibbles);
+  if (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_and_si128(lo, hi),
+                                       _mm_setzero_si128())) != 0) {
+    return false;
+  }
+
+  // '/' shares its high nibble with '+', it gets its own offset at index 1.
+  const __m128i eq_slash = _mm_cmpeq_epi8(*str, _mm_set1_epi8('/'));
+  const __m128i roll =
+      _mm_shuffle_epi8(lut_roll, _mm_add_epi8(eq_slash, hi_nibbles));
+  *str = _mm_add_epi8(*str, roll);
+  return true;
+}
+
+
+// Packs the 6 bit values of every 32 bit lane into 3 bytes, leaving the
+// 12 bytes of output at the start of the vector.
+NODE_SIMD_SSSE3
+static inline __m128i DecodePack(__m128i in) {
+  const __m128i ab_bc = _mm_maddubs_epi16(in, _mm_set1_epi32(0x01400140));
+  const __m128i out = _mm_madd_epi16(ab_bc, _mm_set1_epi32(0x00011000));
+  return _mm_shuffle_epi8(out, _mm_setr_epi8(
+      2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+}
+
+
+NODE_SIMD_AVX2
+static inline bool DecodeTranslate(__m256i* str) {
+  const __m256i lut_lo = _mm256_setr_epi8(
+      0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+      0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+      0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+      0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+  const __m256i lut_hi = _mm256_setr_epi8(
+      0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+      0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+      0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+      0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+  const __m256i lut_roll = _mm256_setr_epi8(
+      0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+  const __m256i nibble_mask = _mm256_set1_epi8(0x0f);
+
+  const __m256i hi_nibbles =
+      _mm256_and_si256(_mm256_srli_epi32(*str, 4), nibble_mask);
+  const __m256i lo_nibbles = _mm256_and_si256(*str, nibble_mask);
+  const __m256i hi = _mm256_shuffle_epi8(lut_hi, hi_nibbles);
+  const __m256i lo = _mm256_shuffle_epi8(lut_lo, lo_nibbles);
+  if (!_mm256_testz_si256(lo, hi))
+    return false;
+
+  const __m256i eq_slash = _mm256_cmpeq_epi8(*str, _mm256_set1_epi8('/'));
+  const __m256i roll =
+      _mm256_shuffle_epi8(lut_roll, _mm256_add_epi8(eq_slash, hi_nibbles));
+  *str = _mm256_add_epi8(*str, roll);
+  return true;
+}
+
+
+// Leaves the 24 bytes of output at the start of the vector.
+NODE_SIMD_AVX2
+static inline __m256i DecodePack(__m256i in) {
+  const __m256i ab_bc =
+      _mm256_maddubs_epi16(in, _mm256_set1_epi32(0x01400140));
+  const __m256i out = _mm256_madd_epi16(ab_bc, _mm256_set1_epi32(0x00011000));
+  const __m256i packed = _mm256_shuffle_epi8(out, _mm256_setr_epi8(
+      2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+      2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+  return _mm256_permutevar8x32_epi32(packed,
+                                     _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 0, 0));
+}
+
+
+// Loads 16 or 32 characters. Two byte characters are narrowed with unsigned
+// saturation, anything above 0xFF becomes 0xFF or 0x00, which are invalid
+// and make the kernel hand over to the scalar code.
+NODE_SIMD_SSSE3
+static inline __m128i Load16(const uint8_t* src) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+}
+
+
+NODE_SIMD_SSSE3
+static inline __m128i Load16(const uint16_t* src) {
+  const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+  const __m128i hi =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 8));
+  return _mm_packus_epi16(lo, hi);
+}
+
+
+NODE_SIMD_AVX2
+static inline __m256i Load32(const uint8_t* src) {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+}
+
+
+NODE_SIMD_AVX2
+static inline __m256i Load32(const uint16_t* src) {
+  const __m256i lo =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+  const __m256i hi =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 16));
+  // packus works per 128 bit lane, put the quarters back in order.
+  return _mm256_permute4x64_epi64(_mm256_packus_epi16(lo, hi), 0xD8);
+}
+
+
+// The stores write exactly the decoded bytes, the bytes after them belong
+// to the caller and may not be touched.
+template <typename TypeName>
+NODE_SIMD_SSSE3
+static size_t DecodeSSSE3(char* dst, size_t dstlen,
+                          const TypeName* src, size_t srclen) {
+  size_t i = 0;
+  size_t k = 0;
+  while (i + 16 <= srclen && k + 12 <= dstlen) {
+    __m128i str = Load16(src + i);
+    if (!DecodeTranslate(&str))
+      break;
+    const __m128i out = DecodePack(str);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + k), out);
+    const uint32_t tail = _mm_cvtsi128_si32(_mm_srli_si128(out, 8));
+    memcpy(dst + k + 8, &tail, sizeof(tail));
+    i += 16;
+    k += 12;
+  }
+  return i;
+}
+
+
+template <typename TypeName>
+NODE_SIMD_AVX2
+static size_t DecodeAVX2(char* dst, size_t dstlen,
+                         const TypeName* src, size_t srclen) {
+  size_t i = 0;
+  size_t k = 0;
+  while (i + 32 <= srclen && k + 24 <= dstlen) {
+    __m256i str = Load32(src + i);
+    if (!DecodeTranslate(&str))
+      break;
+    const __m256i out = DecodePack(str);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + k),
+                     _mm256_castsi256_si128(out));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + k + 16),
+                     _mm256_extracti128_si256(out, 1));
+    i += 32;
+    k += 24;
+  }
+  // Finish with the narrower kernel. When the loop stopped at a character
+  // that is not plain base64, it still decodes the block up to it, if that
+  // is in the second half.
+  return i + DecodeSSSE3(dst + k, dstlen - k, src + i, srclen - i);
+}
+
+
+template <typename TypeName>
+static size_t DecodeVector(char* dst, size_t dstlen,
+                           const TypeName* src, size_t srclen) {
+  switch (simd::level()) {
+    case simd::kAVX2:
+      return DecodeAVX2(dst, dstlen, src, srclen);
+    case simd::kSSSE3:
+      return DecodeSSSE3(dst, dstlen, src, srclen);
+    default:
+      return 0;
+  }
+}
+
+
+size_t base64_encode_vector(const char* src, size_t slen, char* dst) {
+  switch (simd::level()) {
+    case simd::kAVX2: {
+      const size_t i = EncodeAVX2(src, slen, dst);
+      return i + EncodeSSSE3(src + i, slen - i, dst + i / 3 * 4);
+    }
+    case simd::kSSSE3:
+      return EncodeSSSE3(src, slen, dst);
+    default:
+      return 0;
+  }
+}
+
+
+size_t base64_decode_vector(char* dst, size_t dstlen,
+                            const uint8_t* src, size_t srclen) {
+  return DecodeVector(dst, dstlen, src, srclen);
+}
+
+
+size_t base64_decode_vector(char* dst, size_t dstlen,
+                            const uint16_t* src, size_t srclen) {
+  return DecodeVector(dst, dstlen, src, srclen);
+}
+
+#else  // !NODE_SIMD_X86
+
+size_t base64_encode_vector(const char* src, size_t slen, char* dst) {
+  return 0;
+}
+
+
+size_t base64_decode_vector(char* dst, size_t dstlen,
+                            const uint8_t* src, size_t srclen) {
+  return 0;
+}
+
+
+size_t base64_decode_vector(char* dst, size_t dstlen,
+                            const uint16_t* src, size_t srclen) {
+  return 0;
+}
+
+#endif  // NODE_SIMD_X86
+
+}  // namespace node
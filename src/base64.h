@@ -47,6 +47,32 @@ size_t base64_decoded_size(const TypeName* src, size_t size) {
 extern const int8_t unbase64_table[256];
 
 
+// SSSE3 and AVX2 kernels for long inputs, picked at runtime, see base64.cc.
+// They only handle whole blocks of input and return how many bytes or
+// characters of |src| they have consumed, the scalar code below does the
+// rest. Decoding stops at the first block with characters outside of the
+// standard alphabet, like whitespace, padding or URL-safe base64, and never
+// writes more than |dstlen| bytes. They return 0 when the CPU supports
+// neither instruction set.
+size_t base64_encode_vector(const char* src, size_t slen, char* dst);
+size_t base64_decode_vector(char* dst, size_t dstlen,
+                            const uint8_t* src, size_t srclen);
+size_t base64_decode_vector(char* dst, size_t dstlen,
+                            const uint16_t* src, size_t srclen);
+
+inline size_t base64_decode_vector(char* dst, size_t dstlen,
+                                   const char* src, size_t srclen) {
+  return base64_decode_vector(dst, dstlen,
+                              reinterpret_cast<const uint8_t*>(src), srclen);
+}
+
+template <typename TypeName>
+inline size_t base64_decode_vector(char* dst, size_t dstlen,
+                                   const TypeName* src, size_t srclen) {
+  return 0;
+}
+
+
 #define unbase64(x)                                                           \
   static_cast<uint8_t>(unbase64_table[static_cast<uint8_t>(x)])
 
@@ -92,8 +118,8 @@ size_t base64_decode_fast(char* const dst, const size_t dstlen,
   const size_t available = dstlen < decoded_size ? dstlen : decoded_size;
   const size_t max_i = srclen / 4 * 4;
   const size_t max_k = available / 3 * 3;
-  size_t i = 0;
-  size_t k = 0;
+  size_t i = base64_decode_vector(dst, max_k, src, srclen);
+  size_t k = i / 4 * 3;
   while (i < max_i && k < max_k) {
     const uint32_t v =
         unbase64(src[i + 0]) << 24 |
@@ -145,8 +171,8 @@ static size_t base64_encode(const char* src,
                               "abcdefghijklmnopqrstuvwxyz"
                               "0123456789+/";
 
-  i = 0;
-  k = 0;
+  i = base64_encode_vector(src, slen, dst);
+  k = i / 3 * 4;
   n = slen / 3 * 3;
 
   while (i < n) {
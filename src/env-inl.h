@@ -12,6 +12,7 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
 namespace node {
 
@@ -49,7 +50,27 @@ inline IsolateData::IsolateData(v8::Isolate* isolate, uv_loop_t* event_loop,
             sizeof(StringValue) - 1).ToLocalChecked()),
     PER_ISOLATE_STRING_PROPERTIES(V)
 #undef V
-    event_loop_(event_loop), zero_fill_field_(zero_fill_field) {}
+    event_loop_(event_loop), zero_fill_field_(zero_fill_field) {
+#define V(Name) Name,
+  static const char* const header_names[] = {
+    PER_ISOLATE_HTTP_HEADER_NAMES(V)
+  };
+#undef V
+  for (size_t i = 0; i < kHttpHeaderNameCount; i++) {
+    const char* name = header_names[i];
+    const size_t length = strlen(name);
+    char lowercase[64];
+    CHECK_LE(length, sizeof(lowercase));
+    for (size_t k = 0; k < length; k++)
+      lowercase[k] = ToLower(name[k]);
+    http_header_names_[i].Set(isolate, v8::String::NewFromOneByte(
+        isolate, reinterpret_cast<const uint8_t*>(name),
+        v8::NewStringType::kInternalized, length).ToLocalChecked());
+    lowercase_http_header_names_[i].Set(isolate, v8::String::NewFromOneByte(
+        isolate, reinterpret_cast<const uint8_t*>(lowercase),
+        v8::NewStringType::kInternalized, length).ToLocalChecked());
+  }
+}
 
 inline uv_loop_t* IsolateData::event_loop() const {
   return event_loop_;
@@ -59,6 +80,19 @@ inline uint32_t* IsolateData::zero_fill_field() const {
   return zero_fill_field_;
 }
 
+inline v8::Local<v8::String> IsolateData::http_header_name(
+    v8::Isolate* isolate, size_t index) const {
+  CHECK_LT(index, kHttpHeaderNameCount);
+  return const_cast<IsolateData*>(this)->http_header_names_[index].Get(isolate);
+}
+
+inline v8::Local<v8::String> IsolateData::lowercase_http_header_name(
+    v8::Isolate* isolate, size_t index) const {
+  CHECK_LT(index, kHttpHeaderNameCount);
+  return const_cast<IsolateData*>(this)->
+      lowercase_http_header_names_[index].Get(isolate);
+}
+
 inline Environment::AsyncHooks::AsyncHooks() {
   for (int i = 0; i < kFieldsCount; i++) fields_[i] = 0;
 }
@@ -170,6 +204,8 @@ inline Environment::Environment(IsolateData* isolate_data,
       using_domains_(false),
       printed_error_(false),
       trace_sync_io_(false),
+      worker_context_(nullptr),
+      stopping_worker_(false),
       makecallback_cntr_(0),
       async_wrap_uid_(0),
       debugger_agent_(this),
@@ -178,6 +214,7 @@ inline Environment::Environment(IsolateData* isolate_data,
 #endif
       handle_cleanup_waiting_(0),
       http_parser_buffer_(nullptr),
+      read_buffer_pool_(this),
       context_(context->GetIsolate(), context) {
   // We'll be creating new objects so make sure we've entered the context.
   v8::HandleScope handle_scope(isolate());
@@ -201,14 +238,7 @@ inline Environment::Environment(IsolateData* isolate_data,
 inline Environment::~Environment() {
   v8::HandleScope handle_scope(isolate());
 
-  while (HandleCleanup* hc = handle_cleanup_queue_.PopFront()) {
-    handle_cleanup_waiting_++;
-    hc->cb_(this, hc->handle_, hc->arg_);
-    delete hc;
-  }
-
-  while (handle_cleanup_waiting_ != 0)
-    uv_run(event_loop(), UV_RUN_ONCE);
+  CleanupHandles();
 
   context()->SetAlignedPointerInEmbedderData(kContextEmbedderDataIndex,
                                              nullptr);
@@ -219,6 +249,8 @@ inline Environment::~Environment() {
   delete[] heap_statistics_buffer_;
   delete[] heap_space_statistics_buffer_;
   delete[] http_parser_buffer_;
+  for (char* data : tls_free_buffers_)
+    delete[] data;
 }
 
 inline v8::Isolate* Environment::isolate() const {
@@ -264,6 +296,17 @@ inline void Environment::RegisterHandleCleanup(uv_handle_t* handle,
   handle_cleanup_queue_.PushBack(new HandleCleanup(handle, cb, arg));
 }
 
+inline void Environment::CleanupHandles() {
+  while (HandleCleanup* hc = handle_cleanup_queue_.PopFront()) {
+    handle_cleanup_waiting_++;
+    hc->cb_(this, hc->handle_, hc->arg_);
+    delete hc;
+  }
+
+  while (handle_cleanup_waiting_ != 0)
+    uv_run(event_loop(), UV_RUN_ONCE);
+}
+
 inline void Environment::FinishHandleCleanup(uv_handle_t* handle) {
   handle_cleanup_waiting_--;
 }
@@ -308,6 +351,27 @@ inline void Environment::set_trace_sync_io(bool value) {
   trace_sync_io_ = value;
 }
 
+inline worker::Worker* Environment::worker_context() const {
+  return worker_context_;
+}
+
+inline void Environment::set_worker_context(worker::Worker* context) {
+  worker_context_ = context;
+}
+
+inline bool Environment::is_main_thread() const {
+  return worker_context_ == nullptr;
+}
+
+inline bool Environment::is_stopping_worker() const {
+  return stopping_worker_;
+}
+
+inline void Environment::set_stopping_worker() {
+  CHECK(!is_main_thread());
+  stopping_worker_ = true;
+}
+
 inline int64_t Environment::get_async_wrap_uid() {
   return ++async_wrap_uid_;
 }
@@ -346,6 +410,14 @@ inline void Environment::set_http_parser_buffer(char* buffer) {
   http_parser_buffer_ = buffer;
 }
 
+inline ReadBufferPool* Environment::read_buffer_pool() {
+  return &read_buffer_pool_;
+}
+
+inline std::vector<char*>* Environment::tls_free_buffers() {
+  return &tls_free_buffers_;
+}
+
 inline Environment* Environment::from_cares_timer_handle(uv_timer_t* handle) {
   return ContainerOf(&Environment::cares_timer_handle_, handle);
 }
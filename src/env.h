@@ -9,6 +9,7 @@
 #include "inspector_agent.h"
 #endif
 #include "handle_wrap.h"
+#include "read_buffer_pool.h"
 #include "req-wrap.h"
 #include "tree.h"
 #include "util.h"
@@ -133,6 +134,7 @@ namespace node {
   V(kill_signal_string, "killSignal")                                         \
   V(mac_string, "mac")                                                        \
   V(max_buffer_string, "maxBuffer")                                           \
+  V(message_header_string, "messageHeader")                                   \
   V(message_string, "message")                                                \
   V(minttl_string, "minttl")                                                  \
   V(model_string, "model")                                                    \
@@ -176,6 +178,7 @@ namespace node {
   V(priority_string, "priority")                                              \
   V(produce_cached_data_string, "produceCachedData")                          \
   V(raw_string, "raw")                                                        \
+  V(read_host_object_string, "_readHostObject")                               \
   V(readable_string, "readable")                                              \
   V(received_shutdown_string, "receivedShutdown")                             \
   V(refresh_string, "refresh")                                                \
@@ -223,10 +226,112 @@ namespace node {
   V(windows_verbatim_arguments_string, "windowsVerbatimArguments")            \
   V(wrap_string, "wrap")                                                      \
   V(writable_string, "writable")                                              \
+  V(write_host_object_string, "_writeHostObject")                             \
   V(write_queue_size_string, "writeQueueSize")                                \
   V(x_forwarded_string, "x-forwarded-for")                                    \
   V(zero_return_string, "ZERO_RETURN")                                        \
 
+// Header names that the HTTP parser binding turns into per-isolate interned
+// strings instead of creating new ones for every message, in their usual
+// spelling. Lookups ignore case, see node_http_parser.cc.
+#define PER_ISOLATE_HTTP_HEADER_NAMES(V)                                      \
+  V("Accept")                                                                 \
+  V("Accept-Charset")                                                         \
+  V("Accept-Encoding")                                                        \
+  V("Accept-Language")                                                        \
+  V("Accept-Patch")                                                           \
+  V("Accept-Ranges")                                                          \
+  V("Access-Control-Allow-Credentials")                                       \
+  V("Access-Control-Allow-Headers")                                           \
+  V("Access-Control-Allow-Methods")                                           \
+  V("Access-Control-Allow-Origin")                                            \
+  V("Access-Control-Expose-Headers")                                          \
+  V("Access-Control-Max-Age")                                                 \
+  V("Access-Control-Request-Headers")                                         \
+  V("Access-Control-Request-Method")                                          \
+  V("Age")                                                                    \
+  V("Allow")                                                                  \
+  V("Alt-Svc")                                                                \
+  V("Authorization")                                                          \
+  V("Cache-Control")                                                          \
+  V("Connection")                                                             \
+  V("Content-Disposition")                                                    \
+  V("Content-Encoding")                                                       \
+  V("Content-Language")                                                       \
+  V("Content-Length")                                                         \
+  V("Content-Location")                                                       \
+  V("Content-MD5")                                                            \
+  V("Content-Range")                                                          \
+  V("Content-Security-Policy")                                                \
+  V("Content-Type")                                                           \
+  V("Cookie")                                                                 \
+  V("DNT")                                                                    \
+  V("Date")                                                                   \
+  V("ETag")                                                                   \
+  V("Expect")                                                                 \
+  V("Expires")                                                                \
+  V("Forwarded")                                                              \
+  V("From")                                                                   \
+  V("Host")                                                                   \
+  V("If-Match")                                                               \
+  V("If-Modified-Since")                                                      \
+  V("If-None-Match")                                                          \
+  V("If-Range")                                                               \
+  V("If-Unmodified-Since")                                                    \
+  V("Keep-Alive")                                                             \
+  V("Last-Event-ID")                                                          \
+  V("Last-Modified")                                                          \
+  V("Link")                                                                   \
+  V("Location")                                                               \
+  V("Max-Forwards")                                                           \
+  V("Origin")                                                                 \
+  V("P3P")                                                                    \
+  V("Pragma")                                                                 \
+  V("Proxy-Authenticate")                                                     \
+  V("Proxy-Authorization")                                                    \
+  V("Proxy-Connection")                                                       \
+  V("Public-Key-Pins")                                                        \
+  V("Range")                                                                  \
+  V("Referer")                                                                \
+  V("Refresh")                                                                \
+  V("Retry-After")                                                            \
+  V("Sec-WebSocket-Accept")                                                   \
+  V("Sec-WebSocket-Extensions")                                               \
+  V("Sec-WebSocket-Key")                                                      \
+  V("Sec-WebSocket-Protocol")                                                 \
+  V("Sec-WebSocket-Version")                                                  \
+  V("Server")                                                                 \
+  V("Set-Cookie")                                                             \
+  V("Strict-Transport-Security")                                              \
+  V("TE")                                                                     \
+  V("Timing-Allow-Origin")                                                    \
+  V("Trailer")                                                                \
+  V("Transfer-Encoding")                                                      \
+  V("Upgrade")                                                                \
+  V("Upgrade-Insecure-Requests")                                              \
+  V("User-Agent")                                                             \
+  V("Vary")                                                                   \
+  V("Via")                                                                    \
+  V("WWW-Authenticate")                                                       \
+  V("Warning")                                                                \
+  V("X-Content-Type-Options")                                                 \
+  V("X-Correlation-ID")                                                       \
+  V("X-CSRF-Token")                                                           \
+  V("X-DNS-Prefetch-Control")                                                 \
+  V("X-Forwarded-For")                                                        \
+  V("X-Forwarded-Host")                                                       \
+  V("X-Forwarded-Port")                                                       \
+  V("X-Forwarded-Proto")                                                      \
+  V("X-Frame-Options")                                                        \
+  V("X-HTTP-Method-Override")                                                 \
+  V("X-Powered-By")                                                           \
+  V("X-Real-IP")                                                              \
+  V("X-Request-ID")                                                           \
+  V("X-Requested-With")                                                       \
+  V("X-Response-Time")                                                        \
+  V("X-UA-Compatible")                                                        \
+  V("X-XSS-Protection")                                                       \
+
 #define ENVIRONMENT_STRONG_PERSISTENT_PROPERTIES(V)                           \
   V(as_external, v8::External)                                                \
   V(async_hooks_destroy_function, v8::Function)                               \
@@ -276,6 +381,18 @@ class IsolateData {
   inline uv_loop_t* event_loop() const;
   inline uint32_t* zero_fill_field() const;
 
+#define V(Name) + 1
+  static const size_t kHttpHeaderNameCount =
+      0 PER_ISOLATE_HTTP_HEADER_NAMES(V);
+#undef V
+
+  // The index-th name from PER_ISOLATE_HTTP_HEADER_NAMES, as spelled there
+  // and in lowercase.
+  inline v8::Local<v8::String> http_header_name(v8::Isolate* isolate,
+                                                size_t index) const;
+  inline v8::Local<v8::String> lowercase_http_header_name(
+      v8::Isolate* isolate, size_t index) const;
+
 #define VP(PropertyName, StringValue) V(v8::Private, PropertyName)
 #define VS(PropertyName, StringValue) V(v8::String, PropertyName)
 #define V(TypeName, PropertyName)                                             \
@@ -297,12 +414,19 @@ class IsolateData {
 #undef VS
 #undef VP
 
+  v8::Eternal<v8::String> http_header_names_[kHttpHeaderNameCount];
+  v8::Eternal<v8::String> lowercase_http_header_names_[kHttpHeaderNameCount];
+
   uv_loop_t* const event_loop_;
   uint32_t* const zero_fill_field_;
 
   DISALLOW_COPY_AND_ASSIGN(IsolateData);
 };
 
+namespace worker {
+class Worker;
+}  // namespace worker
+
 class Environment {
  public:
   class AsyncHooks {
@@ -442,6 +566,9 @@ class Environment {
                                     HandleCleanupCb cb,
                                     void *arg);
   inline void FinishHandleCleanup(uv_handle_t* handle);
+  // Closes the handles registered with RegisterHandleCleanup() and waits
+  // for them. Runs from the destructor, or earlier when a worker stops.
+  inline void CleanupHandles();
 
   inline AsyncHooks* async_hooks();
   inline DomainFlag* domain_flag();
@@ -464,6 +591,16 @@ class Environment {
   void PrintSyncTrace() const;
   inline void set_trace_sync_io(bool value);
 
+  // The Worker that runs this environment on its own thread, nullptr for
+  // the environment on the main thread. See src/node_worker.h.
+  inline worker::Worker* worker_context() const;
+  inline void set_worker_context(worker::Worker* context);
+  inline bool is_main_thread() const;
+
+  // Set when a worker is being torn down, no JS land code runs after that.
+  inline bool is_stopping_worker() const;
+  inline void set_stopping_worker();
+
   inline int64_t get_async_wrap_uid();
 
   // List of id's that have been destroyed and need the destroy() cb called.
@@ -478,6 +615,12 @@ class Environment {
   inline char* http_parser_buffer() const;
   inline void set_http_parser_buffer(char* buffer);
 
+  inline ReadBufferPool* read_buffer_pool();
+
+  // Released TLS record buffers that are kept for reuse, see
+  // node_crypto_bio.cc.
+  inline std::vector<char*>* tls_free_buffers();
+
   inline void ThrowError(const char* errmsg);
   inline void ThrowTypeError(const char* errmsg);
   inline void ThrowRangeError(const char* errmsg);
@@ -567,6 +710,8 @@ class Environment {
   bool using_domains_;
   bool printed_error_;
   bool trace_sync_io_;
+  worker::Worker* worker_context_;
+  bool stopping_worker_;
   size_t makecallback_cntr_;
   int64_t async_wrap_uid_;
   std::vector<int64_t> destroy_ids_list_;
@@ -586,6 +731,10 @@ class Environment {
 
   char* http_parser_buffer_;
 
+  ReadBufferPool read_buffer_pool_;
+
+  std::vector<char*> tls_free_buffers_;
+
 #define V(PropertyName, TypeName)                                             \
   v8::Persistent<TypeName> PropertyName ## _;
   ENVIRONMENT_STRONG_PERSISTENT_PROPERTIES(V)
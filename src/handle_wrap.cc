@@ -42,6 +42,16 @@ void HandleWrap::HasRef(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+void HandleWrap::Close() {
+  if (state_ != kInitialized)
+    return;
+
+  CHECK_EQ(false, persistent().IsEmpty());
+  uv_close(handle_, OnClose);
+  state_ = kClosing;
+}
+
+
 void HandleWrap::Close(const FunctionCallbackInfo<Value>& args) {
   Environment* env = Environment::GetCurrent(args);
 
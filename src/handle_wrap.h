@@ -49,6 +49,10 @@ class HandleWrap : public AsyncWrap {
 
   inline uv_handle_t* GetHandle() const { return handle_; }
 
+  // Closes the handle without a JS close callback, used when an
+  // environment is torn down while handles are still open.
+  void Close();
+
  protected:
   HandleWrap(Environment* env,
              v8::Local<v8::Object> object,
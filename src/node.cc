@@ -8,6 +8,8 @@
 #include "node_internals.h"
 #include "node_revert.h"
 #include "node_debug_options.h"
+#include "node_snapshot.h"
+#include "node_worker.h"
 
 #if defined HAVE_PERFCTR
 #include "node_counters.h"
@@ -138,6 +140,7 @@ static bool trace_deprecation = false;
 static bool throw_deprecation = false;
 static bool trace_sync_io = false;
 static bool track_heap_objects = false;
+static bool no_node_snapshot = false;
 static const char* eval_string = nullptr;
 static unsigned int preload_module_count = 0;
 static const char** preload_modules = nullptr;
@@ -177,6 +180,11 @@ bool trace_warnings = false;
 // that is used by lib/module.js
 bool config_preserve_symlinks = false;
 
+// Set in node.cc by ParseArgs when --trace-native-module-load is used.
+// Used in node_config.cc to set a constant on process.binding('config')
+// that is used by lib/internal/bootstrap_node.js
+bool config_trace_native_module_load = false;
+
 bool v8_initialized = false;
 
 // process-relative uptime base, initialized at start-up
@@ -1166,6 +1174,9 @@ Local<Value> MakeCallback(Environment* env,
   // If you hit this assertion, you forgot to enter the v8::Context first.
   CHECK_EQ(env->context(), env->isolate()->GetCurrentContext());
 
+  if (env->is_stopping_worker())
+    return Undefined(env->isolate());
+
   Local<Function> pre_fn = env->async_hooks_pre_function();
   Local<Function> post_fn = env->async_hooks_post_function();
   Local<Object> object, domain;
@@ -2203,7 +2214,11 @@ static void WaitForInspectorDisconnect(Environment* env) {
 
 
 void Exit(const FunctionCallbackInfo<Value>& args) {
-  WaitForInspectorDisconnect(Environment::GetCurrent(args));
+  Environment* env = Environment::GetCurrent(args);
+  if (!env->is_main_thread())
+    return env->worker_context()->Exit(args[0]->Int32Value());
+  worker::Worker::StopAllWorkers();
+  WaitForInspectorDisconnect(env);
   exit(args[0]->Int32Value());
 }
 
@@ -2503,12 +2518,19 @@ void FatalException(Isolate* isolate,
     }
 
     if (exit_code == 0 && false == caught->BooleanValue()) {
-      ReportException(env, error, message);
+      // A worker hands uncaught exceptions to its parent thread, which
+      // emits them as 'error' events on the Worker object.
+      if (env->is_main_thread())
+        ReportException(env, error, message);
       exit_code = 1;
     }
   }
 
   if (exit_code) {
+    if (!env->is_main_thread()) {
+      env->worker_context()->Exit(exit_code);
+      return;
+    }
 #if HAVE_INSPECTOR
     if (debug_options.inspector_enabled()) {
       env->inspector_agent()->FatalException(error, message);
@@ -3407,7 +3429,25 @@ void LoadEnvironment(Environment* env) {
   // 'internal_bootstrap_node_native' is the string containing that source code.
   Local<String> script_name = FIXED_ONE_BYTE_STRING(env->isolate(),
                                                     "bootstrap_node.js");
-  Local<Value> f_value = ExecuteString(env, MainSource(env), script_name);
+  Local<Value> f_value;
+
+  // When the context comes from the startup snapshot the bootstrap function
+  // and the core module wrappers are already compiled. Take them off the
+  // global object before any JS runs and hand them to bootstrap_node.js.
+  Local<Object> global = env->context()->Global();
+  Local<String> natives_key =
+      FIXED_ONE_BYTE_STRING(env->isolate(), NODE_SNAPSHOT_NATIVES_KEY);
+  Local<Value> natives = global->Get(natives_key);
+  if (natives->IsObject()) {
+    global->Delete(env->context(), natives_key).FromJust();
+    f_value = natives.As<Object>()->Get(
+        FIXED_ONE_BYTE_STRING(env->isolate(), "internal/bootstrap_node"));
+    env->process_object()->Set(
+        FIXED_ONE_BYTE_STRING(env->isolate(), "_precompiledNatives"),
+        natives);
+  } else {
+    f_value = ExecuteString(env, MainSource(env), script_name);
+  }
   if (try_catch.HasCaught())  {
     ReportException(env, try_catch);
     exit(10);
@@ -3416,9 +3456,6 @@ void LoadEnvironment(Environment* env) {
   CHECK(f_value->IsFunction());
   Local<Function> f = Local<Function>::Cast(f_value);
 
-  // Add a reference to the global object
-  Local<Object> global = env->context()->Global();
-
 #if defined HAVE_DTRACE || defined HAVE_ETW
   InitDTrace(env, global);
 #endif
@@ -3480,8 +3517,13 @@ static void PrintHelp() {
          "                        is detected after the first tick\n"
          "  --track-heap-objects  track heap object allocations for heap "
          "snapshots\n"
+         "  --trace-native-module-load\n"
+         "                        print a line for every core module that\n"
+         "                        is loaded and how it was compiled\n"
          "  --prof-process        process v8 profiler output generated\n"
          "                        using --prof\n"
+         "  --no-node-snapshot    compile the core modules at startup even\n"
+         "                        if node was built with a startup snapshot\n"
          "  --zero-fill-buffers   automatically zero-fill all newly allocated\n"
          "                        Buffer and SlowBuffer instances\n"
          "  --v8-options          print v8 command line options\n"
@@ -3628,6 +3670,8 @@ static void ParseArgs(int* argc,
       trace_sync_io = true;
     } else if (strcmp(arg, "--track-heap-objects") == 0) {
       track_heap_objects = true;
+    } else if (strcmp(arg, "--trace-native-module-load") == 0) {
+      config_trace_native_module_load = true;
     } else if (strcmp(arg, "--throw-deprecation") == 0) {
       throw_deprecation = true;
     } else if (strncmp(arg, "--security-revert=", 18) == 0) {
@@ -3638,6 +3682,8 @@ static void ParseArgs(int* argc,
     } else if (strcmp(arg, "--prof-process") == 0) {
       prof_process = true;
       short_circuit = true;
+    } else if (strcmp(arg, "--no-node-snapshot") == 0) {
+      no_node_snapshot = true;
     } else if (strcmp(arg, "--zero-fill-buffers") == 0) {
       zero_fill_all_buffers = true;
     } else if (strcmp(arg, "--v8-options") == 0) {
@@ -4170,6 +4216,10 @@ void Init(int* argc,
   }
 #endif
 
+  // Submit file system requests through io_uring where libuv supports it,
+  // the option is not available everywhere.
+  uv_loop_configure(uv_default_loop(), UV_LOOP_USE_IO_URING);
+
 #if defined(NODE_HAVE_I18N_SUPPORT)
   if (icu_data_dir == nullptr) {
     // if the parameter isn't given, use the env variable.
@@ -4277,8 +4327,12 @@ int EmitExit(Environment* env) {
 
   MakeCallback(env, process_object, "emit", arraysize(args), args);
 
-  // Reload exit code, it may be changed by `emit('exit')`
-  return process_object->Get(exitCode)->Int32Value();
+  // Reload exit code, it may be changed by `emit('exit')`. The lookup fails
+  // when a worker calls process.exit() from an 'exit' listener.
+  Local<Value> code_v;
+  if (process_object->Get(env->context(), exitCode).ToLocal(&code_v))
+    code = code_v->Int32Value(env->context()).FromMaybe(code);
+  return code;
 }
 
 
@@ -4312,11 +4366,49 @@ void FreeEnvironment(Environment* env) {
 }
 
 
+void SetIsolateUpForNode(Isolate* isolate) {
+  isolate->AddMessageListener(OnMessage);
+  isolate->SetAbortOnUncaughtExceptionCallback(ShouldAbortOnUncaughtException);
+  isolate->SetAutorunMicrotasks(false);
+  isolate->SetFatalErrorHandler(OnFatalError);
+}
+
+
+void SpinEventLoop(Environment* env) {
+  Isolate* isolate = env->isolate();
+  SealHandleScope seal(isolate);
+  bool more;
+  do {
+    v8_platform.PumpMessageLoop(isolate);
+    more = uv_run(env->event_loop(), UV_RUN_ONCE);
+    if (env->is_stopping_worker())
+      break;
+
+    if (more == false) {
+      v8_platform.PumpMessageLoop(isolate);
+      EmitBeforeExit(env);
+
+      // Emit `beforeExit` if the loop became alive either after emitting
+      // event, or after running some callbacks.
+      more = uv_loop_alive(env->event_loop());
+      if (uv_run(env->event_loop(), UV_RUN_NOWAIT) != 0)
+        more = true;
+    }
+  } while (more == true && !env->is_stopping_worker());
+}
+
+
 inline int Start(Isolate* isolate, IsolateData* isolate_data,
                  int argc, const char* const* argv,
                  int exec_argc, const char* const* exec_argv) {
   HandleScope handle_scope(isolate);
-  Local<Context> context = Context::New(isolate);
+  Local<Context> context;
+  if (no_node_snapshot ||
+      NodeSnapshotBlob() == nullptr ||
+      !Context::FromSnapshot(isolate,
+                             kNodeSnapshotContextIndex).ToLocal(&context)) {
+    context = Context::New(isolate);
+  }
   Context::Scope context_scope(context);
   Environment env(isolate_data, context);
   env.Start(argc, argv, exec_argc, exec_argv, v8_is_profiling);
@@ -4343,29 +4435,12 @@ inline int Start(Isolate* isolate, IsolateData* isolate_data,
   if (debug_enabled)
     EnableDebug(&env);
 
-  {
-    SealHandleScope seal(isolate);
-    bool more;
-    do {
-      v8_platform.PumpMessageLoop(isolate);
-      more = uv_run(env.event_loop(), UV_RUN_ONCE);
-
-      if (more == false) {
-        v8_platform.PumpMessageLoop(isolate);
-        EmitBeforeExit(&env);
-
-        // Emit `beforeExit` if the loop became alive either after emitting
-        // event, or after running some callbacks.
-        more = uv_loop_alive(env.event_loop());
-        if (uv_run(env.event_loop(), UV_RUN_NOWAIT) != 0)
-          more = true;
-      }
-    } while (more == true);
-  }
+  SpinEventLoop(&env);
 
   env.set_trace_sync_io(false);
 
   const int exit_code = EmitExit(&env);
+  worker::Worker::StopAllWorkers();
   RunAtExit(&env);
 
   WaitForInspectorDisconnect(&env);
@@ -4382,6 +4457,8 @@ inline int Start(uv_loop_t* event_loop,
   Isolate::CreateParams params;
   ArrayBufferAllocator allocator;
   params.array_buffer_allocator = &allocator;
+  if (!no_node_snapshot)
+    params.snapshot_blob = NodeSnapshotBlob();
 #ifdef NODE_ENABLE_VTUNE_PROFILING
   params.code_event_handler = vTune::GetVtuneCodeEventHandler();
 #endif
@@ -4390,10 +4467,7 @@ inline int Start(uv_loop_t* event_loop,
   if (isolate == nullptr)
     return 12;  // Signal internal error.
 
-  isolate->AddMessageListener(OnMessage);
-  isolate->SetAbortOnUncaughtExceptionCallback(ShouldAbortOnUncaughtException);
-  isolate->SetAutorunMicrotasks(false);
-  isolate->SetFatalErrorHandler(OnFatalError);
+  SetIsolateUpForNode(isolate);
 
   if (track_heap_objects) {
     isolate->GetHeapProfiler()->StartTrackingHeapObjects(true);
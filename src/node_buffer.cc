@@ -3,6 +3,7 @@
 
 #include "env.h"
 #include "env-inl.h"
+#include "simd.h"
 #include "string_bytes.h"
 #include "string_search.h"
 #include "util.h"
@@ -49,6 +50,7 @@ namespace Buffer {
 
 using v8::ArrayBuffer;
 using v8::ArrayBufferCreationMode;
+using v8::ArrayBufferView;
 using v8::Context;
 using v8::EscapableHandleScope;
 using v8::FunctionCallbackInfo;
@@ -59,6 +61,7 @@ using v8::Maybe;
 using v8::MaybeLocal;
 using v8::Object;
 using v8::Persistent;
+using v8::SharedArrayBuffer;
 using v8::String;
 using v8::Uint32Array;
 using v8::Uint8Array;
@@ -412,6 +415,24 @@ MaybeLocal<Object> New(Environment* env, char* data, size_t length) {
 }
 
 
+MaybeLocal<Object> New(Environment* env,
+                       Local<ArrayBuffer> ab,
+                       size_t byte_offset,
+                       size_t length) {
+  EscapableHandleScope scope(env->isolate());
+
+  CHECK_LE(byte_offset, ab->ByteLength());
+  CHECK_LE(length, ab->ByteLength() - byte_offset);
+
+  Local<Uint8Array> ui = Uint8Array::New(ab, byte_offset, length);
+  Maybe<bool> mb =
+      ui->SetPrototype(env->context(), env->buffer_prototype_object());
+  if (mb.FromMaybe(false))
+    return scope.Escape(ui);
+  return Local<Object>();
+}
+
+
 void CreateFromString(const FunctionCallbackInfo<Value>& args) {
   CHECK(args[0]->IsString());
   CHECK(args[1]->IsString());
@@ -1181,6 +1202,44 @@ void Swap64(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+// The JS side makes sure that |value| is an ArrayBuffer, a SharedArrayBuffer
+// or a view on one.
+static void SpreadBytes(Local<Value> value, const char** data, size_t* length) {
+  if (value->IsArrayBufferView()) {
+    Local<ArrayBufferView> view = value.As<ArrayBufferView>();
+    ArrayBuffer::Contents contents = view->Buffer()->GetContents();
+    *data = static_cast<const char*>(contents.Data()) + view->ByteOffset();
+    *length = view->ByteLength();
+  } else if (value->IsArrayBuffer()) {
+    ArrayBuffer::Contents contents = value.As<ArrayBuffer>()->GetContents();
+    *data = static_cast<const char*>(contents.Data());
+    *length = contents.ByteLength();
+  } else {
+    CHECK(value->IsSharedArrayBuffer());
+    SharedArrayBuffer::Contents contents =
+        value.As<SharedArrayBuffer>()->GetContents();
+    *data = static_cast<const char*>(contents.Data());
+    *length = contents.ByteLength();
+  }
+}
+
+
+void IsAscii(const FunctionCallbackInfo<Value>& args) {
+  const char* data;
+  size_t length;
+  SpreadBytes(args[0], &data, &length);
+  args.GetReturnValue().Set(simd::IsAscii(data, length));
+}
+
+
+void IsUtf8(const FunctionCallbackInfo<Value>& args) {
+  const char* data;
+  size_t length;
+  SpreadBytes(args[0], &data, &length);
+  args.GetReturnValue().Set(simd::IsValidUtf8(data, length));
+}
+
+
 // pass Buffer object to load prototype methods
 void SetupBufferJS(const FunctionCallbackInfo<Value>& args) {
   Environment* env = Environment::GetCurrent(args);
@@ -1233,6 +1292,8 @@ void Initialize(Local<Object> target,
   env->SetMethod(target, "indexOfBuffer", IndexOfBuffer);
   env->SetMethod(target, "indexOfNumber", IndexOfNumber);
   env->SetMethod(target, "indexOfString", IndexOfString);
+  env->SetMethod(target, "isAscii", IsAscii);
+  env->SetMethod(target, "isUtf8", IsUtf8);
 
   env->SetMethod(target, "readDoubleBE", ReadDoubleBE);
   env->SetMethod(target, "readDoubleLE", ReadDoubleLE);
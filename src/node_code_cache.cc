@@ -0,0 +1,52 @@
+#include "node_code_cache.h"
+#include "node.h"
+#include "env.h"
+#include "env-inl.h"
+#include "util.h"
+#include "util-inl.h"
+
+#include <string.h>
+
+namespace node {
+
+using v8::ArrayBuffer;
+using v8::Context;
+using v8::FunctionCallbackInfo;
+using v8::Local;
+using v8::Object;
+using v8::Uint8Array;
+using v8::Value;
+
+// getCodeCache(id) returns the code cache of the native module |id| as a
+// Uint8Array that is consumed by NativeModule.prototype.compile() as
+// `cachedData`, or undefined when there is none. The caches live in read-only
+// memory and are shared by all isolates in the process, so every call hands
+// out a copy of its own instead of a view on the static data.
+static void GetCodeCache(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  CHECK(args[0]->IsString());
+  node::Utf8Value id(env->isolate(), args[0]);
+
+  for (const NativeCodeCache* it = NodeNativeCodeCache();
+       it->id != nullptr;
+       it++) {
+    if (strcmp(it->id, *id) != 0)
+      continue;
+    Local<ArrayBuffer> ab = ArrayBuffer::New(env->isolate(), it->length);
+    memcpy(ab->GetContents().Data(), it->data, it->length);
+    args.GetReturnValue().Set(Uint8Array::New(ab, 0, it->length));
+    return;
+  }
+}
+
+
+void InitCodeCache(Local<Object> target,
+                   Local<Value> unused,
+                   Local<Context> context) {
+  Environment* env = Environment::GetCurrent(context);
+  env->SetMethod(target, "getCodeCache", GetCodeCache);
+}
+
+}  // namespace node
+
+NODE_MODULE_CONTEXT_AWARE_BUILTIN(code_cache, node::InitCodeCache)
@@ -0,0 +1,29 @@
+#ifndef SRC_NODE_CODE_CACHE_H_
+#define SRC_NODE_CODE_CACHE_H_
+
+#if defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace node {
+
+// V8 code caches for the core modules, produced at build time by
+// tools/code_cache/node_mkcodecache.cc when node is configured with
+// --with-code-cache. Each cache belongs to the wrapped source of the module,
+// exactly as NativeModule.prototype.compile() passes it to V8.
+struct NativeCodeCache {
+  const char* id;
+  const uint8_t* data;
+  size_t length;
+};
+
+// Returns the code caches, terminated by an entry whose id is nullptr.
+// The table only holds the terminator when node was built without them.
+const NativeCodeCache* NodeNativeCodeCache();
+
+}  // namespace node
+
+#endif  // defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#endif  // SRC_NODE_CODE_CACHE_H_
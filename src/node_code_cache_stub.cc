@@ -0,0 +1,15 @@
+// Used when node is built without --with-code-cache, see node_code_cache.h.
+
+#include "node_code_cache.h"
+
+namespace node {
+
+static const NativeCodeCache code_cache[] = {
+  { nullptr, nullptr, 0 }
+};
+
+const NativeCodeCache* NodeNativeCodeCache() {
+  return code_cache;
+}
+
+}  // namespace node
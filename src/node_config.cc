@@ -44,6 +44,9 @@ void InitConfig(Local<Object> target,
 
   if (config_preserve_symlinks)
     READONLY_BOOLEAN_PROPERTY("preserveSymlinks");
+
+  if (config_trace_native_module_load)
+    READONLY_BOOLEAN_PROPERTY("traceNativeModuleLoad");
 }  // InitConfig
 
 }  // namespace node
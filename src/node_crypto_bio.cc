@@ -21,6 +21,33 @@ const BIO_METHOD NodeBIO::method = {
 };
 
 
+// Only BIOs that belong to an Environment reuse buffers, the free list is
+// per Environment so that the threads of workers do not share it.
+char* NodeBIO::AllocateData(Environment* env, size_t len) {
+  if (env != nullptr && len == kThroughputBufferLength) {
+    std::vector<char*>* free_buffers = env->tls_free_buffers();
+    if (!free_buffers->empty()) {
+      char* data = free_buffers->back();
+      free_buffers->pop_back();
+      return data;
+    }
+  }
+  return new char[len];
+}
+
+
+void NodeBIO::FreeData(Environment* env, char* data, size_t len) {
+  if (env != nullptr && len == kThroughputBufferLength) {
+    std::vector<char*>* free_buffers = env->tls_free_buffers();
+    if (free_buffers->size() < kMaxFreeBuffers) {
+      free_buffers->push_back(data);
+      return;
+    }
+  }
+  delete[] data;
+}
+
+
 BIO* NodeBIO::New() {
   // The const_cast doesn't violate const correctness.  OpenSSL's usage of
   // BIO_METHOD is effectively const but BIO_new() takes a non-const argument.
@@ -296,6 +323,16 @@ void NodeBIO::FreeEmpty() {
 }
 
 
+void NodeBIO::Trim() {
+  if (read_head_ == nullptr || length_ != 0)
+    return;
+  FreeAll();
+  // Whatever comes next is past the handshake, take a buffer of the usual
+  // size from the free list for it.
+  initial_ = kThroughputBufferLength;
+}
+
+
 size_t NodeBIO::IndexOf(char delim, size_t limit) {
   size_t bytes_read = 0;
   size_t max = Length() > limit ? limit : Length();
@@ -453,6 +490,11 @@ void NodeBIO::Reset() {
 
 
 NodeBIO::~NodeBIO() {
+  FreeAll();
+}
+
+
+void NodeBIO::FreeAll() {
   if (read_head_ == nullptr)
     return;
 
@@ -44,6 +44,12 @@ class NodeBIO {
   // Deallocate children of write head's child if they're empty
   void FreeEmpty();
 
+  // Memory optimization:
+  // Deallocate all buffers if there is no data left, e.g. when a connection
+  // goes idle. Must not be called between PeekWritable() and Commit(), or
+  // while the result of Peek() or PeekMultiple() is in use.
+  void Trim();
+
   // Return pointer to internal data and amount of
   // contiguous data available to read
   char* Peek(size_t* size);
@@ -98,8 +104,17 @@ class NodeBIO {
   static const size_t kInitialBufferLength = 1024;
   static const size_t kThroughputBufferLength = 16384;
 
+  // Released buffers of kThroughputBufferLength bytes that are kept for
+  // reuse, much like OpenSSL keeps its own with SSL_MODE_RELEASE_BUFFERS.
+  // The free list belongs to the Environment, see
+  // Environment::tls_free_buffers().
+  static const size_t kMaxFreeBuffers = 64;
+
   static const BIO_METHOD method;
 
+  static char* AllocateData(Environment* env, size_t len);
+  static void FreeData(Environment* env, char* data, size_t len);
+
   class Buffer {
    public:
     Buffer(Environment* env, size_t len) : env_(env),
@@ -107,13 +122,13 @@ class NodeBIO {
                                            write_pos_(0),
                                            len_(len),
                                            next_(nullptr) {
-      data_ = new char[len];
+      data_ = AllocateData(env, len);
       if (env_ != nullptr)
         env_->isolate()->AdjustAmountOfExternalAllocatedMemory(len);
     }
 
     ~Buffer() {
-      delete[] data_;
+      FreeData(env_, data_, len_);
       if (env_ != nullptr) {
         const int64_t len = static_cast<int64_t>(len_);
         env_->isolate()->AdjustAmountOfExternalAllocatedMemory(-len);
@@ -128,6 +143,8 @@ class NodeBIO {
     char* data_;
   };
 
+  void FreeAll();
+
   Environment* env_;
   size_t initial_;
   size_t length_;
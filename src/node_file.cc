@@ -8,6 +8,7 @@
 #include "env-inl.h"
 #include "req-wrap.h"
 #include "req-wrap-inl.h"
+#include "simd.h"
 #include "string_bytes.h"
 #include "util.h"
 
@@ -22,13 +23,17 @@
 # include <io.h>
 #endif
 
+#include <string>
 #include <vector>
 
 namespace node {
 
 using v8::Array;
+using v8::ArrayBuffer;
 using v8::Context;
 using v8::EscapableHandleScope;
+using v8::Exception;
+using v8::Float64Array;
 using v8::Function;
 using v8::FunctionCallbackInfo;
 using v8::FunctionTemplate;
@@ -38,6 +43,8 @@ using v8::Local;
 using v8::Number;
 using v8::Object;
 using v8::String;
+using v8::Uint32Array;
+using v8::Uint8Array;
 using v8::Value;
 
 #ifndef MIN
@@ -135,6 +142,75 @@ static inline bool IsInt64(double x) {
   return x == static_cast<double>(static_cast<int64_t>(x));
 }
 
+// Collects the entries of a finished scandir request.  The result is an
+// array of names or, when with_types is set, [names, types] with the
+// UV_DIRENT_* type of each entry packed into a Uint8Array.  Returns 0 or a
+// libuv error code, *message is set for errors that need an explanation.
+static int ReadDirResult(Environment* env,
+                         uv_fs_t* req,
+                         enum encoding encoding,
+                         bool with_types,
+                         Local<Value>* result,
+                         const char** message) {
+  Local<Array> names = Array::New(env->isolate(), 0);
+  Local<Function> fn = env->push_values_to_array_function();
+  Local<Value> name_argv[NODE_PUSH_VAL_TO_ARRAY_MAX];
+  size_t name_idx = 0;
+
+  Local<ArrayBuffer> types_buffer;
+  uint8_t* types = nullptr;
+  if (with_types) {
+    CHECK_GE(req->result, 0);
+    types_buffer = ArrayBuffer::New(env->isolate(), req->result);
+    types = static_cast<uint8_t*>(types_buffer->GetContents().Data());
+  }
+
+  for (size_t i = 0; ; i++) {
+    uv_dirent_t ent;
+
+    int r = uv_fs_scandir_next(req, &ent);
+    if (r == UV_EOF)
+      break;
+    if (r != 0)
+      return r;
+
+    Local<Value> filename = StringBytes::Encode(env->isolate(),
+                                                ent.name,
+                                                encoding);
+    if (filename.IsEmpty()) {
+      *message = "Invalid character encoding for filename";
+      return UV_EINVAL;
+    }
+    name_argv[name_idx++] = filename;
+
+    if (with_types) {
+      CHECK_LT(i, types_buffer->ByteLength());
+      types[i] = ent.type;
+    }
+
+    if (name_idx >= arraysize(name_argv)) {
+      fn->Call(env->context(), names, name_idx, name_argv)
+          .ToLocalChecked();
+      name_idx = 0;
+    }
+  }
+
+  if (name_idx > 0) {
+    fn->Call(env->context(), names, name_idx, name_argv)
+        .ToLocalChecked();
+  }
+
+  if (with_types) {
+    Local<Array> pair = Array::New(env->isolate(), 2);
+    pair->Set(0, names);
+    pair->Set(1, Uint8Array::New(types_buffer, 0, types_buffer->ByteLength()));
+    *result = pair;
+  } else {
+    *result = names;
+  }
+  return 0;
+}
+
 static void After(uv_fs_t *req) {
   FSReqWrap* req_wrap = static_cast<FSReqWrap*>(req->data);
   CHECK_EQ(req_wrap->req(), req);
@@ -263,53 +339,18 @@ static void After(uv_fs_t *req) {
 
       case UV_FS_SCANDIR:
         {
-          int r;
-          Local<Array> names = Array::New(env->isolate(), 0);
-          Local<Function> fn = env->push_values_to_array_function();
-          Local<Value> name_argv[NODE_PUSH_VAL_TO_ARRAY_MAX];
-          size_t name_idx = 0;
-
-          for (int i = 0; ; i++) {
-            uv_dirent_t ent;
-
-            r = uv_fs_scandir_next(req, &ent);
-            if (r == UV_EOF)
-              break;
-            if (r != 0) {
-              argv[0] = UVException(r,
-                                    nullptr,
-                                    req_wrap->syscall(),
-                                    static_cast<const char*>(req->path));
-              break;
-            }
-
-            Local<Value> filename = StringBytes::Encode(env->isolate(),
-                                                        ent.name,
-                                                        req_wrap->encoding_);
-            if (filename.IsEmpty()) {
-              argv[0] = UVException(env->isolate(),
-                                    UV_EINVAL,
-                                    req_wrap->syscall(),
-                                    "Invalid character encoding for filename",
-                                    req->path,
-                                    req_wrap->data());
-              break;
-            }
-            name_argv[name_idx++] = filename;
-
-            if (name_idx >= arraysize(name_argv)) {
-              fn->Call(env->context(), names, name_idx, name_argv)
-                  .ToLocalChecked();
-              name_idx = 0;
-            }
-          }
-
-          if (name_idx > 0) {
-            fn->Call(env->context(), names, name_idx, name_argv)
-                .ToLocalChecked();
+          const char* message = nullptr;
+          int err = ReadDirResult(env, req, req_wrap->encoding_, false,
+                                  &argv[1], &message);
+          if (err < 0) {
+            argc = 1;
+            argv[0] = UVException(env->isolate(),
+                                  err,
+                                  req_wrap->syscall(),
+                                  message,
+                                  req->path,
+                                  req_wrap->data());
           }
-
-          argv[1] = names;
         }
         break;
 
@@ -324,6 +365,43 @@ static void After(uv_fs_t *req) {
   req_wrap->Dispose();
 }
 
+// Same as After() for readdir with file types, the callback gets the
+// [names, types] pair instead of just the names.
+static void AfterScanDirWithTypes(uv_fs_t* req) {
+  if (req->result < 0)
+    return After(req);
+
+  FSReqWrap* req_wrap = static_cast<FSReqWrap*>(req->data);
+  CHECK_EQ(req_wrap->req(), req);
+  req_wrap->ReleaseEarly();
+
+  Environment* env = req_wrap->env();
+  HandleScope handle_scope(env->isolate());
+  Context::Scope context_scope(env->context());
+
+  int argc = 2;
+  Local<Value> argv[2];
+  const char* message = nullptr;
+
+  argv[0] = Null(env->isolate());
+  int err = ReadDirResult(env, req, req_wrap->encoding_, true, &argv[1],
+                          &message);
+  if (err < 0) {
+    argc = 1;
+    argv[0] = UVException(env->isolate(),
+                          err,
+                          req_wrap->syscall(),
+                          message,
+                          req->path,
+                          req_wrap->data());
+  }
+
+  req_wrap->MakeCallback(env->oncomplete_string(), argc, argv);
+
+  uv_fs_req_cleanup(req_wrap->req());
+  req_wrap->Dispose();
+}
+
 // This struct is only used on sync fs calls.
 // For async calls FSReqWrap is used.
 class fs_req_wrap {
@@ -337,7 +415,7 @@ class fs_req_wrap {
 };
 
 
-#define ASYNC_DEST_CALL(func, request, dest, encoding, ...)                   \
+#define ASYNC_DEST_CALL_CB(after, func, request, dest, encoding, ...)         \
   Environment* env = Environment::GetCurrent(args);                           \
   CHECK(request->IsObject());                                                 \
   FSReqWrap* req_wrap = FSReqWrap::New(env, request.As<Object>(),             \
@@ -345,18 +423,21 @@ class fs_req_wrap {
   int err = uv_fs_ ## func(env->event_loop(),                                 \
                            req_wrap->req(),                                   \
                            __VA_ARGS__,                                       \
-                           After);                                            \
+                           after);                                            \
   req_wrap->Dispatched();                                                     \
   if (err < 0) {                                                              \
     uv_fs_t* uv_req = req_wrap->req();                                        \
     uv_req->result = err;                                                     \
     uv_req->path = nullptr;                                                   \
-    After(uv_req);                                                            \
+    after(uv_req);                                                            \
     req_wrap = nullptr;                                                       \
   } else {                                                                    \
     args.GetReturnValue().Set(req_wrap->persistent());                        \
   }
 
+#define ASYNC_DEST_CALL(func, request, dest, encoding, ...)                   \
+  ASYNC_DEST_CALL_CB(After, func, request, dest, encoding, __VA_ARGS__)       \
+
 #define ASYNC_CALL(func, req, encoding, ...)                                  \
   ASYNC_DEST_CALL(func, req, nullptr, encoding, __VA_ARGS__)                  \
 
@@ -932,56 +1013,31 @@ static void ReadDir(const FunctionCallbackInfo<Value>& args) {
   ASSERT_PATH(path)
 
   const enum encoding encoding = ParseEncoding(env->isolate(), args[1], UTF8);
+  const bool with_types = args[2]->IsTrue();
 
   Local<Value> callback = Null(env->isolate());
-  if (argc == 3)
-    callback = args[2];
+  if (argc == 4)
+    callback = args[3];
 
   if (callback->IsObject()) {
-    ASYNC_CALL(scandir, callback, encoding, *path, 0 /*flags*/)
+    if (with_types) {
+      ASYNC_DEST_CALL_CB(AfterScanDirWithTypes, scandir, callback, nullptr,
+                         encoding, *path, 0 /*flags*/)
+    } else {
+      ASYNC_CALL(scandir, callback, encoding, *path, 0 /*flags*/)
+    }
   } else {
     SYNC_CALL(scandir, *path, *path, 0 /*flags*/)
 
     CHECK_GE(SYNC_REQ.result, 0);
-    int r;
-    Local<Array> names = Array::New(env->isolate(), 0);
-    Local<Function> fn = env->push_values_to_array_function();
-    Local<Value> name_v[NODE_PUSH_VAL_TO_ARRAY_MAX];
-    size_t name_idx = 0;
-
-    for (int i = 0; ; i++) {
-      uv_dirent_t ent;
-
-      r = uv_fs_scandir_next(&SYNC_REQ, &ent);
-      if (r == UV_EOF)
-        break;
-      if (r != 0)
-        return env->ThrowUVException(r, "readdir", "", *path);
-
-      Local<Value> filename = StringBytes::Encode(env->isolate(),
-                                                  ent.name,
-                                                  encoding);
-      if (filename.IsEmpty()) {
-        return env->ThrowUVException(UV_EINVAL,
-                                     "readdir",
-                                     "Invalid character encoding for filename",
-                                     *path);
-      }
-
-      name_v[name_idx++] = filename;
-
-      if (name_idx >= arraysize(name_v)) {
-        fn->Call(env->context(), names, name_idx, name_v)
-            .ToLocalChecked();
-        name_idx = 0;
-      }
-    }
-
-    if (name_idx > 0) {
-      fn->Call(env->context(), names, name_idx, name_v).ToLocalChecked();
-    }
-
-    args.GetReturnValue().Set(names);
+    Local<Value> result;
+    const char* message = "";
+    int r = ReadDirResult(env, &SYNC_REQ, encoding, with_types, &result,
+                          &message);
+    if (r < 0)
+      return env->ThrowUVException(r, "readdir", message, *path);
+
+    args.GetReturnValue().Set(result);
   }
 }
 
@@ -1238,6 +1294,564 @@ static void Read(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+// Reads a whole file in one threadpool job. open, fstat, read until EOF and
+// close run back to back on the worker thread, the main thread only sees the
+// finished Buffer or string.
+class ReadFileWrap: public ReqWrap<uv_work_t> {
+ public:
+  ReadFileWrap(Environment* env,
+               Local<Object> req,
+               const char* path,
+               uv_file fd,
+               int flags,
+               enum encoding encoding)
+      : ReqWrap(env, req, AsyncWrap::PROVIDER_FSREQWRAP),
+        path_(path != nullptr ? path : ""),
+        fd_(fd),
+        own_fd_(path != nullptr),
+        flags_(flags),
+        encoding_(encoding),
+        err_(0),
+        syscall_(nullptr),
+        too_large_(false),
+        data_(nullptr),
+        length_(0) {
+    Wrap(object(), this);
+  }
+
+  ~ReadFileWrap() { free(data_); }
+
+  static void Work(uv_work_t* req);
+  static void After(uv_work_t* req, int status);
+
+  size_t self_size() const override { return sizeof(*this); }
+
+ private:
+  void Fail(int err, const char* syscall) {
+    if (err_ == 0) {
+      err_ = err;
+      syscall_ = syscall;
+    }
+  }
+
+  void ReadAll();
+
+  const std::string path_;
+  uv_file fd_;
+  const bool own_fd_;
+  const int flags_;
+  const enum encoding encoding_;
+  int err_;
+  const char* syscall_;
+  bool too_large_;
+  char* data_;
+  size_t length_;
+
+  DISALLOW_COPY_AND_ASSIGN(ReadFileWrap);
+};
+
+
+// Runs on the threadpool.  Synchronous uv_fs_* calls never touch the loop
+// so it is safe to make them from here.
+void ReadFileWrap::Work(uv_work_t* req) {
+  ReadFileWrap* wrap = static_cast<ReadFileWrap*>(req->data);
+  uv_fs_t fs_req;
+  int err;
+
+  if (wrap->own_fd_) {
+    err = uv_fs_open(nullptr, &fs_req, wrap->path_.c_str(), wrap->flags_,
+                     0666, nullptr);
+    uv_fs_req_cleanup(&fs_req);
+    if (err < 0)
+      return wrap->Fail(err, "open");
+    wrap->fd_ = err;
+  }
+
+  wrap->ReadAll();
+
+  if (wrap->own_fd_) {
+    err = uv_fs_close(nullptr, &fs_req, wrap->fd_, nullptr);
+    uv_fs_req_cleanup(&fs_req);
+    if (err < 0)
+      wrap->Fail(err, "close");
+  }
+}
+
+
+void ReadFileWrap::ReadAll() {
+  // Same chunk size as the old JS implementation for files that don't
+  // report a size, grown geometrically so large streams stay linear.
+  const size_t kChunkSize = 8 * 1024;
+  uv_fs_t fs_req;
+  size_t capacity;
+  bool sized;
+  int err;
+
+  err = uv_fs_fstat(nullptr, &fs_req, fd_, nullptr);
+  if (err < 0) {
+    uv_fs_req_cleanup(&fs_req);
+    return Fail(err, "fstat");
+  }
+  sized = (fs_req.statbuf.st_mode & S_IFMT) == S_IFREG &&
+          fs_req.statbuf.st_size > 0;
+  if (sized && fs_req.statbuf.st_size > Buffer::kMaxLength) {
+    uv_fs_req_cleanup(&fs_req);
+    too_large_ = true;
+    return;
+  }
+  capacity = sized ? fs_req.statbuf.st_size : kChunkSize;
+  uv_fs_req_cleanup(&fs_req);
+
+  data_ = static_cast<char*>(malloc(capacity));
+  if (data_ == nullptr)
+    return Fail(UV_ENOMEM, "read");
+
+  for (;;) {
+    if (length_ == capacity) {
+      // A regular file is read up to the size fstat reported, like
+      // readFileSync does.
+      if (sized)
+        break;
+      if (capacity == Buffer::kMaxLength) {
+        too_large_ = true;
+        return;
+      }
+      capacity = MIN(2 * capacity, static_cast<size_t>(Buffer::kMaxLength));
+      char* data = static_cast<char*>(realloc(data_, capacity));
+      if (data == nullptr)
+        return Fail(UV_ENOMEM, "read");
+      data_ = data;
+    }
+
+    uv_buf_t buf = uv_buf_init(data_ + length_, capacity - length_);
+    err = uv_fs_read(nullptr, &fs_req, fd_, &buf, 1, -1, nullptr);
+    uv_fs_req_cleanup(&fs_req);
+    if (err < 0)
+      return Fail(err, "read");
+    if (err == 0)
+      break;
+    length_ += err;
+  }
+}
+
+
+void ReadFileWrap::After(uv_work_t* req, int status) {
+  ReadFileWrap* wrap = static_cast<ReadFileWrap*>(req->data);
+  CHECK_EQ(wrap->req(), req);
+  CHECK_EQ(status, 0);
+
+  Environment* env = wrap->env();
+  HandleScope handle_scope(env->isolate());
+  Context::Scope context_scope(env->context());
+
+  int argc = 1;
+  Local<Value> argv[2];
+
+  if (wrap->too_large_) {
+    char message[128];
+    snprintf(message, sizeof(message),
+             "File size is greater than possible Buffer: 0x%x bytes",
+             Buffer::kMaxLength);
+    argv[0] = Exception::RangeError(
+        OneByteString(env->isolate(), message));
+  } else if (wrap->err_ < 0) {
+    const char* path = nullptr;
+    if (wrap->own_fd_ && strcmp(wrap->syscall_, "open") == 0)
+      path = wrap->path_.c_str();
+    argv[0] = UVException(env->isolate(), wrap->err_, wrap->syscall_,
+                          nullptr, path);
+  } else {
+    argv[0] = Null(env->isolate());
+    argc = 2;
+    if (wrap->encoding_ == BUFFER) {
+      // The Buffer takes over the memory.
+      char* data = wrap->length_ > 0 ? wrap->data_ : nullptr;
+      Local<Object> buffer;
+      if (Buffer::New(env, data, wrap->length_).ToLocal(&buffer)) {
+        if (data != nullptr)
+          wrap->data_ = nullptr;
+        argv[1] = buffer;
+      }
+    } else if (wrap->length_ == 0) {
+      argv[1] = String::Empty(env->isolate());
+    } else if (wrap->encoding_ == UCS2) {
+      // Memory from malloc() is aligned well enough for two-byte access.
+      argv[1] = StringBytes::Encode(
+          env->isolate(),
+          reinterpret_cast<const uint16_t*>(wrap->data_),
+          wrap->length_ / 2);
+    } else {
+      argv[1] = StringBytes::Encode(env->isolate(),
+                                    wrap->data_,
+                                    wrap->length_,
+                                    wrap->encoding_);
+    }
+    if (argv[1].IsEmpty()) {
+      argc = 1;
+      argv[0] = Exception::Error(
+          FIXED_ONE_BYTE_STRING(env->isolate(), "\"toString()\" failed"));
+    }
+  }
+
+  wrap->MakeCallback(env->oncomplete_string(), argc, argv);
+  delete wrap;
+}
+
+
+// data = readFile(path | fd, flags, encoding, req)
+// 0 path      string or Buffer, or a file descriptor which is left open
+// 1 flags     integer. open flags, ignored for a file descriptor
+// 2 encoding  string. the contents are decoded with this encoding,
+//             or returned as a Buffer when null
+// 3 req       request object, called back with (err, data)
+static void ReadFile(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+
+  if (args.Length() < 4)
+    return TYPE_ERROR("path, flags, encoding and req are required");
+  if (!args[1]->IsInt32())
+    return TYPE_ERROR("flags must be an int");
+  CHECK(args[3]->IsObject());
+
+  const int flags = args[1]->Int32Value();
+  const enum encoding encoding = ParseEncoding(env->isolate(), args[2], BUFFER);
+
+  ReadFileWrap* wrap;
+  if (args[0]->IsInt32()) {
+    wrap = new ReadFileWrap(env, args[3].As<Object>(), nullptr,
+                            args[0]->Int32Value(), flags, encoding);
+  } else {
+    BufferValue path(env->isolate(), args[0]);
+    ASSERT_PATH(path)
+    wrap = new ReadFileWrap(env, args[3].As<Object>(), *path, -1, flags,
+                            encoding);
+  }
+
+  int err = uv_queue_work(env->event_loop(),
+                          wrap->req(),
+                          ReadFileWrap::Work,
+                          ReadFileWrap::After);
+  wrap->Dispatched();
+  CHECK_EQ(err, 0);
+  args.GetReturnValue().Set(wrap->persistent());
+}
+
+
+// Scans directories for fs.walk() on the threadpool.  The walk itself is
+// driven from JS: every job gets the next directories from the walker's
+// queue, reads and stats their entries and reports back how many of the
+// directories it got through, the directories found are queued by JS.
+// A directory that can't be read doesn't stop the job, its error is reported
+// along with the entries and JS decides what to do with it.
+class WalkWrap: public ReqWrap<uv_work_t> {
+ public:
+  // A job stops taking more directories once it has this many entries.
+  static const size_t kBatchSize = 1024;
+
+  WalkWrap(Environment* env,
+           Local<Object> req,
+           bool follow_symlinks,
+           enum encoding encoding)
+      : ReqWrap(env, req, AsyncWrap::PROVIDER_FSREQWRAP),
+        follow_symlinks_(follow_symlinks),
+        encoding_(encoding),
+        consumed_(0) {
+    Wrap(object(), this);
+  }
+
+  static void Work(uv_work_t* req);
+  static void After(uv_work_t* req, int status);
+
+  size_t self_size() const override { return sizeof(*this); }
+
+  std::vector<std::string> dirs_;
+
+ private:
+  struct Entry {
+    std::string name;
+    uint32_t parent;
+    uint8_t type;
+    double size;
+    double mtime;
+    double dev;
+    double ino;
+  };
+
+  struct Error {
+    uint32_t index;
+    int err;
+    const char* syscall;
+    std::string path;
+  };
+
+  void ScanDir(uint32_t index);
+  int StatEntry(const std::string& path, Entry* entry);
+
+  const bool follow_symlinks_;
+  const enum encoding encoding_;
+  uint32_t consumed_;
+  std::vector<Entry> entries_;
+  std::vector<Error> errors_;
+
+  DISALLOW_COPY_AND_ASSIGN(WalkWrap);
+};
+
+
+static uint8_t DirentTypeFromMode(uint64_t mode) {
+  switch (mode & S_IFMT) {
+    case S_IFREG: return UV_DIRENT_FILE;
+    case S_IFDIR: return UV_DIRENT_DIR;
+    case S_IFCHR: return UV_DIRENT_CHAR;
+#ifdef S_IFLNK
+    case S_IFLNK: return UV_DIRENT_LINK;
+#endif
+#ifdef S_IFBLK
+    case S_IFBLK: return UV_DIRENT_BLOCK;
+#endif
+#ifdef S_IFIFO
+    case S_IFIFO: return UV_DIRENT_FIFO;
+#endif
+#ifdef S_IFSOCK
+    case S_IFSOCK: return UV_DIRENT_SOCKET;
+#endif
+  }
+  return UV_DIRENT_UNKNOWN;
+}
+
+
+// Runs on the threadpool, see ReadFileWrap::Work().
+void WalkWrap::Work(uv_work_t* req) {
+  WalkWrap* wrap = static_cast<WalkWrap*>(req->data);
+
+  while (wrap->consumed_ < wrap->dirs_.size() &&
+         wrap->entries_.size() < kBatchSize) {
+    wrap->ScanDir(wrap->consumed_);
+    wrap->consumed_++;
+  }
+}
+
+
+void WalkWrap::ScanDir(uint32_t index) {
+#ifdef _WIN32
+  const char kSeparator = '\\';
+#else
+  const char kSeparator = '/';
+#endif
+  const std::string& dir = dirs_[index];
+  const size_t count = entries_.size();
+  Error error = { index, 0, "scandir", dir };
+  uv_fs_t req;
+  int err;
+
+  err = uv_fs_scandir(nullptr, &req, dir.c_str(), 0, nullptr);
+  if (err < 0) {
+    uv_fs_req_cleanup(&req);
+    error.err = err;
+    errors_.push_back(error);
+    return;
+  }
+
+  std::string prefix = dir;
+  if (prefix.empty() || prefix[prefix.size() - 1] != kSeparator)
+    prefix += kSeparator;
+
+  uv_dirent_t ent;
+  while ((err = uv_fs_scandir_next(&req, &ent)) == 0) {
+    Entry entry;
+    entry.name = ent.name;
+    entry.parent = index;
+    err = StatEntry(prefix + ent.name, &entry);
+    if (err == UV_ENOENT)
+      continue;  // Removed since the directory was read.
+    if (err < 0) {
+      error.syscall = follow_symlinks_ ? "stat" : "lstat";
+      error.path = prefix + ent.name;
+      break;
+    }
+    entries_.push_back(entry);
+  }
+  uv_fs_req_cleanup(&req);
+
+  if (err != UV_EOF) {
+    entries_.resize(count);
+    error.err = err;
+    errors_.push_back(error);
+  }
+}
+
+
+int WalkWrap::StatEntry(const std::string& path, Entry* entry) {
+  uv_fs_t req;
+  int err = -1;
+
+  if (follow_symlinks_) {
+    err = uv_fs_stat(nullptr, &req, path.c_str(), nullptr);
+    uv_fs_req_cleanup(&req);
+  }
+  // Dangling links are reported as links.
+  if (err < 0) {
+    err = uv_fs_lstat(nullptr, &req, path.c_str(), nullptr);
+    uv_fs_req_cleanup(&req);
+  }
+  if (err < 0)
+    return err;
+
+  const uv_stat_t& s = req.statbuf;
+  entry->type = DirentTypeFromMode(s.st_mode);
+  entry->size = static_cast<double>(s.st_size);
+  // Same millisecond resolution as fs.Stats.
+  entry->mtime = static_cast<double>(s.st_mtim.tv_sec) * 1000 +
+                 static_cast<double>(s.st_mtim.tv_nsec / 1000000);
+  entry->dev = static_cast<double>(s.st_dev);
+  entry->ino = static_cast<double>(s.st_ino);
+  return 0;
+}
+
+
+template <typename ArrayType, typename T>
+static Local<ArrayType> NewTypedArray(Environment* env,
+                                      const std::vector<T>& values) {
+  Local<ArrayBuffer> ab =
+      ArrayBuffer::New(env->isolate(), values.size() * sizeof(T));
+  if (!values.empty())
+    memcpy(ab->GetContents().Data(), &values[0], values.size() * sizeof(T));
+  return ArrayType::New(ab, 0, values.size());
+}
+
+
+void WalkWrap::After(uv_work_t* req, int status) {
+  WalkWrap* wrap = static_cast<WalkWrap*>(req->data);
+  CHECK_EQ(wrap->req(), req);
+  CHECK_EQ(status, 0);
+
+  Environment* env = wrap->env();
+  HandleScope handle_scope(env->isolate());
+  Context::Scope context_scope(env->context());
+
+  const size_t count = wrap->entries_.size();
+  Local<Array> names = Array::New(env->isolate(), 0);
+  Local<Array> raw = Array::New(env->isolate(), 0);
+  Local<Function> fn = env->push_values_to_array_function();
+  Local<Value> name_argv[NODE_PUSH_VAL_TO_ARRAY_MAX];
+  size_t name_idx = 0;
+  std::vector<uint32_t> parents(count);
+  std::vector<uint8_t> types(count);
+  std::vector<double> stats(4 * count);
+
+  for (size_t i = 0; i < count; i++) {
+    const Entry& entry = wrap->entries_[i];
+    Local<Value> name = StringBytes::Encode(env->isolate(),
+                                            entry.name.c_str(),
+                                            wrap->encoding_);
+    if (name.IsEmpty())
+      name = Buffer::Copy(env, entry.name.data(), entry.name.size())
+          .ToLocalChecked();
+    name_argv[name_idx++] = name;
+    if (name_idx >= arraysize(name_argv)) {
+      fn->Call(env->context(), names, name_idx, name_argv)
+          .ToLocalChecked();
+      name_idx = 0;
+    }
+
+    // The walk goes on with the exact bytes of a directory's name when the
+    // name as it is handed out doesn't give them back.
+    if (entry.type == UV_DIRENT_DIR &&
+        !name->IsUint8Array() &&
+        (wrap->encoding_ != UTF8 ||
+         !simd::IsValidUtf8(entry.name.data(), entry.name.size()))) {
+      raw->Set(env->context(),
+               raw->Length(),
+               Integer::NewFromUnsigned(env->isolate(), i)).FromJust();
+      raw->Set(env->context(),
+               raw->Length(),
+               Buffer::Copy(env, entry.name.data(), entry.name.size())
+                   .ToLocalChecked()).FromJust();
+    }
+
+    parents[i] = entry.parent;
+    types[i] = entry.type;
+    stats[4 * i + 0] = entry.size;
+    stats[4 * i + 1] = entry.mtime;
+    stats[4 * i + 2] = entry.dev;
+    stats[4 * i + 3] = entry.ino;
+  }
+  if (name_idx > 0) {
+    fn->Call(env->context(), names, name_idx, name_argv)
+        .ToLocalChecked();
+  }
+
+  // [index, error] for every directory that couldn't be read.
+  Local<Array> errors = Array::New(env->isolate(), 0);
+  for (const Error& error : wrap->errors_) {
+    errors->Set(env->context(),
+                errors->Length(),
+                Integer::NewFromUnsigned(env->isolate(), error.index))
+        .FromJust();
+    errors->Set(env->context(),
+                errors->Length(),
+                UVException(env->isolate(),
+                            error.err,
+                            error.syscall,
+                            nullptr,
+                            error.path.c_str())).FromJust();
+  }
+
+  // [consumed, names, parents, types, [size, mtime, dev, ino] * count,
+  //  [index, name bytes] for directories, [index, error] * errors]
+  Local<Array> result = Array::New(env->isolate(), 7);
+  result->Set(0, Integer::NewFromUnsigned(env->isolate(), wrap->consumed_));
+  result->Set(1, names);
+  result->Set(2, NewTypedArray<Uint32Array>(env, parents));
+  result->Set(3, NewTypedArray<Uint8Array>(env, types));
+  result->Set(4, NewTypedArray<Float64Array>(env, stats));
+  result->Set(5, raw);
+  result->Set(6, errors);
+
+  Local<Value> argv[] = { Null(env->isolate()), result };
+  wrap->MakeCallback(env->oncomplete_string(), arraysize(argv), argv);
+  delete wrap;
+}
+
+
+// walk(dirs, followSymlinks, encoding, req)
+// 0 dirs            array of directory paths to scan, in order
+// 1 followSymlinks  boolean. stat() entries instead of lstat()
+// 2 encoding        encoding of the names, as for readdir()
+// 3 req             request object, called back with (err, result)
+static void Walk(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+
+  if (args.Length() < 4)
+    return TYPE_ERROR("dirs, followSymlinks, encoding and req are required");
+  if (!args[0]->IsArray())
+    return TYPE_ERROR("dirs must be an array");
+  CHECK(args[3]->IsObject());
+
+  Local<Array> dirs = args[0].As<Array>();
+  std::vector<std::string> paths;
+  for (uint32_t i = 0; i < dirs->Length(); i++) {
+    BufferValue path(env->isolate(), dirs->Get(i));
+    ASSERT_PATH(path)
+    paths.push_back(*path);
+  }
+
+  const enum encoding encoding = ParseEncoding(env->isolate(), args[2], UTF8);
+  WalkWrap* wrap = new WalkWrap(env,
+                                args[3].As<Object>(),
+                                args[1]->IsTrue(),
+                                encoding);
+  wrap->dirs_.swap(paths);
+
+  int err = uv_queue_work(env->event_loop(),
+                          wrap->req(),
+                          WalkWrap::Work,
+                          WalkWrap::After);
+  wrap->Dispatched();
+  CHECK_EQ(err, 0);
+  args.GetReturnValue().Set(wrap->persistent());
+}
+
+
 /* fs.chmod(path, mode);
  * Wrapper for chmod(1) / EIO_CHMOD
  */
@@ -1455,6 +2069,7 @@ void InitFs(Local<Object> target,
   env->SetMethod(target, "close", Close);
   env->SetMethod(target, "open", Open);
   env->SetMethod(target, "read", Read);
+  env->SetMethod(target, "readFile", ReadFile);
   env->SetMethod(target, "fdatasync", Fdatasync);
   env->SetMethod(target, "fsync", Fsync);
   env->SetMethod(target, "rename", Rename);
@@ -1462,6 +2077,7 @@ void InitFs(Local<Object> target,
   env->SetMethod(target, "rmdir", RMDir);
   env->SetMethod(target, "mkdir", MKDir);
   env->SetMethod(target, "readdir", ReadDir);
+  env->SetMethod(target, "walk", Walk);
   env->SetMethod(target, "internalModuleReadFile", InternalModuleReadFile);
   env->SetMethod(target, "internalModuleStat", InternalModuleStat);
   env->SetMethod(target, "stat", Stat);
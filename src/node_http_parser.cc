@@ -39,7 +39,9 @@ using v8::FunctionCallbackInfo;
 using v8::FunctionTemplate;
 using v8::HandleScope;
 using v8::Integer;
+using v8::Isolate;
 using v8::Local;
+using v8::NewStringType;
 using v8::Object;
 using v8::String;
 using v8::Uint32;
@@ -141,6 +143,303 @@ struct StringPtr {
 };
 
 
+// How IncomingMessage#_addHeaderLine() in lib/_http_incoming.js treats a
+// field that appears more than once. Keep the two in sync.
+enum HeaderKind {
+  kJoinDuplicates,  // Comma-separated list.
+  kDropDuplicates,  // The first one wins.
+  kArrayOfValues    // Array of all values.
+};
+
+
+// Finds field names among PER_ISOLATE_HTTP_HEADER_NAMES, ignoring case, so
+// that the isolate's interned strings can be used for them.
+class KnownHeaderNames {
+ public:
+  static const int kNotFound = -1;
+
+  KnownHeaderNames() {
+#define V(Name) Name,
+    static const char* const names[] = { PER_ISOLATE_HTTP_HEADER_NAMES(V) };
+#undef V
+    static_assert(arraysize(names) == IsolateData::kHttpHeaderNameCount,
+                  "names must match IsolateData");
+    static_assert(arraysize(names) < kSlots / 2, "hash table too small");
+
+    for (int& slot : slots_)
+      slot = kNotFound;
+    for (size_t i = 0; i < arraysize(names); i++) {
+      names_[i] = names[i];
+      lengths_[i] = strlen(names[i]);
+      CHECK_LT(lengths_[i], sizeof(lowercase_[i]));
+      for (size_t k = 0; k < lengths_[i]; k++)
+        lowercase_[i][k] = ToLower(names[i][k]);
+      kinds_[i] = kJoinDuplicates;
+      size_t slot = Hash(names[i], lengths_[i]);
+      while (slots_[slot] != kNotFound)
+        slot = (slot + 1) % kSlots;
+      slots_[slot] = i;
+    }
+
+    // Fields without an entry are joined, so every field that is treated
+    // differently needs one.
+    static const char* const drop_duplicates[] = {
+      "content-type", "content-length", "user-agent", "referer", "host",
+      "authorization", "proxy-authorization", "if-modified-since",
+      "if-unmodified-since", "from", "location", "max-forwards",
+      "retry-after", "etag", "last-modified", "server", "age", "expires"
+    };
+    for (const char* name : drop_duplicates) {
+      const int index = Find(name, strlen(name));
+      CHECK_NE(index, kNotFound);
+      kinds_[index] = kDropDuplicates;
+    }
+    const int index = Find("set-cookie", 10);
+    CHECK_NE(index, kNotFound);
+    kinds_[index] = kArrayOfValues;
+  }
+
+  int Find(const char* name, size_t length) const {
+    for (size_t slot = Hash(name, length);; slot = (slot + 1) % kSlots) {
+      const int index = slots_[slot];
+      if (index == kNotFound ||
+          (lengths_[index] == length &&
+           StringEqualNoCaseN(lowercase_[index], name, length))) {
+        return index;
+      }
+    }
+  }
+
+  const char* name(int index) const { return names_[index]; }
+  const char* lowercase(int index) const { return lowercase_[index]; }
+  HeaderKind kind(int index) const { return kinds_[index]; }
+
+ private:
+  static const size_t kSlots = 256;
+
+  static size_t Hash(const char* name, size_t length) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++)
+      hash = (hash ^ static_cast<uint8_t>(ToLower(name[i]))) * 16777619u;
+    return hash % kSlots;
+  }
+
+  int slots_[kSlots];
+  const char* names_[IsolateData::kHttpHeaderNameCount];
+  char lowercase_[IsolateData::kHttpHeaderNameCount][64];
+  size_t lengths_[IsolateData::kHttpHeaderNameCount];
+  HeaderKind kinds_[IsolateData::kHttpHeaderNameCount];
+};
+
+static const KnownHeaderNames known_header_names;
+
+
+// What SerializeHeaders() found out about the fields that the outgoing
+// message logic in lib/_http_outgoing.js looks at, exported to it as
+// constants on the binding.
+#define OUTGOING_HEADER_FLAGS(V)                                              \
+  V(kSentConnectionHeader, 1 << 0)                                            \
+  V(kConnectionClose, 1 << 1)                                                 \
+  V(kConnectionKeepAlive, 1 << 2)                                             \
+  V(kConnectionUpgrade, 1 << 3)                                               \
+  V(kSentTransferEncodingHeader, 1 << 4)                                      \
+  V(kChunkedEncoding, 1 << 5)                                                 \
+  V(kSentContentLengthHeader, 1 << 6)                                         \
+  V(kSentDateHeader, 1 << 7)                                                  \
+  V(kSentExpect, 1 << 8)                                                      \
+  V(kSentTrailer, 1 << 9)                                                     \
+  V(kSentUpgrade, 1 << 10)
+
+enum OutgoingHeaderFlags {
+#define V(name, value) name = value,
+  OUTGOING_HEADER_FLAGS(V)
+#undef V
+};
+
+
+// Same as checkIsHttpToken() in lib/_http_common.js.
+static inline bool IsTokenChar(uint8_t c) {
+  if (c <= ' ' || c >= 127)
+    return false;
+  switch (c) {
+    case '"': case '(': case ')': case ',': case '/': case ':': case ';':
+    case '<': case '=': case '>': case '?': case '@': case '[': case '\\':
+    case ']': case '{': case '}':
+      return false;
+    default:
+      return true;
+  }
+}
+
+
+// Same as checkInvalidHeaderChar() in lib/_http_common.js, for characters
+// that are known to be below 256.
+static inline bool IsFieldValueChar(uint8_t c) {
+  return (c >= ' ' || c == '\t') && c != 127;
+}
+
+
+static inline bool IsWordChar(char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+         (c >= '0' && c <= '9') || c == '_';
+}
+
+
+// Matches /word/i when |whole_word| is false, /(^|\W)word(\W|$)/i otherwise.
+static bool ContainsWord(const char* data, size_t length,
+                         const char* word, size_t word_length,
+                         bool whole_word) {
+  for (size_t i = 0; i + word_length <= length; i++) {
+    if (whole_word) {
+      if (i > 0 && IsWordChar(data[i - 1]))
+        continue;
+      if (i + word_length < length && IsWordChar(data[i + word_length]))
+        continue;
+    }
+    if (StringEqualNoCaseN(data + i, word, word_length))
+      return true;
+  }
+  return false;
+}
+
+
+static int OutgoingHeaderFlagsFor(const char* name, size_t name_length,
+                                  const char* value, size_t value_length) {
+  static const struct {
+    const char* name;
+    size_t length;
+    int flag;
+  } fields[] = {
+    { "connection", 10, kSentConnectionHeader },
+    { "transfer-encoding", 17, kSentTransferEncodingHeader },
+    { "content-length", 14, kSentContentLengthHeader },
+    { "date", 4, kSentDateHeader },
+    { "expect", 6, kSentExpect },
+    { "trailer", 7, kSentTrailer },
+    { "upgrade", 7, kSentUpgrade }
+  };
+
+  for (const auto& field : fields) {
+    if (field.length != name_length ||
+        !StringEqualNoCaseN(name, field.name, name_length)) {
+      continue;
+    }
+    int flags = field.flag;
+    if (flags == kSentConnectionHeader) {
+      if (ContainsWord(value, value_length, "close", 5, true))
+        flags |= kConnectionClose;
+      else
+        flags |= kConnectionKeepAlive;
+      if (ContainsWord(value, value_length, "upgrade", 7, true))
+        flags |= kConnectionUpgrade;
+    } else if (flags == kSentTransferEncodingHeader) {
+      if (ContainsWord(value, value_length, "chunk", 5, false))
+        flags |= kChunkedEncoding;
+    }
+    return flags;
+  }
+  return 0;
+}
+
+
+// Writes |string| to |dst| as Latin-1, which must have room for all of its
+// characters. Fails for characters above U+00FF.
+static bool WriteLatin1(Local<String> string, char* dst) {
+  const int length = string->Length();
+  if (string->IsOneByte()) {
+    string->WriteOneByte(reinterpret_cast<uint8_t*>(dst), 0, length,
+                         String::NO_NULL_TERMINATION);
+    return true;
+  }
+  MaybeStackBuffer<uint16_t, 1024> wide(length);
+  string->Write(*wide, 0, length, String::NO_NULL_TERMINATION);
+  for (int i = 0; i < length; i++) {
+    if (wide[i] > 0xFF)
+      return false;
+    dst[i] = static_cast<char>(wide[i]);
+  }
+  return true;
+}
+
+
+// serializeHeaders(state, fields) validates the name/value pairs in the
+// flat |fields| array and appends them to state.messageHeader in one go.
+// Returns the OutgoingHeaderFlags for them or -1, with |state| untouched,
+// when lib/_http_outgoing.js has to take over, e.g. to report an invalid
+// header or to deal with values that are neither strings nor numbers.
+static void SerializeHeaders(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  CHECK(args[0]->IsObject());
+  CHECK(args[1]->IsArray());
+  Local<Object> state = args[0].As<Object>();
+  Local<Array> fields = args[1].As<Array>();
+  const uint32_t count = fields->Length();
+  CHECK_EQ(count % 2, 0);
+
+  args.GetReturnValue().Set(-1);
+
+  MaybeStackBuffer<Local<String>, 64> strings(count);
+  size_t size = 0;
+  for (uint32_t i = 0; i < count; i++) {
+    Local<Value> field = fields->Get(env->context(), i).ToLocalChecked();
+    if (field->IsString())
+      strings[i] = field.As<String>();
+    else if (i % 2 == 1 && field->IsNumber())
+      strings[i] = field->ToString(env->context()).ToLocalChecked();
+    else
+      return;
+    // Followed by either ": " or CRLF.
+    size += strings[i]->Length() + 2;
+  }
+
+  MaybeStackBuffer<char, 4096> buffer(size);
+  char* const out = *buffer;
+  size_t written = 0;
+  int flags = 0;
+  for (uint32_t i = 0; i < count; i += 2) {
+    char* const name = out + written;
+    const size_t name_length = strings[i]->Length();
+    if (name_length == 0 || !WriteLatin1(strings[i], name))
+      return;
+    for (size_t k = 0; k < name_length; k++) {
+      if (!IsTokenChar(name[k]))
+        return;
+    }
+    written += name_length;
+    out[written++] = ':';
+    out[written++] = ' ';
+
+    char* const value = out + written;
+    const size_t value_length = strings[i + 1]->Length();
+    if (!WriteLatin1(strings[i + 1], value))
+      return;
+    for (size_t k = 0; k < value_length; k++) {
+      if (!IsFieldValueChar(value[k]))
+        return;
+    }
+    written += value_length;
+    out[written++] = '\r';
+    out[written++] = '\n';
+
+    flags |= OutgoingHeaderFlagsFor(name, name_length, value, value_length);
+  }
+  CHECK_EQ(written, size);
+
+  if (written > 0) {
+    Local<Value> first_line =
+        state->Get(env->context(),
+                   env->message_header_string()).ToLocalChecked();
+    CHECK(first_line->IsString());
+    Local<String> message_header =
+        String::Concat(first_line.As<String>(),
+                       OneByteString(env->isolate(), out, written));
+    state->Set(env->context(), env->message_header_string(),
+               message_header).FromJust();
+  }
+  args.GetReturnValue().Set(flags);
+}
+
+
 class Parser : public AsyncWrap {
  public:
   Parser(Environment* env, Local<Object> wrap, enum http_parser_type type)
@@ -235,6 +534,7 @@ class Parser : public AsyncWrap {
       A_STATUS_MESSAGE,
       A_UPGRADE,
       A_SHOULD_KEEP_ALIVE,
+      A_PARSED_HEADERS,
       A_MAX
     };
 
@@ -254,7 +554,10 @@ class Parser : public AsyncWrap {
       Flush();
     } else {
       // Fast case, pass headers and URL to JS land.
-      argv[A_HEADERS] = CreateHeaders();
+      Local<Object> parsed_headers;
+      argv[A_HEADERS] = CreateHeaders(&parsed_headers);
+      if (!parsed_headers.IsEmpty())
+        argv[A_PARSED_HEADERS] = parsed_headers;
       if (parser_.type == HTTP_REQUEST)
         argv[A_URL] = url_.ToString(env());
     }
@@ -638,17 +941,21 @@ class Parser : public AsyncWrap {
     return scope.Escape(nparsed_obj);
   }
 
-  Local<Array> CreateHeaders() {
+  // Returns the raw [field, value, ...] list. With |parsed|, also builds
+  // the object that becomes IncomingMessage#headers, see ParseHeaders().
+  Local<Array> CreateHeaders(Local<Object>* parsed = nullptr) {
     Local<Array> headers = Array::New(env()->isolate());
     Local<Function> fn = env()->push_values_to_array_function();
     Local<Value> argv[NODE_PUSH_VAL_TO_ARRAY_MAX * 2];
+    Local<String> values[arraysize(values_)];
+    int known[arraysize(fields_)];
     size_t i = 0;
 
     do {
       size_t j = 0;
       while (i < num_values_ && j < arraysize(argv) / 2) {
-        argv[j * 2] = fields_[i].ToString(env());
-        argv[j * 2 + 1] = values_[i].ToString(env());
+        argv[j * 2] = FieldToString(fields_[i], &known[i]);
+        argv[j * 2 + 1] = values[i] = values_[i].ToString(env());
         i++;
         j++;
       }
@@ -657,6 +964,117 @@ class Parser : public AsyncWrap {
       }
     } while (i < num_values_);
 
+    if (parsed != nullptr)
+      *parsed = ParseHeaders(values, known);
+
+    return headers;
+  }
+
+
+  // Uses the interned string for names from PER_ISOLATE_HTTP_HEADER_NAMES
+  // that are spelled the usual way or in lowercase, which is what clients
+  // send almost all of the time. Sets |known| to the index of the name or
+  // to KnownHeaderNames::kNotFound.
+  Local<String> FieldToString(const StringPtr& field, int* known) {
+    *known = known_header_names.Find(field.str_, field.size_);
+    if (*known == KnownHeaderNames::kNotFound)
+      return field.ToString(env());
+
+    IsolateData* isolate_data = env()->isolate_data();
+    const char* name = known_header_names.name(*known);
+    if (memcmp(field.str_, name, field.size_) == 0)
+      return isolate_data->http_header_name(env()->isolate(), *known);
+    const char* lowercase = known_header_names.lowercase(*known);
+    if (memcmp(field.str_, lowercase, field.size_) == 0)
+      return isolate_data->lowercase_http_header_name(env()->isolate(), *known);
+    return field.ToString(env());
+  }
+
+
+  // Lowercases the field names and merges repeated fields the way
+  // IncomingMessage#_addHeaderLine() does, which saves JS land from walking
+  // the raw list again. Returns an empty handle for names that need more
+  // than ASCII lowercasing or that would not end up as own properties,
+  // JS land then does it the slow way.
+  Local<Object> ParseHeaders(const Local<String>* values, const int* known) {
+    Isolate* isolate = env()->isolate();
+    Local<Context> context = env()->context();
+    Local<Object> headers = Object::New(isolate);
+    Local<String> keys[arraysize(fields_)];
+    const char* names[arraysize(fields_)];
+    Local<String> separator;
+
+    // Only names that are not known need to be lowercased here.
+    size_t total_size = 0;
+    for (size_t i = 0; i < num_values_; i++) {
+      if (known[i] == KnownHeaderNames::kNotFound)
+        total_size += fields_[i].size_;
+    }
+    MaybeStackBuffer<char> storage(total_size);
+    size_t offset = 0;
+
+    for (size_t i = 0; i < num_values_; i++) {
+      const size_t size = fields_[i].size_;
+      HeaderKind kind = kJoinDuplicates;
+      if (known[i] != KnownHeaderNames::kNotFound) {
+        names[i] = known_header_names.lowercase(known[i]);
+        kind = known_header_names.kind(known[i]);
+      } else {
+        char* name = storage.out() + offset;
+        offset += size;
+        for (size_t k = 0; k < size; k++) {
+          const char c = fields_[i].str_[k];
+          if (c & 0x80)
+            return Local<Object>();
+          name[k] = ToLower(c);
+        }
+        if (size == 9 && memcmp(name, "__proto__", 9) == 0)
+          return Local<Object>();
+        names[i] = name;
+      }
+
+      size_t prev = 0;
+      while (prev < i && (fields_[prev].size_ != size ||
+                          memcmp(names[prev], names[i], size) != 0)) {
+        prev++;
+      }
+
+      if (prev == i) {
+        if (known[i] != KnownHeaderNames::kNotFound) {
+          keys[i] = env()->isolate_data()->lowercase_http_header_name(
+              isolate, known[i]);
+        } else {
+          keys[i] = String::NewFromOneByte(
+              isolate, reinterpret_cast<const uint8_t*>(names[i]),
+              NewStringType::kInternalized, size).ToLocalChecked();
+        }
+        Local<Value> value = values[i];
+        if (kind == kArrayOfValues) {
+          Local<Array> list = Array::New(isolate, 1);
+          list->Set(context, 0, value).FromJust();
+          value = list;
+        }
+        headers->CreateDataProperty(context, keys[i], value).FromJust();
+        continue;
+      }
+
+      keys[i] = keys[prev];
+      if (kind == kDropDuplicates)
+        continue;
+      Local<Value> existing = headers->Get(context, keys[i]).ToLocalChecked();
+      if (kind == kArrayOfValues) {
+        Local<Array> list = existing.As<Array>();
+        list->Set(context, list->Length(), values[i]).FromJust();
+      } else {
+        if (separator.IsEmpty())
+          separator = FIXED_ONE_BYTE_STRING(isolate, ", ");
+        Local<String> joined =
+            String::Concat(String::Concat(existing.As<String>(), separator),
+                           values[i]);
+        headers->CreateDataProperty(context, keys[i], joined).FromJust();
+      }
+    }
+
     return headers;
   }
 
@@ -758,7 +1176,9 @@ void InitHttpParser(Local<Object> target,
 
   Local<Array> methods = Array::New(env->isolate());
 #define V(num, name, string)                                                  \
-    methods->Set(num, FIXED_ONE_BYTE_STRING(env->isolate(), #string));
+    methods->Set(num, String::NewFromOneByte(                                 \
+        env->isolate(), reinterpret_cast<const uint8_t*>(#string),            \
+        NewStringType::kInternalized).ToLocalChecked());
   HTTP_METHOD_MAP(V)
 #undef V
   target->Set(FIXED_ONE_BYTE_STRING(env->isolate(), "methods"), methods);
@@ -773,6 +1193,13 @@ void InitHttpParser(Local<Object> target,
   env->SetProtoMethod(t, "unconsume", Parser::Unconsume);
   env->SetProtoMethod(t, "getCurrentBuffer", Parser::GetCurrentBuffer);
 
+  env->SetMethod(target, "serializeHeaders", SerializeHeaders);
+#define V(name, value)                                                        \
+    target->Set(FIXED_ONE_BYTE_STRING(env->isolate(), #name),                 \
+                Integer::New(env->isolate(), value));
+  OUTGOING_HEADER_FLAGS(V)
+#undef V
+
   target->Set(FIXED_ONE_BYTE_STRING(env->isolate(), "HTTPParser"),
               t->GetFunction());
 }
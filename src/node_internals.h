@@ -41,6 +41,11 @@ extern const char* openssl_config;
 // that is used by lib/module.js
 extern bool config_preserve_symlinks;
 
+// Set in node.cc by ParseArgs when --trace-native-module-load is used.
+// Used in node_config.cc to set a constant on process.binding('config')
+// that is used by lib/internal/bootstrap_node.js
+extern bool config_trace_native_module_load;
+
 // Tells whether it is safe to call v8::Isolate::GetCurrent().
 extern bool v8_initialized;
 
@@ -139,6 +144,14 @@ void SetupProcessObject(Environment* env,
                         int exec_argc,
                         const char* const* exec_argv);
 
+// Installs the message listener and the fatal error and abort callbacks
+// that every isolate running node code needs.
+void SetIsolateUpForNode(v8::Isolate* isolate);
+
+// Runs the event loop of |env| until it is out of work and `beforeExit`
+// did not schedule more, or until the worker that owns |env| is stopped.
+void SpinEventLoop(Environment* env);
+
 enum Endianness {
   kLittleEndian,  // _Not_ LITTLE_ENDIAN, clashes with endian.h.
   kBigEndian
@@ -194,6 +207,12 @@ v8::MaybeLocal<v8::Object> New(Environment* env,
 // because ArrayBufferAllocator::Free() deallocates it again with free().
 // Mixing operator new and free() is undefined behavior so don't do that.
 v8::MaybeLocal<v8::Object> New(Environment* env, char* data, size_t length);
+// Creates a Buffer that is a view on |length| bytes of |ab|, starting at
+// |byte_offset|.
+v8::MaybeLocal<v8::Object> New(Environment* env,
+                               v8::Local<v8::ArrayBuffer> ab,
+                               size_t byte_offset,
+                               size_t length);
 }  // namespace Buffer
 
 }  // namespace node
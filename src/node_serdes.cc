@@ -0,0 +1,1435 @@
+#include "node_serdes.h"
+#include "base-object.h"
+#include "base-object-inl.h"
+#include "node.h"
+#include "node_buffer.h"
+#include "node_internals.h"
+#include "env.h"
+#include "env-inl.h"
+#include "util.h"
+#include "util-inl.h"
+#include "v8.h"
+
+#include <string.h>
+
+#include <limits>
+
+namespace node {
+namespace serdes {
+
+using v8::Array;
+using v8::ArrayBuffer;
+using v8::ArrayBufferView;
+using v8::BooleanObject;
+using v8::Context;
+using v8::DataView;
+using v8::Date;
+using v8::Exception;
+using v8::Float32Array;
+using v8::Float64Array;
+using v8::Function;
+using v8::FunctionCallbackInfo;
+using v8::FunctionTemplate;
+using v8::IndexFilter;
+using v8::Int16Array;
+using v8::Int32Array;
+using v8::Int8Array;
+using v8::Integer;
+using v8::Isolate;
+using v8::Just;
+using v8::KeyCollectionMode;
+using v8::Local;
+using v8::Map;
+using v8::Maybe;
+using v8::MaybeLocal;
+using v8::NewStringType;
+using v8::Nothing;
+using v8::Number;
+using v8::NumberObject;
+using v8::Object;
+using v8::PropertyFilter;
+using v8::RegExp;
+using v8::Set;
+using v8::SharedArrayBuffer;
+using v8::String;
+using v8::StringObject;
+using v8::TryCatch;
+using v8::Uint16Array;
+using v8::Uint32Array;
+using v8::Uint8Array;
+using v8::Uint8ClampedArray;
+using v8::Value;
+
+// The format is a sequence of tagged values. Lengths and counts are written
+// as base 128 varints, integers in zigzag encoding so that small negative
+// numbers stay short, doubles in host byte order. Clones are only meant to
+// be read back by the same build of node, so there is no need to be more
+// portable than that.
+static const uint8_t kLatestVersion = 1;
+
+enum Tag : uint8_t {
+  kVersionTag = 0xFF,
+  kUndefinedTag = '_',
+  kNullTag = '0',
+  kTrueTag = 'T',
+  kFalseTag = 'F',
+  kInt32Tag = 'I',
+  kDoubleTag = 'N',
+  kOneByteStringTag = '"',
+  kTwoByteStringTag = 'c',
+  // Refers to an object that was written before, by order of appearance.
+  kBackReferenceTag = '^',
+  kObjectTag = 'o',
+  kDenseArrayTag = 'A',
+  kSparseArrayTag = 'a',
+  kDateTag = 'D',
+  kRegExpTag = 'R',
+  kMapTag = ';',
+  kSetTag = '\'',
+  kNumberObjectTag = 'n',
+  kStringObjectTag = 's',
+  kTrueObjectTag = 'y',
+  kFalseObjectTag = 'x',
+  kErrorTag = 'r',
+  kArrayBufferTag = 'B',
+  kSharedArrayBufferTag = 'u',
+  // A view with a copy of the bytes it covers, followed by a ViewTag.
+  kArrayBufferViewTag = 'V',
+  // A view on a SharedArrayBuffer, followed by a ViewTag, the id of the
+  // SharedArrayBuffer, the byte offset and the byte length.
+  kSharedArrayBufferViewTag = 'W',
+  // An object with native state, followed by whatever the delegate wrote.
+  kHostObjectTag = '\\',
+};
+
+enum ViewTag : uint8_t {
+  kInt8ArrayTag = 'b',
+  kUint8ArrayTag = 'B',
+  kUint8ClampedArrayTag = 'C',
+  kInt16ArrayTag = 'w',
+  kUint16ArrayTag = 'W',
+  kInt32ArrayTag = 'd',
+  kUint32ArrayTag = 'D',
+  kFloat32ArrayTag = 'f',
+  kFloat64ArrayTag = 'F',
+  kDataViewTag = '?',
+  // A Uint8Array with Buffer.prototype.
+  kNodeBufferTag = 'n',
+};
+
+enum ErrorTag : uint8_t {
+  kErrorPrototypeTag = 'e',
+  kRangeErrorPrototypeTag = 'R',
+  kReferenceErrorPrototypeTag = 'F',
+  kSyntaxErrorPrototypeTag = 'S',
+  kTypeErrorPrototypeTag = 'T',
+};
+
+// Deeper object graphs are rejected instead of overflowing the stack.
+static const uint32_t kMaxDepth = 4096;
+
+
+static ViewTag GetViewTag(Environment* env, Local<ArrayBufferView> view) {
+  if (view->IsUint8Array()) {
+    Local<Value> proto = view->GetPrototype();
+    if (proto == env->buffer_prototype_object())
+      return kNodeBufferTag;
+    return kUint8ArrayTag;
+  }
+  if (view->IsInt8Array()) return kInt8ArrayTag;
+  if (view->IsUint8ClampedArray()) return kUint8ClampedArrayTag;
+  if (view->IsInt16Array()) return kInt16ArrayTag;
+  if (view->IsUint16Array()) return kUint16ArrayTag;
+  if (view->IsInt32Array()) return kInt32ArrayTag;
+  if (view->IsUint32Array()) return kUint32ArrayTag;
+  if (view->IsFloat32Array()) return kFloat32ArrayTag;
+  if (view->IsFloat64Array()) return kFloat64ArrayTag;
+  CHECK(view->IsDataView());
+  return kDataViewTag;
+}
+
+
+static size_t GetElementSize(uint8_t tag) {
+  switch (tag) {
+    case kInt16ArrayTag:
+    case kUint16ArrayTag:
+      return 2;
+    case kInt32ArrayTag:
+    case kUint32ArrayTag:
+    case kFloat32ArrayTag:
+      return 4;
+    case kFloat64ArrayTag:
+      return 8;
+    default:
+      return 1;
+  }
+}
+
+
+Maybe<bool> Serializer::Delegate::WriteHostObject(Isolate* isolate,
+                                                  Local<Object> object) {
+  Environment::GetCurrent(isolate)->ThrowTypeError(
+      "Object could not be cloned.");
+  return Nothing<bool>();
+}
+
+
+MaybeLocal<Object> Deserializer::Delegate::ReadHostObject(Isolate* isolate) {
+  return MaybeLocal<Object>();
+}
+
+
+Serializer::Serializer(Environment* env, Delegate* delegate)
+    : env_(env),
+      delegate_(delegate),
+      depth_(0) {
+}
+
+
+void Serializer::WriteHeader() {
+  WriteTag(kVersionTag);
+  WriteVarint(kLatestVersion);
+}
+
+
+void Serializer::WriteTag(uint8_t tag) {
+  buffer_.push_back(tag);
+}
+
+
+void Serializer::WriteVarint(uint64_t value) {
+  do {
+    uint8_t byte = value & 0x7f;
+    value >>= 7;
+    if (value != 0)
+      byte |= 0x80;
+    buffer_.push_back(byte);
+  } while (value != 0);
+}
+
+
+void Serializer::WriteZigZag(int32_t value) {
+  WriteVarint((static_cast<uint32_t>(value) << 1) ^ (value >> 31));
+}
+
+
+void Serializer::WriteDouble(double value) {
+  WriteRawBytes(&value, sizeof(value));
+}
+
+
+void Serializer::WriteRawBytes(const void* data, size_t length) {
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  buffer_.insert(buffer_.end(), bytes, bytes + length);
+}
+
+
+void Serializer::WriteString(Local<String> string) {
+  const int length = string->Length();
+  if (string->IsOneByte()) {
+    WriteTag(kOneByteStringTag);
+    WriteVarint(length);
+    const size_t offset = buffer_.size();
+    buffer_.resize(offset + length);
+    string->WriteOneByte(buffer_.data() + offset, 0, length,
+                         String::NO_NULL_TERMINATION);
+  } else {
+    WriteTag(kTwoByteStringTag);
+    WriteVarint(length * sizeof(uint16_t));
+    // The position in the buffer is not necessarily aligned for uint16_t.
+    MaybeStackBuffer<uint16_t> storage(length);
+    string->Write(*storage, 0, length, String::NO_NULL_TERMINATION);
+    WriteRawBytes(*storage, length * sizeof(uint16_t));
+  }
+}
+
+
+Maybe<bool> Serializer::ThrowDataCloneError(const char* message) {
+  env_->ThrowTypeError(message);
+  return Nothing<bool>();
+}
+
+
+bool Serializer::WriteBackReference(Local<Object> object) {
+  const int hash = object->GetIdentityHash();
+  auto range = id_map_.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    if (objects_[it->second] == object) {
+      WriteTag(kBackReferenceTag);
+      WriteVarint(it->second);
+      return true;
+    }
+  }
+  id_map_.emplace(hash, static_cast<uint32_t>(objects_.size()));
+  objects_.push_back(object);
+  return false;
+}
+
+
+Maybe<bool> Serializer::WriteValue(Local<Context> context,
+                                   Local<Value> value) {
+  // Back references do not reach across top-level values, the handles of
+  // the objects of an earlier value may be gone by now.
+  if (depth_ == 0) {
+    id_map_.clear();
+    objects_.clear();
+  }
+
+  if (value->IsUndefined()) {
+    WriteTag(kUndefinedTag);
+  } else if (value->IsNull()) {
+    WriteTag(kNullTag);
+  } else if (value->IsTrue()) {
+    WriteTag(kTrueTag);
+  } else if (value->IsFalse()) {
+    WriteTag(kFalseTag);
+  } else if (value->IsInt32()) {
+    WriteTag(kInt32Tag);
+    WriteZigZag(value.As<Integer>()->Value());
+  } else if (value->IsNumber()) {
+    WriteTag(kDoubleTag);
+    WriteDouble(value.As<Number>()->Value());
+  } else if (value->IsString()) {
+    WriteString(value.As<String>());
+  } else if (value->IsObject()) {
+    return WriteObject(context, value.As<Object>());
+  } else {
+    return ThrowDataCloneError("Symbols could not be cloned.");
+  }
+  return Just(true);
+}
+
+
+Maybe<bool> Serializer::WriteObject(Local<Context> context,
+                                    Local<Object> object) {
+  if (object->IsFunction())
+    return ThrowDataCloneError("Functions could not be cloned.");
+  if (object->IsProxy() || object->IsPromise() || object->IsWeakMap() ||
+      object->IsWeakSet() || object->IsSymbolObject()) {
+    return ThrowDataCloneError("Object could not be cloned.");
+  }
+
+  if (WriteBackReference(object))
+    return Just(true);
+
+  if (depth_ >= kMaxDepth) {
+    env_->ThrowRangeError("Object graph is too deep to be cloned.");
+    return Nothing<bool>();
+  }
+
+  // No HandleScope here, objects_ keeps handles to everything that was
+  // written for the lifetime of the Serializer.
+  depth_++;
+  Maybe<bool> ok = Just(true);
+
+  if (object->IsArray()) {
+    Local<Array> array = object.As<Array>();
+    Local<Array> keys;
+    if (!array->GetPropertyNames(context,
+                                 KeyCollectionMode::kOwnOnly,
+                                 static_cast<PropertyFilter>(
+                                     v8::ONLY_ENUMERABLE | v8::SKIP_SYMBOLS),
+                                 IndexFilter::kIncludeIndices)
+            .ToLocal(&keys)) {
+      depth_--;
+      return Nothing<bool>();
+    }
+    const uint32_t length = array->Length();
+    if (keys->Length() == length) {
+      WriteTag(kDenseArrayTag);
+      WriteVarint(length);
+      for (uint32_t i = 0; i < length && ok.FromMaybe(false); i++) {
+        Local<Value> element;
+        if (!array->Get(context, i).ToLocal(&element))
+          ok = Nothing<bool>();
+        else
+          ok = WriteValue(context, element);
+      }
+    } else {
+      WriteTag(kSparseArrayTag);
+      WriteVarint(length);
+      ok = WriteProperties(context, array, keys);
+    }
+  } else if (object->IsDate()) {
+    WriteTag(kDateTag);
+    WriteDouble(object.As<Date>()->ValueOf());
+  } else if (object->IsRegExp()) {
+    Local<RegExp> regexp = object.As<RegExp>();
+    WriteTag(kRegExpTag);
+    WriteString(regexp->GetSource());
+    WriteVarint(regexp->GetFlags());
+  } else if (object->IsMap() || object->IsSet()) {
+    Local<Array> entries = object->IsMap() ? object.As<Map>()->AsArray()
+                                           : object.As<Set>()->AsArray();
+    const uint32_t length = entries->Length();
+    WriteTag(object->IsMap() ? kMapTag : kSetTag);
+    WriteVarint(length);
+    for (uint32_t i = 0; i < length && ok.FromMaybe(false); i++) {
+      Local<Value> entry;
+      if (!entries->Get(context, i).ToLocal(&entry))
+        ok = Nothing<bool>();
+      else
+        ok = WriteValue(context, entry);
+    }
+  } else if (object->IsNumberObject()) {
+    WriteTag(kNumberObjectTag);
+    WriteDouble(object.As<NumberObject>()->ValueOf());
+  } else if (object->IsStringObject()) {
+    WriteTag(kStringObjectTag);
+    WriteString(object.As<StringObject>()->ValueOf());
+  } else if (object->IsBooleanObject()) {
+    WriteTag(object.As<BooleanObject>()->ValueOf() ? kTrueObjectTag
+                                                   : kFalseObjectTag);
+  } else if (object->IsNativeError()) {
+    ok = WriteError(context, object);
+  } else if (object->IsSharedArrayBuffer()) {
+    if (delegate_ == nullptr) {
+      ok = ThrowDataCloneError("SharedArrayBuffer could not be cloned.");
+    } else {
+      Maybe<uint32_t> id = delegate_->GetSharedArrayBufferId(
+          env_->isolate(), object.As<SharedArrayBuffer>());
+      if (id.IsNothing()) {
+        ok = Nothing<bool>();
+      } else {
+        WriteTag(kSharedArrayBufferTag);
+        WriteVarint(id.FromJust());
+      }
+    }
+  } else if (object->IsArrayBuffer()) {
+    ArrayBuffer::Contents contents = object.As<ArrayBuffer>()->GetContents();
+    WriteTag(kArrayBufferTag);
+    WriteVarint(contents.ByteLength());
+    if (contents.ByteLength() > 0)
+      WriteRawBytes(contents.Data(), contents.ByteLength());
+  } else if (object->IsArrayBufferView()) {
+    ok = WriteArrayBufferView(context, object.As<ArrayBufferView>());
+  } else if (object->InternalFieldCount() > 0) {
+    // Checked last, V8 gives ArrayBuffers and their views internal fields
+    // as well.
+    if (delegate_ == nullptr) {
+      ok = ThrowDataCloneError("Object could not be cloned.");
+    } else {
+      WriteTag(kHostObjectTag);
+      ok = delegate_->WriteHostObject(env_->isolate(), object);
+    }
+  } else {
+    Local<Array> keys;
+    if (!object->GetPropertyNames(context,
+                                  KeyCollectionMode::kOwnOnly,
+                                  static_cast<PropertyFilter>(
+                                      v8::ONLY_ENUMERABLE | v8::SKIP_SYMBOLS),
+                                  IndexFilter::kIncludeIndices)
+            .ToLocal(&keys)) {
+      ok = Nothing<bool>();
+    } else {
+      WriteTag(kObjectTag);
+      ok = WriteProperties(context, object, keys);
+    }
+  }
+
+  depth_--;
+  return ok;
+}
+
+
+Maybe<bool> Serializer::WriteProperties(Local<Context> context,
+                                        Local<Object> object,
+                                        Local<Array> keys) {
+  const uint32_t count = keys->Length();
+  WriteVarint(count);
+  for (uint32_t i = 0; i < count; i++) {
+    Local<Value> key;
+    Local<Value> value;
+    if (!keys->Get(context, i).ToLocal(&key) ||
+        !object->Get(context, key).ToLocal(&value)) {
+      return Nothing<bool>();
+    }
+    // Indices come back as numbers, those above INT32_MAX are written as
+    // strings like any other key.
+    if (key->IsInt32() && key.As<Integer>()->Value() >= 0) {
+      WriteTag(kInt32Tag);
+      WriteZigZag(key.As<Integer>()->Value());
+    } else {
+      Local<String> string;
+      if (!key->ToString(context).ToLocal(&string))
+        return Nothing<bool>();
+      WriteString(string);
+    }
+    if (WriteValue(context, value).IsNothing())
+      return Nothing<bool>();
+  }
+  return Just(true);
+}
+
+
+Maybe<bool> Serializer::WriteArrayBufferView(Local<Context> context,
+                                             Local<ArrayBufferView> view) {
+  const ViewTag view_tag = GetViewTag(env_, view);
+  Local<ArrayBuffer> buffer = view->Buffer();
+
+  if (buffer->IsSharedArrayBuffer()) {
+    if (delegate_ == nullptr)
+      return ThrowDataCloneError("SharedArrayBuffer could not be cloned.");
+    Maybe<uint32_t> id = delegate_->GetSharedArrayBufferId(
+        env_->isolate(), buffer.As<Value>().As<SharedArrayBuffer>());
+    if (id.IsNothing())
+      return Nothing<bool>();
+    WriteTag(kSharedArrayBufferViewTag);
+    WriteTag(view_tag);
+    WriteVarint(id.FromJust());
+    WriteVarint(view->ByteOffset());
+    WriteVarint(view->ByteLength());
+    return Just(true);
+  }
+
+  const size_t length = view->ByteLength();
+  WriteTag(kArrayBufferViewTag);
+  WriteTag(view_tag);
+  WriteVarint(length);
+  const size_t offset = buffer_.size();
+  buffer_.resize(offset + length);
+  if (length > 0)
+    view->CopyContents(buffer_.data() + offset, length);
+  return Just(true);
+}
+
+
+Maybe<bool> Serializer::WriteError(Local<Context> context,
+                                   Local<Object> error) {
+  Isolate* isolate = env_->isolate();
+  Local<Value> name;
+  Local<Value> message;
+  Local<Value> stack;
+  if (!error->Get(context, env_->name_string()).ToLocal(&name) ||
+      !error->Get(context, env_->message_string()).ToLocal(&message) ||
+      !error->Get(context, env_->stack_string()).ToLocal(&stack)) {
+    return Nothing<bool>();
+  }
+
+  ErrorTag error_tag = kErrorPrototypeTag;
+  if (name->IsString()) {
+    node::Utf8Value name_string(isolate, name);
+    if (strcmp(*name_string, "RangeError") == 0)
+      error_tag = kRangeErrorPrototypeTag;
+    else if (strcmp(*name_string, "ReferenceError") == 0)
+      error_tag = kReferenceErrorPrototypeTag;
+    else if (strcmp(*name_string, "SyntaxError") == 0)
+      error_tag = kSyntaxErrorPrototypeTag;
+    else if (strcmp(*name_string, "TypeError") == 0)
+      error_tag = kTypeErrorPrototypeTag;
+  }
+
+  WriteTag(kErrorTag);
+  WriteTag(error_tag);
+  Local<String> string;
+  if (!message->ToString(context).ToLocal(&string))
+    return Nothing<bool>();
+  WriteString(string);
+  if (stack->IsString()) {
+    WriteString(stack.As<String>());
+  } else {
+    WriteTag(kUndefinedTag);
+  }
+  return Just(true);
+}
+
+
+Deserializer::Deserializer(Environment* env,
+                           const uint8_t* data,
+                           size_t length,
+                           Delegate* delegate)
+    : env_(env),
+      delegate_(delegate),
+      start_(data),
+      position_(data),
+      end_(data + length),
+      version_(0),
+      depth_(0) {
+}
+
+
+Maybe<bool> Deserializer::ReadHeader() {
+  uint8_t tag;
+  if (!ReadTag(&tag) || tag != kVersionTag || !ReadVarint32(&version_) ||
+      version_ != kLatestVersion) {
+    env_->ThrowError("Unable to deserialize cloned data due to invalid or "
+                     "unsupported version.");
+    return Nothing<bool>();
+  }
+  return Just(true);
+}
+
+
+bool Deserializer::ReadTag(uint8_t* tag) {
+  if (position_ >= end_)
+    return false;
+  *tag = *position_++;
+  return true;
+}
+
+
+bool Deserializer::ReadVarint(uint64_t* value) {
+  uint64_t result = 0;
+  unsigned shift = 0;
+  uint8_t byte;
+  do {
+    if (position_ >= end_ || shift >= 64)
+      return false;
+    byte = *position_++;
+    result |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    shift += 7;
+  } while (byte & 0x80);
+  *value = result;
+  return true;
+}
+
+
+bool Deserializer::ReadVarint32(uint32_t* value) {
+  uint64_t result;
+  if (!ReadVarint(&result) || result > std::numeric_limits<uint32_t>::max())
+    return false;
+  *value = static_cast<uint32_t>(result);
+  return true;
+}
+
+
+bool Deserializer::ReadZigZag(int32_t* value) {
+  uint32_t result;
+  if (!ReadVarint32(&result))
+    return false;
+  *value = static_cast<int32_t>((result >> 1) ^ -(result & 1));
+  return true;
+}
+
+
+bool Deserializer::ReadDouble(double* value) {
+  const uint8_t* data;
+  if (!ReadRawBytes(sizeof(*value), &data))
+    return false;
+  memcpy(value, data, sizeof(*value));
+  return true;
+}
+
+
+bool Deserializer::ReadRawBytes(size_t length, const uint8_t** data) {
+  if (length > static_cast<size_t>(end_ - position_))
+    return false;
+  *data = position_;
+  position_ += length;
+  return true;
+}
+
+
+MaybeLocal<String> Deserializer::ReadString(uint8_t tag) {
+  Isolate* isolate = env_->isolate();
+  uint32_t length;
+  const uint8_t* data;
+  if (!ReadVarint32(&length) || length > String::kMaxLength ||
+      !ReadRawBytes(length, &data)) {
+    return MaybeLocal<String>();
+  }
+
+  if (tag == kOneByteStringTag) {
+    return String::NewFromOneByte(isolate, data, NewStringType::kNormal,
+                                  length);
+  }
+
+  if (length % sizeof(uint16_t) != 0)
+    return MaybeLocal<String>();
+  const int chars = length / sizeof(uint16_t);
+  MaybeStackBuffer<uint16_t> storage(chars);
+  memcpy(*storage, data, length);
+  return String::NewFromTwoByte(isolate, *storage, NewStringType::kNormal,
+                                chars);
+}
+
+
+void Deserializer::AddObject(Local<Object> object) {
+  objects_.push_back(object);
+}
+
+
+MaybeLocal<Value> Deserializer::ReadValue(Local<Context> context) {
+  // See Serializer::WriteValue().
+  if (depth_ == 0)
+    objects_.clear();
+
+  TryCatch try_catch(env_->isolate());
+  Local<Value> value;
+  if (ReadValueInternal(context).ToLocal(&value))
+    return value;
+  // Keep an exception thrown by V8 or the delegate, it says more.
+  if (try_catch.HasCaught()) {
+    try_catch.ReThrow();
+    return MaybeLocal<Value>();
+  }
+  env_->ThrowError("Unable to deserialize cloned data.");
+  return MaybeLocal<Value>();
+}
+
+
+// Like the Serializer, this does not open HandleScopes of its own because
+// objects_ refers to every object that was read.
+MaybeLocal<Value> Deserializer::ReadValueInternal(Local<Context> context) {
+  Isolate* isolate = env_->isolate();
+
+  uint8_t tag;
+  if (!ReadTag(&tag))
+    return MaybeLocal<Value>();
+
+  switch (tag) {
+    case kUndefinedTag:
+      return v8::Undefined(isolate);
+    case kNullTag:
+      return v8::Null(isolate);
+    case kTrueTag:
+      return v8::True(isolate);
+    case kFalseTag:
+      return v8::False(isolate);
+    case kInt32Tag: {
+      int32_t value;
+      if (!ReadZigZag(&value))
+        return MaybeLocal<Value>();
+      return Integer::New(isolate, value);
+    }
+    case kDoubleTag: {
+      double value;
+      if (!ReadDouble(&value))
+        return MaybeLocal<Value>();
+      return Number::New(isolate, value);
+    }
+    case kOneByteStringTag:
+    case kTwoByteStringTag: {
+      Local<String> string;
+      if (!ReadString(tag).ToLocal(&string))
+        return MaybeLocal<Value>();
+      return string;
+    }
+    case kBackReferenceTag: {
+      uint32_t id;
+      if (!ReadVarint32(&id) || id >= objects_.size() ||
+          objects_[id].IsEmpty()) {
+        return MaybeLocal<Value>();
+      }
+      return objects_[id];
+    }
+    default:
+      break;
+  }
+
+  if (depth_ >= kMaxDepth)
+    return MaybeLocal<Value>();
+  depth_++;
+
+  Local<Value> result;
+  switch (tag) {
+    case kObjectTag: {
+      Local<Object> object = Object::New(isolate);
+      AddObject(object);
+      if (!ReadProperties(context, object).IsEmpty())
+        result = object;
+      break;
+    }
+    case kDenseArrayTag: {
+      uint32_t length;
+      // Every element takes at least one byte.
+      if (!ReadVarint32(&length) ||
+          length > static_cast<size_t>(end_ - position_)) {
+        break;
+      }
+      Local<Array> array = Array::New(isolate, length);
+      AddObject(array);
+      uint32_t i;
+      for (i = 0; i < length; i++) {
+        Local<Value> element;
+        if (!ReadValueInternal(context).ToLocal(&element) ||
+            !array->CreateDataProperty(context, i, element).FromMaybe(false)) {
+          break;
+        }
+      }
+      if (i == length)
+        result = array;
+      break;
+    }
+    case kSparseArrayTag: {
+      uint32_t length;
+      if (!ReadVarint32(&length))
+        break;
+      Local<Array> array = Array::New(isolate, 0);
+      AddObject(array);
+      if (array->Set(context, FIXED_ONE_BYTE_STRING(isolate, "length"),
+                     Number::New(isolate, length)).IsNothing() ||
+          ReadProperties(context, array).IsEmpty()) {
+        break;
+      }
+      result = array;
+      break;
+    }
+    case kDateTag: {
+      double value;
+      Local<Value> date;
+      if (!ReadDouble(&value) || !Date::New(context, value).ToLocal(&date))
+        break;
+      AddObject(date.As<Object>());
+      result = date;
+      break;
+    }
+    case kRegExpTag: {
+      uint8_t string_tag;
+      Local<String> source;
+      uint32_t flags;
+      Local<RegExp> regexp;
+      if (!ReadTag(&string_tag) ||
+          (string_tag != kOneByteStringTag &&
+           string_tag != kTwoByteStringTag) ||
+          !ReadString(string_tag).ToLocal(&source) ||
+          !ReadVarint32(&flags) ||
+          !RegExp::New(context, source, static_cast<RegExp::Flags>(flags))
+              .ToLocal(&regexp)) {
+        break;
+      }
+      AddObject(regexp);
+      result = regexp;
+      break;
+    }
+    case kMapTag: {
+      uint32_t length;
+      if (!ReadVarint32(&length) || length % 2 != 0)
+        break;
+      Local<Map> map = Map::New(isolate);
+      AddObject(map);
+      uint32_t i;
+      for (i = 0; i < length; i += 2) {
+        Local<Value> key;
+        Local<Value> value;
+        if (!ReadValueInternal(context).ToLocal(&key) ||
+            !ReadValueInternal(context).ToLocal(&value) ||
+            map->Set(context, key, value).IsEmpty()) {
+          break;
+        }
+      }
+      if (i == length)
+        result = map;
+      break;
+    }
+    case kSetTag: {
+      uint32_t length;
+      if (!ReadVarint32(&length))
+        break;
+      Local<Set> set = Set::New(isolate);
+      AddObject(set);
+      uint32_t i;
+      for (i = 0; i < length; i++) {
+        Local<Value> value;
+        if (!ReadValueInternal(context).ToLocal(&value) ||
+            set->Add(context, value).IsEmpty()) {
+          break;
+        }
+      }
+      if (i == length)
+        result = set;
+      break;
+    }
+    case kNumberObjectTag: {
+      double value;
+      if (!ReadDouble(&value))
+        break;
+      result = NumberObject::New(isolate, value);
+      AddObject(result.As<Object>());
+      break;
+    }
+    case kStringObjectTag: {
+      uint8_t string_tag;
+      Local<String> string;
+      if (!ReadTag(&string_tag) ||
+          (string_tag != kOneByteStringTag &&
+           string_tag != kTwoByteStringTag) ||
+          !ReadString(string_tag).ToLocal(&string)) {
+        break;
+      }
+      result = StringObject::New(string);
+      AddObject(result.As<Object>());
+      break;
+    }
+    case kTrueObjectTag:
+    case kFalseObjectTag:
+      result = BooleanObject::New(isolate, tag == kTrueObjectTag);
+      AddObject(result.As<Object>());
+      break;
+    case kErrorTag:
+      ReadError(context).ToLocal(&result);
+      break;
+    case kArrayBufferTag: {
+      uint32_t length;
+      const uint8_t* data;
+      if (!ReadVarint32(&length) || !ReadRawBytes(length, &data))
+        break;
+      Local<ArrayBuffer> array_buffer = ArrayBuffer::New(isolate, length);
+      if (length > 0)
+        memcpy(array_buffer->GetContents().Data(), data, length);
+      AddObject(array_buffer);
+      result = array_buffer;
+      break;
+    }
+    case kSharedArrayBufferTag: {
+      uint32_t id;
+      Local<SharedArrayBuffer> array_buffer;
+      if (delegate_ == nullptr || !ReadVarint32(&id) ||
+          !delegate_->GetSharedArrayBufferFromId(isolate, id)
+              .ToLocal(&array_buffer)) {
+        break;
+      }
+      AddObject(array_buffer);
+      result = array_buffer;
+      break;
+    }
+    case kArrayBufferViewTag:
+    case kSharedArrayBufferViewTag:
+      ReadArrayBufferView(context, tag).ToLocal(&result);
+      break;
+    case kHostObjectTag: {
+      // The delegate may read values of its own. The Serializer assigned
+      // the host object its id before those, so reserve it here as well.
+      const size_t id = objects_.size();
+      objects_.emplace_back();
+      Local<Object> object;
+      if (delegate_ == nullptr ||
+          !delegate_->ReadHostObject(isolate).ToLocal(&object)) {
+        break;
+      }
+      objects_[id] = object;
+      result = object;
+      break;
+    }
+    default:
+      break;
+  }
+
+  depth_--;
+  if (result.IsEmpty())
+    return MaybeLocal<Value>();
+  return result;
+}
+
+
+MaybeLocal<Value> Deserializer::ReadProperties(Local<Context> context,
+                                               Local<Object> object) {
+  uint32_t count;
+  if (!ReadVarint32(&count))
+    return MaybeLocal<Value>();
+  for (uint32_t i = 0; i < count; i++) {
+    uint8_t tag;
+    if (!ReadTag(&tag))
+      return MaybeLocal<Value>();
+
+    Maybe<bool> created = Nothing<bool>();
+    if (tag == kInt32Tag) {
+      int32_t index;
+      Local<Value> value;
+      if (!ReadZigZag(&index) || index < 0 ||
+          !ReadValueInternal(context).ToLocal(&value)) {
+        return MaybeLocal<Value>();
+      }
+      created = object->CreateDataProperty(context, index, value);
+    } else if (tag == kOneByteStringTag || tag == kTwoByteStringTag) {
+      Local<String> key;
+      Local<Value> value;
+      if (!ReadString(tag).ToLocal(&key) ||
+          !ReadValueInternal(context).ToLocal(&value)) {
+        return MaybeLocal<Value>();
+      }
+      // Defines own properties, a "__proto__" key must not end up calling
+      // the Object.prototype.__proto__ setter.
+      created = object->CreateDataProperty(context, key, value);
+    }
+    if (!created.FromMaybe(false))
+      return MaybeLocal<Value>();
+  }
+  return object;
+}
+
+
+MaybeLocal<Value> Deserializer::ReadArrayBufferView(Local<Context> context,
+                                                    uint8_t tag) {
+  Isolate* isolate = env_->isolate();
+  uint8_t view_tag;
+  if (!ReadTag(&view_tag))
+    return MaybeLocal<Value>();
+
+  Local<ArrayBuffer> buffer;
+  uint32_t offset = 0;
+  uint32_t length;
+  if (tag == kSharedArrayBufferViewTag) {
+    uint32_t id;
+    Local<SharedArrayBuffer> shared;
+    if (delegate_ == nullptr || !ReadVarint32(&id) ||
+        !ReadVarint32(&offset) || !ReadVarint32(&length)) {
+      return MaybeLocal<Value>();
+    }
+    if (!delegate_->GetSharedArrayBufferFromId(isolate, id).ToLocal(&shared))
+      return MaybeLocal<Value>();
+    if (offset > shared->ByteLength() ||
+        length > shared->ByteLength() - offset) {
+      return MaybeLocal<Value>();
+    }
+    buffer = shared.As<Value>().As<ArrayBuffer>();
+  } else {
+    const uint8_t* data;
+    if (!ReadVarint32(&length) || !ReadRawBytes(length, &data))
+      return MaybeLocal<Value>();
+    if (view_tag == kNodeBufferTag) {
+      Local<Object> buffer_object;
+      if (!Buffer::Copy(env_, reinterpret_cast<const char*>(data), length)
+              .ToLocal(&buffer_object)) {
+        return MaybeLocal<Value>();
+      }
+      AddObject(buffer_object);
+      return buffer_object;
+    }
+    buffer = ArrayBuffer::New(isolate, length);
+    if (length > 0)
+      memcpy(buffer->GetContents().Data(), data, length);
+  }
+
+  const size_t element_size = GetElementSize(view_tag);
+  if (offset % element_size != 0 || length % element_size != 0)
+    return MaybeLocal<Value>();
+  const size_t count = length / element_size;
+
+  Local<Object> view;
+  switch (view_tag) {
+    case kNodeBufferTag:
+      if (!Buffer::New(env_, buffer, offset, length).ToLocal(&view))
+        return MaybeLocal<Value>();
+      break;
+    case kUint8ArrayTag:
+      view = Uint8Array::New(buffer, offset, count);
+      break;
+    case kInt8ArrayTag:
+      view = Int8Array::New(buffer, offset, count);
+      break;
+    case kUint8ClampedArrayTag:
+      view = Uint8ClampedArray::New(buffer, offset, count);
+      break;
+    case kInt16ArrayTag:
+      view = Int16Array::New(buffer, offset, count);
+      break;
+    case kUint16ArrayTag:
+      view = Uint16Array::New(buffer, offset, count);
+      break;
+    case kInt32ArrayTag:
+      view = Int32Array::New(buffer, offset, count);
+      break;
+    case kUint32ArrayTag:
+      view = Uint32Array::New(buffer, offset, count);
+      break;
+    case kFloat32ArrayTag:
+      view = Float32Array::New(buffer, offset, count);
+      break;
+    case kFloat64ArrayTag:
+      view = Float64Array::New(buffer, offset, count);
+      break;
+    case kDataViewTag:
+      view = DataView::New(buffer, offset, length);
+      break;
+    default:
+      return MaybeLocal<Value>();
+  }
+  AddObject(view);
+  return view;
+}
+
+
+MaybeLocal<Value> Deserializer::ReadError(Local<Context> context) {
+  uint8_t error_tag;
+  uint8_t string_tag;
+  Local<String> message;
+  if (!ReadTag(&error_tag) || !ReadTag(&string_tag) ||
+      (string_tag != kOneByteStringTag && string_tag != kTwoByteStringTag) ||
+      !ReadString(string_tag).ToLocal(&message)) {
+    return MaybeLocal<Value>();
+  }
+
+  Local<Value> error;
+  switch (error_tag) {
+    case kErrorPrototypeTag:
+      error = Exception::Error(message);
+      break;
+    case kRangeErrorPrototypeTag:
+      error = Exception::RangeError(message);
+      break;
+    case kReferenceErrorPrototypeTag:
+      error = Exception::ReferenceError(message);
+      break;
+    case kSyntaxErrorPrototypeTag:
+      error = Exception::SyntaxError(message);
+      break;
+    case kTypeErrorPrototypeTag:
+      error = Exception::TypeError(message);
+      break;
+    default:
+      return MaybeLocal<Value>();
+  }
+  AddObject(error.As<Object>());
+
+  if (!ReadTag(&string_tag))
+    return MaybeLocal<Value>();
+  if (string_tag == kOneByteStringTag || string_tag == kTwoByteStringTag) {
+    Local<String> stack;
+    if (!ReadString(string_tag).ToLocal(&stack) ||
+        error.As<Object>()->Set(context, env_->stack_string(), stack)
+            .IsNothing()) {
+      return MaybeLocal<Value>();
+    }
+  } else if (string_tag != kUndefinedTag) {
+    return MaybeLocal<Value>();
+  }
+  return error;
+}
+
+
+// The Serializer and Deserializer classes of process.binding('v8'), which
+// lib/v8.js exposes. Objects with native state are handed to the
+// _writeHostObject() and _readHostObject() methods of the JS object, which
+// can use the raw write and read methods to store them.
+class SerializerContext : public BaseObject, public Serializer::Delegate {
+ public:
+  SerializerContext(Environment* env, Local<Object> wrap)
+      : BaseObject(env, wrap),
+        serializer_(env, this) {
+    MakeWeak<SerializerContext>(this);
+  }
+
+  ~SerializerContext() override {}
+
+  Maybe<uint32_t> GetSharedArrayBufferId(
+      Isolate* isolate, Local<SharedArrayBuffer> array_buffer) override;
+  Maybe<bool> WriteHostObject(Isolate* isolate, Local<Object> input) override;
+
+  static void New(const FunctionCallbackInfo<Value>& args);
+  static void WriteHeader(const FunctionCallbackInfo<Value>& args);
+  static void WriteValue(const FunctionCallbackInfo<Value>& args);
+  static void ReleaseBuffer(const FunctionCallbackInfo<Value>& args);
+  static void WriteUint32(const FunctionCallbackInfo<Value>& args);
+  static void WriteUint64(const FunctionCallbackInfo<Value>& args);
+  static void WriteDouble(const FunctionCallbackInfo<Value>& args);
+  static void WriteRawBytes(const FunctionCallbackInfo<Value>& args);
+
+ private:
+  Serializer serializer_;
+};
+
+
+class DeserializerContext : public BaseObject,
+                            public Deserializer::Delegate {
+ public:
+  DeserializerContext(Environment* env,
+                      Local<Object> wrap,
+                      Local<ArrayBufferView> buffer)
+      : BaseObject(env, wrap),
+        data_(static_cast<const uint8_t*>(
+                  buffer->Buffer()->GetContents().Data()) +
+              buffer->ByteOffset()),
+        deserializer_(env, data_, buffer->ByteLength(), this) {
+    // The Deserializer points into the memory of |buffer|, keep it alive.
+    wrap->Set(env->context(), env->buffer_string(), buffer).FromJust();
+    MakeWeak<DeserializerContext>(this);
+  }
+
+  ~DeserializerContext() override {}
+
+  MaybeLocal<SharedArrayBuffer> GetSharedArrayBufferFromId(
+      Isolate* isolate, uint32_t id) override;
+  MaybeLocal<Object> ReadHostObject(Isolate* isolate) override;
+
+  static void New(const FunctionCallbackInfo<Value>& args);
+  static void ReadHeader(const FunctionCallbackInfo<Value>& args);
+  static void ReadValue(const FunctionCallbackInfo<Value>& args);
+  static void GetWireFormatVersion(const FunctionCallbackInfo<Value>& args);
+  static void ReadUint32(const FunctionCallbackInfo<Value>& args);
+  static void ReadUint64(const FunctionCallbackInfo<Value>& args);
+  static void ReadDouble(const FunctionCallbackInfo<Value>& args);
+  static void ReadRawBytes(const FunctionCallbackInfo<Value>& args);
+
+ private:
+  void ThrowReadError();
+
+  const uint8_t* const data_;
+  Deserializer deserializer_;
+};
+
+
+Maybe<uint32_t> SerializerContext::GetSharedArrayBufferId(
+    Isolate* isolate, Local<SharedArrayBuffer> array_buffer) {
+  env()->ThrowTypeError("SharedArrayBuffer could not be cloned.");
+  return Nothing<uint32_t>();
+}
+
+
+Maybe<bool> SerializerContext::WriteHostObject(Isolate* isolate,
+                                               Local<Object> input) {
+  Local<Context> context = env()->context();
+  Local<Object> wrap = object();
+  Local<Value> method;
+  if (!wrap->Get(context, env()->write_host_object_string()).ToLocal(&method))
+    return Nothing<bool>();
+  if (!method->IsFunction())
+    return Serializer::Delegate::WriteHostObject(isolate, input);
+
+  Local<Value> argv[] = { input };
+  if (method.As<Function>()->Call(context, wrap, arraysize(argv), argv)
+          .IsEmpty()) {
+    return Nothing<bool>();
+  }
+  return Just(true);
+}
+
+
+void SerializerContext::New(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  if (!args.IsConstructCall())
+    return env->ThrowTypeError("Class constructor Serializer cannot be "
+                               "invoked without 'new'");
+  new SerializerContext(env, args.This());
+}
+
+
+void SerializerContext::WriteHeader(const FunctionCallbackInfo<Value>& args) {
+  SerializerContext* ctx;
+  ASSIGN_OR_RETURN_UNWRAP(&ctx, args.Holder());
+  ctx->serializer_.WriteHeader();
+}
+
+
+void SerializerContext::WriteValue(const FunctionCallbackInfo<Value>& args) {
+  SerializerContext* ctx;
+  ASSIGN_OR_RETURN_UNWRAP(&ctx, args.Holder());
+  Maybe<bool> ok =
+      ctx->serializer_.WriteValue(ctx->env()->context(), args[0]);
+  if (ok.IsJust())
+    args.GetReturnValue().Set(ok.FromJust());
+}
+
+
+void SerializerContext::ReleaseBuffer(
+    const FunctionCallbackInfo<Value>& args) {
+  SerializerContext* ctx;
+  ASSIGN_OR_RETURN_UNWRAP(&ctx, args.Holder());
+  std::vector<uint8_t> data = ctx->serializer_.Release();
+  Local<Object> buffer;
+  if (Buffer::Copy(ctx->env(),
+                   reinterpret_cast<const char*>(data.data()),
+                   data.size()).ToLocal(&buffer)) {
+    args.GetReturnValue().Set(buffer);
+  }
+}
+
+
+void SerializerContext::WriteUint32(const FunctionCallbackInfo<Value>& args) {
+  SerializerContext* ctx;
+  ASSIGN_OR_RETURN_UNWRAP(&ctx, args.Holder());
+  uint32_t value;
+  if (!args[0]->Uint32Value(ctx->env()->context()).To(&value))
+    return;
+  ctx->serializer_.WriteVarint(value);
+}
+
+
+void SerializerContext::WriteUint64(const FunctionCallbackInfo<Value>& args) {
+  SerializerContext* ctx;
+  ASSIGN_OR_RETURN_UNWRAP(&ctx, args.Holder());
+  Local<Context> context = ctx->env()->context();
+  uint32_t hi;
+  uint32_t lo;
+  if (!args[0]->Uint32Value(context).To(&hi) ||
+      !args[1]->Uint32Value(context).To(&lo)) {
+    return;
+  }
+  ctx->serializer_.WriteVarint((static_cast<uint64_t>(hi) << 32) | lo);
+}
+
+
+void SerializerContext::WriteDouble(const FunctionCallbackInfo<Value>& args) {
+  SerializerContext* ctx;
+  ASSIGN_OR_RETURN_UNWRAP(&ctx, args.Holder());
+  double value;
+  if (!args[0]->NumberValue(ctx->env()->context()).To(&value))
+    return;
+  ctx->serializer_.WriteDouble(value);
+}
+
+
+void SerializerContext::WriteRawBytes(
+    const FunctionCallbackInfo<Value>& args) {
+  SerializerContext* ctx;
+  ASSIGN_OR_RETURN_UNWRAP(&ctx, args.Holder());
+  if (!args[0]->IsArrayBufferView()) {
+    return ctx->env()->ThrowTypeError(
+        "source must be a TypedArray or a DataView");
+  }
+  Local<ArrayBufferView> view = args[0].As<ArrayBufferView>();
+  const char* data =
+      static_cast<const char*>(view->Buffer()->GetContents().Data());
+  ctx->serializer_.WriteRawBytes(data + view->ByteOffset(),
+                                 view->ByteLength());
+}
+
+
+MaybeLocal<SharedArrayBuffer> DeserializerContext::GetSharedArrayBufferFromId(
+    Isolate* isolate, uint32_t id) {
+  return MaybeLocal<SharedArrayBuffer>();
+}
+
+
+MaybeLocal<Object> DeserializerContext::ReadHostObject(Isolate* isolate) {
+  Local<Context> context = env()->context();
+  Local<Object> wrap = object();
+  Local<Value> method;
+  if (!wrap->Get(context, env()->read_host_object_string()).ToLocal(&method))
+    return MaybeLocal<Object>();
+  if (!method->IsFunction())
+    return Deserializer::Delegate::ReadHostObject(isolate);
+
+  Local<Value> result;
+  if (!method.As<Function>()->Call(context, wrap, 0, nullptr)
+          .ToLocal(&result)) {
+    return MaybeLocal<Object>();
+  }
+  if (!result->IsObject()) {
+    env()->ThrowTypeError("_readHostObject must return an object");
+    return MaybeLocal<Object>();
+  }
+  return result.As<Object>();
+}
+
+
+void DeserializerContext::ThrowReadError() {
+  env()->ThrowError("Unable to deserialize cloned data.");
+}
+
+
+void DeserializerContext::New(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  if (!args.IsConstructCall())
+    return env->ThrowTypeError("Class constructor Deserializer cannot be "
+                               "invoked without 'new'");
+  if (!args[0]->IsArrayBufferView()) {
+    return env->ThrowTypeError(
+        "buffer must be a TypedArray or a DataView");
+  }
+  new DeserializerContext(env, args.This(), args[0].As<ArrayBufferView>());
+}
+
+
+void DeserializerContext::ReadHeader(const FunctionCallbackInfo<Value>& args) {
+  DeserializerContext* ctx;
+  ASSIGN_OR_RETURN_UNWRAP(&ctx, args.Holder());
+  Maybe<bool> ok = ctx->deserializer_.ReadHeader();
+  if (ok.IsJust())
+    args.GetReturnValue().Set(ok.FromJust());
+}
+
+
+void DeserializerContext::ReadValue(const FunctionCallbackInfo<Value>& args) {
+  DeserializerContext* ctx;
+  ASSIGN_OR_RETURN_UNWRAP(&ctx, args.Holder());
+  Local<Value> value;
+  if (ctx->deserializer_.ReadValue(ctx->env()->context()).ToLocal(&value))
+    args.GetReturnValue().Set(value);
+}
+
+
+void DeserializerContext::GetWireFormatVersion(
+    const FunctionCallbackInfo<Value>& args) {
+  DeserializerContext* ctx;
+  ASSIGN_OR_RETURN_UNWRAP(&ctx, args.Holder());
+  args.GetReturnValue().Set(ctx->deserializer_.version());
+}
+
+
+void DeserializerContext::ReadUint32(const FunctionCallbackInfo<Value>& args) {
+  DeserializerContext* ctx;
+  ASSIGN_OR_RETURN_UNWRAP(&ctx, args.Holder());
+  uint32_t value;
+  if (!ctx->deserializer_.ReadVarint32(&value))
+    return ctx->ThrowReadError();
+  args.GetReturnValue().Set(value);
+}
+
+
+// Returns [hi, lo], JS numbers cannot hold all 64 bit integers.
+void DeserializerContext::ReadUint64(const FunctionCallbackInfo<Value>& args) {
+  DeserializerContext* ctx;
+  ASSIGN_OR_RETURN_UNWRAP(&ctx, args.Holder());
+  Isolate* isolate = ctx->env()->isolate();
+  uint64_t value;
+  if (!ctx->deserializer_.ReadVarint(&value))
+    return ctx->ThrowReadError();
+  Local<Array> result = Array::New(isolate, 2);
+  result->Set(0, Integer::NewFromUnsigned(isolate,
+                                          static_cast<uint32_t>(value >> 32)));
+  result->Set(1, Integer::NewFromUnsigned(isolate,
+                                          static_cast<uint32_t>(value)));
+  args.GetReturnValue().Set(result);
+}
+
+
+void DeserializerContext::ReadDouble(const FunctionCallbackInfo<Value>& args) {
+  DeserializerContext* ctx;
+  ASSIGN_OR_RETURN_UNWRAP(&ctx, args.Holder());
+  double value;
+  if (!ctx->deserializer_.ReadDouble(&value))
+    return ctx->ThrowReadError();
+  args.GetReturnValue().Set(value);
+}
+
+
+// Skips args[0] bytes and returns the offset at which they start, so that
+// lib/v8.js can hand out a slice of the input without copying it.
+void DeserializerContext::ReadRawBytes(
+    const FunctionCallbackInfo<Value>& args) {
+  DeserializerContext* ctx;
+  ASSIGN_OR_RETURN_UNWRAP(&ctx, args.Holder());
+  uint32_t length;
+  if (!args[0]->Uint32Value(ctx->env()->context()).To(&length))
+    return;
+  const uint8_t* data;
+  if (!ctx->deserializer_.ReadRawBytes(length, &data))
+    return ctx->ThrowReadError();
+  args.GetReturnValue().Set(static_cast<uint32_t>(data - ctx->data_));
+}
+
+
+void InitializeBindings(Environment* env, Local<Object> target) {
+  Local<FunctionTemplate> ser =
+      env->NewFunctionTemplate(SerializerContext::New);
+  ser->InstanceTemplate()->SetInternalFieldCount(1);
+  ser->SetClassName(FIXED_ONE_BYTE_STRING(env->isolate(), "Serializer"));
+  env->SetProtoMethod(ser, "writeHeader", SerializerContext::WriteHeader);
+  env->SetProtoMethod(ser, "writeValue", SerializerContext::WriteValue);
+  env->SetProtoMethod(ser, "releaseBuffer", SerializerContext::ReleaseBuffer);
+  env->SetProtoMethod(ser, "writeUint32", SerializerContext::WriteUint32);
+  env->SetProtoMethod(ser, "writeUint64", SerializerContext::WriteUint64);
+  env->SetProtoMethod(ser, "writeDouble", SerializerContext::WriteDouble);
+  env->SetProtoMethod(ser, "writeRawBytes", SerializerContext::WriteRawBytes);
+  target->Set(FIXED_ONE_BYTE_STRING(env->isolate(), "Serializer"),
+              ser->GetFunction());
+
+  Local<FunctionTemplate> des =
+      env->NewFunctionTemplate(DeserializerContext::New);
+  des->InstanceTemplate()->SetInternalFieldCount(1);
+  des->SetClassName(FIXED_ONE_BYTE_STRING(env->isolate(), "Deserializer"));
+  env->SetProtoMethod(des, "readHeader", DeserializerContext::ReadHeader);
+  env->SetProtoMethod(des, "readValue", DeserializerContext::ReadValue);
+  env->SetProtoMethod(des, "getWireFormatVersion",
+                      DeserializerContext::GetWireFormatVersion);
+  env->SetProtoMethod(des, "readUint32", DeserializerContext::ReadUint32);
+  env->SetProtoMethod(des, "readUint64", DeserializerContext::ReadUint64);
+  env->SetProtoMethod(des, "readDouble", DeserializerContext::ReadDouble);
+  env->SetProtoMethod(des, "_readRawBytes", DeserializerContext::ReadRawBytes);
+  target->Set(FIXED_ONE_BYTE_STRING(env->isolate(), "Deserializer"),
+              des->GetFunction());
+}
+
+}  // namespace serdes
+}  // namespace node
@@ -0,0 +1,172 @@
+#ifndef SRC_NODE_SERDES_H_
+#define SRC_NODE_SERDES_H_
+
+#if defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#include "v8.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <unordered_map>
+#include <vector>
+
+namespace node {
+
+class Environment;
+
+namespace serdes {
+
+// A structured clone of JS values into a flat byte buffer, used to move
+// values between isolates. It follows the HTML structured clone algorithm
+// closely: primitives, plain objects and arrays, Date, RegExp, Map, Set,
+// Error objects, ArrayBuffers and their views are supported, object
+// identity and cycles are preserved. Functions, symbols and objects that
+// are backed by native state cannot be cloned.
+//
+// SharedArrayBuffers are never copied, they are handed to the Delegate
+// which decides how the memory is shared with the receiving side.
+
+class Serializer {
+ public:
+  class Delegate {
+   public:
+    virtual ~Delegate() {}
+    // Returns the id under which the receiving Deserializer::Delegate can
+    // find |array_buffer| again, or Nothing with a pending exception.
+    virtual v8::Maybe<uint32_t> GetSharedArrayBufferId(
+        v8::Isolate* isolate,
+        v8::Local<v8::SharedArrayBuffer> array_buffer) = 0;
+    // Writes |object|, which is backed by native state, through the public
+    // Write* methods of the Serializer. Returns Nothing with a pending
+    // exception when it cannot be cloned, which is what the default does.
+    virtual v8::Maybe<bool> WriteHostObject(v8::Isolate* isolate,
+                                            v8::Local<v8::Object> object);
+  };
+
+  Serializer(Environment* env, Delegate* delegate);
+
+  // Writes the format version, must come before the first value.
+  void WriteHeader();
+
+  // Appends |value| to the buffer. Returns Nothing with a pending exception
+  // when |value| cannot be cloned. Objects are only deduplicated within a
+  // single top-level value.
+  v8::Maybe<bool> WriteValue(v8::Local<v8::Context> context,
+                             v8::Local<v8::Value> value);
+
+  inline const std::vector<uint8_t>& buffer() const { return buffer_; }
+  inline std::vector<uint8_t> Release() { return std::move(buffer_); }
+
+  // Raw data without a tag, for host objects and for users that add data
+  // of their own around the values. Read back with the matching Read*
+  // methods of the Deserializer.
+  void WriteVarint(uint64_t value);
+  void WriteDouble(double value);
+  void WriteRawBytes(const void* data, size_t length);
+
+ private:
+  void WriteTag(uint8_t tag);
+  void WriteZigZag(int32_t value);
+  void WriteString(v8::Local<v8::String> string);
+
+  v8::Maybe<bool> WriteObject(v8::Local<v8::Context> context,
+                              v8::Local<v8::Object> object);
+  v8::Maybe<bool> WriteProperties(v8::Local<v8::Context> context,
+                                  v8::Local<v8::Object> object,
+                                  v8::Local<v8::Array> keys);
+  v8::Maybe<bool> WriteArrayBufferView(v8::Local<v8::Context> context,
+                                       v8::Local<v8::ArrayBufferView> view);
+  v8::Maybe<bool> WriteError(v8::Local<v8::Context> context,
+                             v8::Local<v8::Object> error);
+
+  // Returns true and writes a back reference if |object| was seen before,
+  // otherwise assigns it the next id.
+  bool WriteBackReference(v8::Local<v8::Object> object);
+
+  v8::Maybe<bool> ThrowDataCloneError(const char* message);
+
+  Environment* env_;
+  Delegate* delegate_;
+  std::vector<uint8_t> buffer_;
+  uint32_t depth_;
+  // Objects seen so far, bucketed by identity hash.
+  std::unordered_multimap<int, uint32_t> id_map_;
+  std::vector<v8::Local<v8::Object>> objects_;
+};
+
+
+class Deserializer {
+ public:
+  class Delegate {
+   public:
+    virtual ~Delegate() {}
+    // Returns the SharedArrayBuffer that the sending side registered as
+    // |id|, or an empty handle with a pending exception.
+    virtual v8::MaybeLocal<v8::SharedArrayBuffer> GetSharedArrayBufferFromId(
+        v8::Isolate* isolate, uint32_t id) = 0;
+    // Reads an object that Serializer::Delegate::WriteHostObject() wrote.
+    // The default fails, which makes the data count as malformed.
+    virtual v8::MaybeLocal<v8::Object> ReadHostObject(v8::Isolate* isolate);
+  };
+
+  Deserializer(Environment* env,
+               const uint8_t* data,
+               size_t length,
+               Delegate* delegate);
+
+  // Checks the format version. Returns Nothing with a pending exception
+  // when the data was written by an incompatible version.
+  v8::Maybe<bool> ReadHeader();
+
+  // Reads the next value. Returns an empty handle with a pending exception
+  // when the data is malformed.
+  v8::MaybeLocal<v8::Value> ReadValue(v8::Local<v8::Context> context);
+
+  inline bool done() const { return position_ == end_; }
+  inline uint32_t version() const { return version_; }
+  // The offset of the next byte to read, from the start of the data.
+  inline size_t offset() const { return position_ - start_; }
+
+  // Counterparts of the raw Serializer::Write* methods. Return false when
+  // there is not enough data left. |data| points into the buffer that was
+  // passed to the constructor.
+  bool ReadVarint(uint64_t* value);
+  bool ReadVarint32(uint32_t* value);
+  bool ReadDouble(double* value);
+  bool ReadRawBytes(size_t length, const uint8_t** data);
+
+ private:
+  bool ReadTag(uint8_t* tag);
+  bool ReadZigZag(int32_t* value);
+  v8::MaybeLocal<v8::String> ReadString(uint8_t tag);
+
+  v8::MaybeLocal<v8::Value> ReadProperties(v8::Local<v8::Context> context,
+                                           v8::Local<v8::Object> object);
+  v8::MaybeLocal<v8::Value> ReadValueInternal(v8::Local<v8::Context> context);
+  v8::MaybeLocal<v8::Value> ReadArrayBufferView(v8::Local<v8::Context> context,
+                                                uint8_t tag);
+  v8::MaybeLocal<v8::Value> ReadError(v8::Local<v8::Context> context);
+
+  void AddObject(v8::Local<v8::Object> object);
+
+  Environment* env_;
+  Delegate* delegate_;
+  const uint8_t* const start_;
+  const uint8_t* position_;
+  const uint8_t* const end_;
+  uint32_t version_;
+  std::vector<v8::Local<v8::Object>> objects_;
+  uint32_t depth_;
+};
+
+// Adds the Serializer and Deserializer classes that lib/v8.js exposes to
+// |target|, which is process.binding('v8').
+void InitializeBindings(Environment* env, v8::Local<v8::Object> target);
+
+}  // namespace serdes
+}  // namespace node
+
+#endif  // defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#endif  // SRC_NODE_SERDES_H_
@@ -0,0 +1,32 @@
+#ifndef SRC_NODE_SNAPSHOT_H_
+#define SRC_NODE_SNAPSHOT_H_
+
+#if defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#include "v8.h"
+
+#include <stddef.h>
+
+namespace node {
+
+// The startup snapshot is produced by tools/snapshot/node_mksnapshot.cc when
+// node is configured with --with-node-snapshot. On top of V8's own snapshot
+// it contains a context in which the wrapper functions of all core modules,
+// and the bootstrap function, have already been compiled.
+
+// Index of that context, context 0 is the default context used for
+// vm contexts and is left alone.
+constexpr size_t kNodeSnapshotContextIndex = 1;
+
+// Name of the global property that holds the precompiled functions, keyed by
+// native module id. LoadEnvironment() removes it before running any JS.
+#define NODE_SNAPSHOT_NATIVES_KEY "__node_natives__"
+
+// Returns the snapshot blob or nullptr when node was built without one.
+v8::StartupData* NodeSnapshotBlob();
+
+}  // namespace node
+
+#endif  // defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#endif  // SRC_NODE_SNAPSHOT_H_
@@ -0,0 +1,11 @@
+// Used when node is built without --with-node-snapshot, see node_snapshot.h.
+
+#include "node_snapshot.h"
+
+namespace node {
+
+v8::StartupData* NodeSnapshotBlob() {
+  return nullptr;
+}
+
+}  // namespace node
@@ -1,4 +1,6 @@
 #include "node.h"
+#include "node_buffer.h"
+#include "node_serdes.h"
 #include "env.h"
 #include "env-inl.h"
 #include "util.h"
@@ -94,6 +96,44 @@ void SetFlagsFromString(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+// Clones args[0] into a new Buffer, see src/node_serdes.h. The first args[1]
+// bytes of the Buffer are left for the caller, e.g. for a frame header.
+void Serialize(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  const size_t offset = args[1]->IsUint32() ? args[1].As<Uint32>()->Value() : 0;
+
+  serdes::Serializer serializer(env, nullptr);
+  serializer.WriteHeader();
+  if (serializer.WriteValue(env->context(), args[0]).IsNothing())
+    return;
+
+  const std::vector<uint8_t>& data = serializer.buffer();
+  Local<Object> buffer;
+  if (!Buffer::New(env, offset + data.size()).ToLocal(&buffer))
+    return;
+  memcpy(Buffer::Data(buffer) + offset, data.data(), data.size());
+  args.GetReturnValue().Set(buffer);
+}
+
+
+void Deserialize(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  if (!Buffer::HasInstance(args[0]))
+    return env->ThrowTypeError("argument must be a Buffer or Uint8Array");
+
+  serdes::Deserializer deserializer(
+      env,
+      reinterpret_cast<const uint8_t*>(Buffer::Data(args[0])),
+      Buffer::Length(args[0]),
+      nullptr);
+  if (deserializer.ReadHeader().IsNothing())
+    return;
+  Local<Value> value;
+  if (deserializer.ReadValue(env->context()).ToLocal(&value))
+    args.GetReturnValue().Set(value);
+}
+
+
 void InitializeV8Bindings(Local<Object> target,
                           Local<Value> unused,
                           Local<Context> context) {
@@ -170,6 +210,10 @@ void InitializeV8Bindings(Local<Object> target,
 #undef V
 
   env->SetMethod(target, "setFlagsFromString", SetFlagsFromString);
+
+  env->SetMethod(target, "serialize", Serialize);
+  env->SetMethod(target, "deserialize", Deserialize);
+  serdes::InitializeBindings(env, target);
 }
 
 }  // namespace node
@@ -0,0 +1,686 @@
+#include "node_worker.h"
+#include "node.h"
+#include "node_internals.h"
+#include "node_serdes.h"
+#include "async-wrap.h"
+#include "async-wrap-inl.h"
+#include "env.h"
+#include "env-inl.h"
+#include "handle_wrap.h"
+#include "util.h"
+#include "util-inl.h"
+#include "uv.h"
+#include "v8.h"
+
+#include <limits.h>  // PATH_MAX
+#include <stdlib.h>
+#include <string.h>
+
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+namespace node {
+namespace worker {
+
+using v8::Boolean;
+using v8::Context;
+using v8::Exception;
+using v8::FunctionCallbackInfo;
+using v8::FunctionTemplate;
+using v8::HandleScope;
+using v8::Integer;
+using v8::Isolate;
+using v8::Just;
+using v8::Local;
+using v8::Locker;
+using v8::Maybe;
+using v8::MaybeLocal;
+using v8::Nothing;
+using v8::Number;
+using v8::Object;
+using v8::Persistent;
+using v8::SharedArrayBuffer;
+using v8::String;
+using v8::TryCatch;
+using v8::Value;
+using v8::WeakCallbackInfo;
+
+// Protects the two registries below and SharedArrayBufferStore::refs_.
+static Mutex registry_mutex;
+// Shared memory by data pointer. A multimap because V8 may hand out the same
+// pointer, or no pointer at all, for zero-length buffers.
+static std::unordered_multimap<void*, SharedArrayBufferStore*> stores;
+static std::unordered_map<Isolate*,
+    std::unordered_set<SharedArrayBufferStore::Tracker*>> trackers;
+
+// Only used on the main thread, workers cannot start workers of their own.
+// Workers whose thread has been started but not joined yet.
+static std::unordered_set<Worker*> live_workers;
+static uint64_t next_thread_id = 1;
+
+
+// Holds a reference to the store for as long as the JS object is alive.
+class SharedArrayBufferStore::Tracker {
+ public:
+  Tracker(Isolate* isolate,
+          Local<SharedArrayBuffer> object,
+          SharedArrayBufferStore* store)
+      : isolate_(isolate), handle_(isolate, object), store_(store) {
+    handle_.SetWeak(this, WeakCallback, v8::WeakCallbackType::kParameter);
+  }
+
+  // Drops the reference, the caller has removed the tracker from the
+  // registry already.
+  void Dispose() {
+    handle_.Reset();
+    store_->Unref();
+    delete this;
+  }
+
+ private:
+  static void WeakCallback(const WeakCallbackInfo<Tracker>& data) {
+    Tracker* tracker = data.GetParameter();
+    {
+      Mutex::ScopedLock lock(registry_mutex);
+      trackers[tracker->isolate_].erase(tracker);
+    }
+    tracker->Dispose();
+  }
+
+  Isolate* const isolate_;
+  Persistent<SharedArrayBuffer> handle_;
+  SharedArrayBufferStore* const store_;
+};
+
+
+SharedArrayBufferStore::SharedArrayBufferStore(void* data, size_t length)
+    : data_(data), length_(length), refs_(0) {
+}
+
+
+SharedArrayBufferStore* SharedArrayBufferStore::ForSharedArrayBuffer(
+    Isolate* isolate, Local<SharedArrayBuffer> array_buffer) {
+  if (array_buffer->IsExternal()) {
+    void* data = array_buffer->GetContents().Data();
+    Mutex::ScopedLock lock(registry_mutex);
+    auto it = stores.find(data);
+    if (it == stores.end())
+      return nullptr;
+    it->second->refs_++;
+    return it->second;
+  }
+
+  SharedArrayBuffer::Contents contents = array_buffer->Externalize();
+  SharedArrayBufferStore* store =
+      new SharedArrayBufferStore(contents.Data(), contents.ByteLength());
+  {
+    Mutex::ScopedLock lock(registry_mutex);
+    stores.emplace(store->data_, store);
+    store->refs_++;
+  }
+  store->Track(isolate, array_buffer);
+  return store;
+}
+
+
+Local<SharedArrayBuffer> SharedArrayBufferStore::GetSharedArrayBuffer(
+    Isolate* isolate) {
+  Local<SharedArrayBuffer> array_buffer =
+      SharedArrayBuffer::New(isolate, data_, length_);
+  Track(isolate, array_buffer);
+  return array_buffer;
+}
+
+
+void SharedArrayBufferStore::Track(Isolate* isolate,
+                                   Local<SharedArrayBuffer> object) {
+  Mutex::ScopedLock lock(registry_mutex);
+  refs_++;
+  trackers[isolate].insert(new Tracker(isolate, object, this));
+}
+
+
+void SharedArrayBufferStore::DisposeIsolate(Isolate* isolate) {
+  std::unordered_set<Tracker*> isolate_trackers;
+  {
+    Mutex::ScopedLock lock(registry_mutex);
+    auto it = trackers.find(isolate);
+    if (it == trackers.end())
+      return;
+    isolate_trackers.swap(it->second);
+    trackers.erase(it);
+  }
+  for (Tracker* tracker : isolate_trackers)
+    tracker->Dispose();
+}
+
+
+void SharedArrayBufferStore::Ref() {
+  Mutex::ScopedLock lock(registry_mutex);
+  refs_++;
+}
+
+
+void SharedArrayBufferStore::Unref() {
+  {
+    Mutex::ScopedLock lock(registry_mutex);
+    CHECK_GT(refs_, 0);
+    if (--refs_ > 0)
+      return;
+    auto range = stores.equal_range(data_);
+    for (auto it = range.first; it != range.second; ++it) {
+      if (it->second == this) {
+        stores.erase(it);
+        break;
+      }
+    }
+  }
+  // Allocated by node::ArrayBufferAllocator.
+  free(data_);
+  delete this;
+}
+
+
+class SerializerDelegate : public serdes::Serializer::Delegate {
+ public:
+  explicit SerializerDelegate(Message* message) : message_(message) {}
+
+  Maybe<uint32_t> GetSharedArrayBufferId(
+      Isolate* isolate, Local<SharedArrayBuffer> array_buffer) override {
+    SharedArrayBufferStore* store =
+        SharedArrayBufferStore::ForSharedArrayBuffer(isolate, array_buffer);
+    if (store == nullptr) {
+      isolate->ThrowException(Exception::TypeError(FIXED_ONE_BYTE_STRING(
+          isolate, "An externalized SharedArrayBuffer could not be cloned.")));
+      return Nothing<uint32_t>();
+    }
+
+    std::vector<SharedArrayBufferStore*>& list =
+        message_->shared_array_buffers_;
+    for (size_t i = 0; i < list.size(); i++) {
+      if (list[i] == store) {
+        store->Unref();
+        return Just(static_cast<uint32_t>(i));
+      }
+    }
+    list.push_back(store);
+    return Just(static_cast<uint32_t>(list.size() - 1));
+  }
+
+ private:
+  Message* const message_;
+};
+
+
+class DeserializerDelegate : public serdes::Deserializer::Delegate {
+ public:
+  explicit DeserializerDelegate(Message* message) : message_(message) {}
+
+  MaybeLocal<SharedArrayBuffer> GetSharedArrayBufferFromId(
+      Isolate* isolate, uint32_t id) override {
+    if (id >= message_->shared_array_buffers_.size()) {
+      isolate->ThrowException(Exception::Error(FIXED_ONE_BYTE_STRING(
+          isolate, "Invalid SharedArrayBuffer id.")));
+      return MaybeLocal<SharedArrayBuffer>();
+    }
+    return message_->shared_array_buffers_[id]->GetSharedArrayBuffer(isolate);
+  }
+
+ private:
+  Message* const message_;
+};
+
+
+Message::Message(Message&& other)
+    : data_(std::move(other.data_)),
+      shared_array_buffers_(std::move(other.shared_array_buffers_)) {
+  other.shared_array_buffers_.clear();
+}
+
+
+Message::~Message() {
+  for (SharedArrayBufferStore* store : shared_array_buffers_)
+    store->Unref();
+}
+
+
+Maybe<bool> Message::Serialize(Environment* env,
+                               Local<Context> context,
+                               Local<Value> value) {
+  SerializerDelegate delegate(this);
+  serdes::Serializer serializer(env, &delegate);
+  serializer.WriteHeader();
+  if (serializer.WriteValue(context, value).IsNothing())
+    return Nothing<bool>();
+  data_ = serializer.Release();
+  return Just(true);
+}
+
+
+MaybeLocal<Value> Message::Deserialize(Environment* env,
+                                       Local<Context> context) {
+  DeserializerDelegate delegate(this);
+  serdes::Deserializer deserializer(env, data_.data(), data_.size(), &delegate);
+  if (deserializer.ReadHeader().IsNothing())
+    return MaybeLocal<Value>();
+  return deserializer.ReadValue(context);
+}
+
+
+Worker::Worker(Environment* env,
+               Local<Object> object,
+               const char* entry_point,
+               bool is_eval,
+               Message&& worker_data)
+    : AsyncWrap(env, object, AsyncWrap::PROVIDER_WORKER),
+      worker_data_(std::move(worker_data)),
+      isolate_(nullptr),
+      child_env_(nullptr),
+      entry_point_(entry_point, entry_point + strlen(entry_point) + 1),
+      is_eval_(is_eval),
+      thread_id_(next_thread_id++),
+      exit_code_(0),
+      running_(false),
+      stop_requested_(false),
+      stopped_(false),
+      thread_started_(false),
+      thread_joined_(false) {
+  Wrap(object, this);
+  CHECK_EQ(0, uv_async_init(env->event_loop(), &parent_async_, OnParentAsync));
+}
+
+
+Worker::~Worker() {
+  CHECK(!thread_started_ || thread_joined_);
+  CHECK(persistent().IsEmpty());
+}
+
+
+void Worker::New(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  CHECK(args.IsConstructCall());
+  CHECK(args[0]->IsString());
+
+  Message worker_data;
+  if (worker_data.Serialize(env, env->context(), args[2]).IsNothing())
+    return;
+
+  node::Utf8Value entry_point(env->isolate(), args[0]);
+  new Worker(env,
+             args.This(),
+             *entry_point,
+             args[1]->IsTrue(),
+             std::move(worker_data));
+}
+
+
+void Worker::StartThread(const FunctionCallbackInfo<Value>& args) {
+  Worker* w;
+  ASSIGN_OR_RETURN_UNWRAP(&w, args.Holder());
+  CHECK(!w->thread_started_);
+
+  live_workers.insert(w);
+  w->thread_started_ = true;
+  CHECK_EQ(0, uv_thread_create(&w->tid_, [](void* arg) {
+    static_cast<Worker*>(arg)->Run();
+  }, w));
+}
+
+
+void Worker::PostMessageToChild(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  Worker* w;
+  ASSIGN_OR_RETURN_UNWRAP(&w, args.Holder());
+
+  Message message;
+  if (message.Serialize(env, env->context(), args[0]).IsNothing())
+    return;
+
+  Mutex::ScopedLock lock(w->mutex_);
+  if (w->stopped_)
+    return;
+  w->to_child_.push_back(std::move(message));
+  if (w->running_)
+    uv_async_send(&w->child_async_);
+}
+
+
+void Worker::Terminate(const FunctionCallbackInfo<Value>& args) {
+  Worker* w;
+  ASSIGN_OR_RETURN_UNWRAP(&w, args.Holder());
+  w->StopThread();
+}
+
+
+void Worker::Ref(const FunctionCallbackInfo<Value>& args) {
+  Worker* w;
+  ASSIGN_OR_RETURN_UNWRAP(&w, args.Holder());
+  if (!w->thread_joined_)
+    uv_ref(reinterpret_cast<uv_handle_t*>(&w->parent_async_));
+}
+
+
+void Worker::Unref(const FunctionCallbackInfo<Value>& args) {
+  Worker* w;
+  ASSIGN_OR_RETURN_UNWRAP(&w, args.Holder());
+  if (!w->thread_joined_)
+    uv_unref(reinterpret_cast<uv_handle_t*>(&w->parent_async_));
+}
+
+
+void Worker::PostMessageToParent(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  Worker* w = env->worker_context();
+
+  Message message;
+  if (message.Serialize(env, env->context(), args[0]).IsNothing())
+    return;
+
+  Mutex::ScopedLock lock(w->mutex_);
+  w->to_parent_.push_back(std::move(message));
+  uv_async_send(&w->parent_async_);
+}
+
+
+void Worker::GetWorkerData(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  Worker* w = env->worker_context();
+  Local<Value> value;
+  if (w->worker_data_.Deserialize(env, env->context()).ToLocal(&value))
+    args.GetReturnValue().Set(value);
+}
+
+
+void Worker::RefParentPort(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  Worker* w = env->worker_context();
+  uv_ref(reinterpret_cast<uv_handle_t*>(&w->child_async_));
+}
+
+
+void Worker::UnrefParentPort(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  Worker* w = env->worker_context();
+  uv_unref(reinterpret_cast<uv_handle_t*>(&w->child_async_));
+}
+
+
+std::deque<Message> Worker::TakeMessages(std::deque<Message>* queue) {
+  std::deque<Message> messages;
+  Mutex::ScopedLock lock(mutex_);
+  messages.swap(*queue);
+  return messages;
+}
+
+
+void Worker::OnParentAsync(uv_async_t* handle) {
+  Worker* w = ContainerOf(&Worker::parent_async_, handle);
+  Environment* env = w->env();
+  HandleScope handle_scope(env->isolate());
+  Context::Scope context_scope(env->context());
+
+  // Check first, the thread posts no more messages once it has stopped.
+  bool stopped;
+  int exit_code;
+  {
+    Mutex::ScopedLock lock(w->mutex_);
+    stopped = w->stopped_;
+    exit_code = w->exit_code_;
+  }
+
+  for (Message& message : w->TakeMessages(&w->to_parent_)) {
+    HandleScope scope(env->isolate());
+    TryCatch try_catch(env->isolate());
+    Local<Value> value;
+    if (!message.Deserialize(env, env->context()).ToLocal(&value)) {
+      FatalException(env->isolate(), try_catch);
+      continue;
+    }
+    w->MakeCallback(env->onmessage_string(), 1, &value);
+  }
+
+  if (!stopped)
+    return;
+
+  w->JoinThread();
+  Local<Value> arg = Integer::New(env->isolate(), exit_code);
+  w->MakeCallback(env->onexit_string(), 1, &arg);
+
+  uv_close(reinterpret_cast<uv_handle_t*>(handle), [](uv_handle_t* handle) {
+    Worker* w = ContainerOf(&Worker::parent_async_,
+                            reinterpret_cast<uv_async_t*>(handle));
+    w->MakeWeak<Worker>(w);
+  });
+}
+
+
+void Worker::OnChildAsync(uv_async_t* handle) {
+  Worker* w = ContainerOf(&Worker::child_async_, handle);
+  Environment* env = w->child_env_;
+
+  bool stop_requested;
+  {
+    Mutex::ScopedLock lock(w->mutex_);
+    stop_requested = w->stop_requested_;
+  }
+  if (stop_requested)
+    return w->Exit(1);
+
+  HandleScope handle_scope(env->isolate());
+  Context::Scope context_scope(env->context());
+  Local<Object> parent_port =
+      PersistentToLocal(env->isolate(), w->parent_port_);
+
+  for (Message& message : w->TakeMessages(&w->to_child_)) {
+    if (env->is_stopping_worker())
+      break;
+    HandleScope scope(env->isolate());
+    TryCatch try_catch(env->isolate());
+    Local<Value> value;
+    if (!message.Deserialize(env, env->context()).ToLocal(&value)) {
+      FatalException(env->isolate(), try_catch);
+      continue;
+    }
+    node::MakeCallback(env, parent_port, env->onmessage_string(), 1, &value);
+  }
+}
+
+
+void Worker::Exit(int code) {
+  {
+    Mutex::ScopedLock lock(mutex_);
+    exit_code_ = code;
+  }
+  child_env_->set_stopping_worker();
+  uv_stop(&loop_);
+  isolate_->TerminateExecution();
+}
+
+
+void Worker::StopThread() {
+  Mutex::ScopedLock lock(mutex_);
+  if (stop_requested_ || stopped_)
+    return;
+  stop_requested_ = true;
+  if (running_) {
+    isolate_->TerminateExecution();
+    uv_async_send(&child_async_);
+  }
+}
+
+
+void Worker::JoinThread() {
+  if (thread_joined_)
+    return;
+  CHECK_EQ(0, uv_thread_join(&tid_));
+  thread_joined_ = true;
+  live_workers.erase(this);
+}
+
+
+void Worker::StopAllWorkers() {
+  std::unordered_set<Worker*> workers(live_workers);
+  for (Worker* w : workers) {
+    w->StopThread();
+    w->JoinThread();
+  }
+}
+
+
+void Worker::Run() {
+  CHECK_EQ(0, uv_loop_init(&loop_));
+  uv_loop_configure(&loop_, UV_LOOP_USE_IO_URING);
+
+  char exec_path[PATH_MAX];
+  size_t exec_path_len = sizeof(exec_path);
+  if (uv_exepath(exec_path, &exec_path_len) != 0)
+    snprintf(exec_path, sizeof(exec_path), "node");
+
+  ArrayBufferAllocator allocator;
+  Isolate::CreateParams params;
+  params.array_buffer_allocator = &allocator;
+  Isolate* isolate = Isolate::New(params);
+  CHECK_NE(isolate, nullptr);
+  SetIsolateUpForNode(isolate);
+  isolate_ = isolate;
+
+  {
+    Locker locker(isolate);
+    Isolate::Scope isolate_scope(isolate);
+    HandleScope handle_scope(isolate);
+    IsolateData isolate_data(isolate, &loop_, allocator.zero_fill_field());
+    Local<Context> context = Context::New(isolate);
+    Context::Scope context_scope(context);
+    {
+      Environment env(&isolate_data, context);
+      env.set_worker_context(this);
+      child_env_ = &env;
+
+      // Unreferenced until JS land listens for messages from the parent.
+      CHECK_EQ(0, uv_async_init(&loop_, &child_async_, OnChildAsync));
+      uv_unref(reinterpret_cast<uv_handle_t*>(&child_async_));
+
+      const char* argv[] = {
+        exec_path,
+        is_eval_ ? "[worker eval]" : entry_point_.data()
+      };
+      env.Start(arraysize(argv), argv, 0, nullptr, false);
+
+      bool stop_requested;
+      {
+        Mutex::ScopedLock lock(mutex_);
+        stop_requested = stop_requested_;
+        running_ = !stop_requested;
+        if (running_ && !to_child_.empty())
+          uv_async_send(&child_async_);
+      }
+
+      if (!stop_requested) {
+        {
+          Environment::AsyncCallbackScope callback_scope(&env);
+          LoadEnvironment(&env);
+        }
+        SpinEventLoop(&env);
+      }
+
+      // From here on the parent thread does not touch the isolate anymore,
+      // which makes it safe to run the 'exit' handlers.
+      bool emit_exit;
+      {
+        Mutex::ScopedLock lock(mutex_);
+        running_ = false;
+        if (stop_requested_ && !env.is_stopping_worker())
+          exit_code_ = 1;
+        emit_exit = !stop_requested_ && !env.is_stopping_worker();
+      }
+      isolate->CancelTerminateExecution();
+
+      if (emit_exit) {
+        const int exit_code = EmitExit(&env);
+        Mutex::ScopedLock lock(mutex_);
+        if (!env.is_stopping_worker())
+          exit_code_ = exit_code;
+      }
+
+      env.set_stopping_worker();
+      isolate->CancelTerminateExecution();
+      parent_port_.Reset();
+
+      // Close everything that is still open. Requests that are in flight
+      // run to completion but their callbacks do not enter JS land anymore.
+      for (HandleWrap* wrap : *env.handle_wrap_queue())
+        wrap->Close();
+      env.CleanupHandles();
+      uv_walk(&loop_, [](uv_handle_t* handle, void* arg) {
+        if (!uv_is_closing(handle))
+          uv_close(handle, nullptr);
+      }, nullptr);
+      while (uv_run(&loop_, UV_RUN_DEFAULT) != 0) {}
+      CHECK_EQ(0, uv_loop_close(&loop_));
+
+      child_env_ = nullptr;
+    }
+
+    SharedArrayBufferStore::DisposeIsolate(isolate);
+  }
+
+  isolate->Dispose();
+
+  {
+    Mutex::ScopedLock lock(mutex_);
+    isolate_ = nullptr;
+    stopped_ = true;
+  }
+  uv_async_send(&parent_async_);
+}
+
+
+void Worker::Initialize(Local<Object> target,
+                        Local<Value> unused,
+                        Local<Context> context) {
+  Environment* env = Environment::GetCurrent(context);
+  Isolate* isolate = env->isolate();
+
+  target->Set(FIXED_ONE_BYTE_STRING(isolate, "isMainThread"),
+              Boolean::New(isolate, env->is_main_thread()));
+
+  if (env->is_main_thread()) {
+    target->Set(FIXED_ONE_BYTE_STRING(isolate, "threadId"),
+                Integer::New(isolate, 0));
+
+    Local<FunctionTemplate> t = env->NewFunctionTemplate(New);
+    t->InstanceTemplate()->SetInternalFieldCount(1);
+    t->SetClassName(FIXED_ONE_BYTE_STRING(isolate, "Worker"));
+
+    env->SetProtoMethod(t, "startThread", StartThread);
+    env->SetProtoMethod(t, "postMessage", PostMessageToChild);
+    env->SetProtoMethod(t, "terminate", Terminate);
+    env->SetProtoMethod(t, "ref", Ref);
+    env->SetProtoMethod(t, "unref", Unref);
+
+    target->Set(FIXED_ONE_BYTE_STRING(isolate, "Worker"), t->GetFunction());
+    return;
+  }
+
+  Worker* w = env->worker_context();
+  target->Set(FIXED_ONE_BYTE_STRING(isolate, "threadId"),
+              Number::New(isolate, static_cast<double>(w->thread_id_)));
+  target->Set(FIXED_ONE_BYTE_STRING(isolate, "isEval"),
+              Boolean::New(isolate, w->is_eval_));
+  target->Set(FIXED_ONE_BYTE_STRING(isolate, "entryPoint"),
+              String::NewFromUtf8(isolate, w->entry_point_.data()));
+
+  env->SetMethod(target, "postMessage", PostMessageToParent);
+  env->SetMethod(target, "getWorkerData", GetWorkerData);
+  env->SetMethod(target, "refParentPort", RefParentPort);
+  env->SetMethod(target, "unrefParentPort", UnrefParentPort);
+
+  // Messages from the parent are delivered to target.onmessage.
+  w->parent_port_.Reset(isolate, target);
+}
+
+}  // namespace worker
+}  // namespace node
+
+NODE_MODULE_CONTEXT_AWARE_BUILTIN(worker, node::worker::Worker::Initialize)
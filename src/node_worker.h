@@ -0,0 +1,182 @@
+#ifndef SRC_NODE_WORKER_H_
+#define SRC_NODE_WORKER_H_
+
+#if defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#include "async-wrap.h"
+#include "node_mutex.h"
+#include "util.h"
+#include "uv.h"
+#include "v8.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <deque>
+#include <vector>
+
+namespace node {
+
+class Environment;
+
+namespace worker {
+
+// The memory behind a SharedArrayBuffer that has been handed to another
+// thread. V8 does not know that the memory is shared, every isolate sees it
+// as an externalized SharedArrayBuffer of its own. The store keeps a count
+// of the JS objects and in-flight messages that refer to it and frees the
+// memory once the last one is gone.
+class SharedArrayBufferStore {
+ public:
+  // Returns the store for |array_buffer| with a reference for the caller,
+  // externalizing it first if this is the first time it is shared. Returns
+  // nullptr when |array_buffer| was externalized by someone else.
+  static SharedArrayBufferStore* ForSharedArrayBuffer(
+      v8::Isolate* isolate, v8::Local<v8::SharedArrayBuffer> array_buffer);
+
+  // Creates a new SharedArrayBuffer in |isolate| that is backed by the store.
+  v8::Local<v8::SharedArrayBuffer> GetSharedArrayBuffer(v8::Isolate* isolate);
+
+  // Drops the references held by the SharedArrayBuffers of |isolate|, which
+  // is about to be disposed and will not run their weak callbacks anymore.
+  static void DisposeIsolate(v8::Isolate* isolate);
+
+  void Ref();
+  void Unref();
+
+  // Ties a reference to the lifetime of a SharedArrayBuffer object.
+  class Tracker;
+
+ private:
+
+  SharedArrayBufferStore(void* data, size_t length);
+  void Track(v8::Isolate* isolate, v8::Local<v8::SharedArrayBuffer> object);
+
+  void* const data_;
+  const size_t length_;
+  int refs_;  // Protected by the registry mutex.
+
+  DISALLOW_COPY_AND_ASSIGN(SharedArrayBufferStore);
+};
+
+
+// A value that is serialized on one thread and deserialized on another.
+class Message {
+ public:
+  Message() {}
+  Message(Message&& other);
+  ~Message();
+
+  // Returns Nothing with a pending exception when |value| cannot be cloned.
+  v8::Maybe<bool> Serialize(Environment* env,
+                            v8::Local<v8::Context> context,
+                            v8::Local<v8::Value> value);
+  // Returns an empty handle with a pending exception on malformed data.
+  v8::MaybeLocal<v8::Value> Deserialize(Environment* env,
+                                        v8::Local<v8::Context> context);
+
+ private:
+  friend class SerializerDelegate;
+  friend class DeserializerDelegate;
+
+  std::vector<uint8_t> data_;
+  // Each entry holds a reference that is dropped when the message is gone.
+  std::vector<SharedArrayBufferStore*> shared_array_buffers_;
+
+  Message(const Message&) = delete;
+  Message& operator=(const Message&) = delete;
+};
+
+
+// A JS environment that runs in an isolate and event loop of its own on a
+// separate thread. The Worker object lives in the parent environment, the
+// child environment finds it again through Environment::worker_context().
+class Worker : public AsyncWrap {
+ public:
+  static void Initialize(v8::Local<v8::Object> target,
+                         v8::Local<v8::Value> unused,
+                         v8::Local<v8::Context> context);
+
+  // Stops the worker from the worker thread, either through process.exit()
+  // or because of an uncaught exception. Does not return to JS land.
+  void Exit(int code);
+
+  // Terminates all workers that are still running and waits for their
+  // threads, called when the main thread is done.
+  static void StopAllWorkers();
+
+  ~Worker() override;
+
+  inline uint64_t thread_id() const { return thread_id_; }
+
+  size_t self_size() const override { return sizeof(*this); }
+
+ private:
+  Worker(Environment* env,
+         v8::Local<v8::Object> object,
+         const char* entry_point,
+         bool is_eval,
+         Message&& worker_data);
+
+  static void New(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void StartThread(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void PostMessageToChild(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void Terminate(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void Ref(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void Unref(const v8::FunctionCallbackInfo<v8::Value>& args);
+
+  // Methods of process.binding('worker') inside of the worker.
+  static void PostMessageToParent(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void GetWorkerData(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void RefParentPort(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void UnrefParentPort(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
+
+  static void OnParentAsync(uv_async_t* handle);
+  static void OnChildAsync(uv_async_t* handle);
+
+  void Run();
+  void StopThread();
+  void JoinThread();
+  // Takes the messages out of |queue| while holding the lock.
+  std::deque<Message> TakeMessages(std::deque<Message>* queue);
+
+  Mutex mutex_;
+  std::deque<Message> to_child_;
+  std::deque<Message> to_parent_;
+  Message worker_data_;
+
+  // Lives on the loop of the parent, wakes it up for messages and exit.
+  uv_async_t parent_async_;
+  // Lives on the loop of the worker, only valid while |running_| is true.
+  uv_async_t child_async_;
+
+  uv_thread_t tid_;
+  uv_loop_t loop_;
+  v8::Isolate* isolate_;
+  Environment* child_env_;
+  v8::Persistent<v8::Object> parent_port_;
+
+  const std::vector<char> entry_point_;
+  const bool is_eval_;
+  const uint64_t thread_id_;
+
+  // All protected by |mutex_|.
+  int exit_code_;
+  bool running_;
+  bool stop_requested_;
+  bool stopped_;
+
+  // Only used on the parent thread.
+  bool thread_started_;
+  bool thread_joined_;
+};
+
+}  // namespace worker
+}  // namespace node
+
+#endif  // defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#endif  // SRC_NODE_WORKER_H_
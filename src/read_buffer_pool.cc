@@ -0,0 +1,132 @@
+#include "read_buffer_pool.h"
+
+#include "env.h"
+#include "env-inl.h"
+#include "node_buffer.h"
+#include "node_internals.h"
+#include "util.h"
+#include "util-inl.h"
+
+#include <stdlib.h>  // free()
+
+namespace node {
+
+using v8::Local;
+using v8::MaybeLocal;
+using v8::Object;
+
+
+ReadBufferPool::Chunk::Chunk(ReadBufferPool* pool)
+    : pool_(pool),
+      data_(node::Malloc(kChunkSize)) {
+}
+
+
+ReadBufferPool::Chunk::~Chunk() {
+  free(data_);
+}
+
+
+void ReadBufferPool::Chunk::Free(char* data, void* hint) {
+  Chunk* chunk = static_cast<Chunk*>(hint);
+  CHECK_EQ(data, chunk->data_);
+  chunk->chunk_list_.Remove();
+  if (chunk->pool_ == nullptr)
+    delete chunk;  // The pool is gone.
+  else
+    chunk->pool_->Recycle(chunk);
+}
+
+
+ReadBufferPool::ReadBufferPool(Environment* env)
+    : env_(env),
+      pending_(nullptr),
+      hits_(0),
+      misses_(0),
+      bytes_pinned_(0) {
+}
+
+
+ReadBufferPool::~ReadBufferPool() {
+  delete pending_;
+  for (Chunk* chunk : free_list_)
+    delete chunk;
+  // Chunks that are still pinned are freed along with their ArrayBuffers.
+  while (Chunk* chunk = pinned_.PopFront())
+    chunk->pool_ = nullptr;
+}
+
+
+void ReadBufferPool::Allocate(size_t suggested_size, uv_buf_t* buf) {
+  if (pending_ != nullptr || suggested_size > kChunkSize) {
+    misses_ += 1;
+    buf->base = node::Malloc(suggested_size);
+    buf->len = suggested_size;
+    return;
+  }
+
+  if (free_list_.empty()) {
+    misses_ += 1;
+    pending_ = new Chunk(this);
+  } else {
+    hits_ += 1;
+    pending_ = free_list_.back();
+    free_list_.pop_back();
+  }
+
+  buf->base = pending_->data_;
+  buf->len = kChunkSize;
+}
+
+
+MaybeLocal<Object> ReadBufferPool::Commit(const uv_buf_t* buf, size_t nread) {
+  CHECK_GT(nread, 0);
+  CHECK_LE(nread, buf->len);
+
+  if (pending_ == nullptr || buf->base != pending_->data_) {
+    char* base = node::Realloc(buf->base, nread);
+    return Buffer::New(env_, base, nread);
+  }
+
+  Chunk* chunk = pending_;
+  pending_ = nullptr;
+
+  Local<Object> obj;
+  if (!Buffer::New(env_, chunk->data_, nread, Chunk::Free, chunk)
+           .ToLocal(&obj)) {
+    free_list_.push_back(chunk);
+    return MaybeLocal<Object>();
+  }
+
+  // Let the garbage collector know about the whole chunk, so that idle
+  // Buffers are collected and their chunks recycled soon enough.
+  pinned_.PushBack(chunk);
+  bytes_pinned_ += kChunkSize;
+  env_->isolate()->AdjustAmountOfExternalAllocatedMemory(kChunkSize);
+  return obj;
+}
+
+
+void ReadBufferPool::Release(const uv_buf_t* buf) {
+  if (buf->base == nullptr)
+    return;
+  if (pending_ != nullptr && buf->base == pending_->data_) {
+    free_list_.push_back(pending_);
+    pending_ = nullptr;
+  } else {
+    free(buf->base);
+  }
+}
+
+
+void ReadBufferPool::Recycle(Chunk* chunk) {
+  bytes_pinned_ -= kChunkSize;
+  env_->isolate()->AdjustAmountOfExternalAllocatedMemory(
+      -static_cast<int64_t>(kChunkSize));
+  if (free_list_.size() < kMaxFreeChunks)
+    free_list_.push_back(chunk);
+  else
+    delete chunk;
+}
+
+}  // namespace node
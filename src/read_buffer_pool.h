@@ -0,0 +1,85 @@
+#ifndef SRC_READ_BUFFER_POOL_H_
+#define SRC_READ_BUFFER_POOL_H_
+
+#if defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#include "util.h"
+#include "uv.h"
+#include "v8.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace node {
+
+class Environment;
+
+// Serves stream reads from fixed-size chunks that are recycled, so that a
+// read does not cost a malloc() and a realloc() of its own.  The Buffer that
+// is emitted for a read is backed by its own chunk and covers only the bytes
+// that were read; no two Buffers ever share memory.  When JS land drops the
+// Buffer and its ArrayBuffer is collected, the chunk goes back on a free list
+// and serves the next read.
+//
+// libuv calls the alloc and read callbacks of a stream back to back, so at
+// most one chunk is outstanding at any time.  Reads that are served from the
+// free list count as hits, reads that need a new chunk count as misses.
+class ReadBufferPool {
+ public:
+  static const size_t kChunkSize = 64 * 1024;
+  static const size_t kMaxFreeChunks = 64;
+
+  explicit ReadBufferPool(Environment* env);
+  ~ReadBufferPool();
+
+  // Fills in |buf| with a chunk of at least |suggested_size| bytes.
+  void Allocate(size_t suggested_size, uv_buf_t* buf);
+
+  // Turns the first |nread| bytes of a chunk returned by Allocate() into a
+  // Buffer.  The chunk stays pinned until the Buffer is collected.
+  v8::MaybeLocal<v8::Object> Commit(const uv_buf_t* buf, size_t nread);
+
+  // Returns a chunk that did not receive any data.
+  void Release(const uv_buf_t* buf);
+
+  inline uint64_t hits() const { return hits_; }
+  inline uint64_t misses() const { return misses_; }
+  inline uint64_t bytes_pinned() const { return bytes_pinned_; }
+
+ private:
+  class Chunk {
+   public:
+    inline explicit Chunk(ReadBufferPool* pool);
+    inline ~Chunk();
+
+    // Called when the ArrayBuffer that the chunk backs is collected.
+    static void Free(char* data, void* hint);
+
+    ReadBufferPool* pool_;
+    char* const data_;
+    ListNode<Chunk> chunk_list_;
+
+   private:
+    DISALLOW_COPY_AND_ASSIGN(Chunk);
+  };
+
+  void Recycle(Chunk* chunk);
+
+  Environment* const env_;
+  Chunk* pending_;
+  std::vector<Chunk*> free_list_;
+  ListHead<Chunk, &Chunk::chunk_list_> pinned_;
+
+  uint64_t hits_;
+  uint64_t misses_;
+  uint64_t bytes_pinned_;
+
+  DISALLOW_COPY_AND_ASSIGN(ReadBufferPool);
+};
+
+}  // namespace node
+
+#endif  // defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#endif  // SRC_READ_BUFFER_POOL_H_
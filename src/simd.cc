@@ -0,0 +1,759 @@
+#include "simd.h"
+
+#include <string.h>
+
+#ifdef NODE_SIMD_X86
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
+namespace node {
+namespace simd {
+
+static Level DetectLevel() {
+#ifdef NODE_SIMD_X86
+  unsigned eax, ebx, ecx, edx;
+  if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || !(ecx & bit_SSSE3))
+    return kScalar;
+
+  // AVX2 also needs the OS to save the upper halves of the YMM registers.
+  if ((ecx & bit_OSXSAVE) && (ecx & bit_AVX) && __get_cpuid_max(0, 0) >= 7) {
+    uint32_t xcr0_lo, xcr0_hi;
+    __asm__("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    if ((xcr0_lo & 6) == 6 && (ebx & bit_AVX2))
+      return kAVX2;
+  }
+  return kSSSE3;
+#else
+  return kScalar;
+#endif
+}
+
+static const Level detected_level = DetectLevel();
+
+Level level() {
+  return detected_level;
+}
+
+
+static const uint64_t kHighBits = 0x8080808080808080ull;
+
+static size_t AsciiPrefixScalar(const char* data, size_t length) {
+  size_t i = 0;
+  for (; i + 8 <= length; i += 8) {
+    uint64_t word;
+    memcpy(&word, data + i, sizeof(word));
+    if (word & kHighBits)
+      break;
+  }
+  for (; i < length; i++) {
+    if (data[i] & 0x80)
+      break;
+  }
+  return i;
+}
+
+
+static void ForceAsciiScalar(const char* src, char* dst, size_t length) {
+  size_t i = 0;
+  for (; i + 8 <= length; i += 8) {
+    uint64_t word;
+    memcpy(&word, src + i, sizeof(word));
+    word &= ~kHighBits;
+    memcpy(dst + i, &word, sizeof(word));
+  }
+  for (; i < length; i++)
+    dst[i] = src[i] & 0x7f;
+}
+
+
+static bool IsValidUtf8Scalar(const uint8_t* data, size_t length) {
+  size_t i = 0;
+  while (i < length) {
+    const uint8_t c = data[i];
+    if (c < 0x80) {
+      i++;
+      continue;
+    }
+
+    // The allowed range of the second byte depends on the first byte, the
+    // other continuation bytes can be anything from 0x80 to 0xBF.
+    size_t continuations;
+    uint8_t min = 0x80;
+    uint8_t max = 0xBF;
+    if (c >= 0xC2 && c <= 0xDF) {
+      continuations = 1;
+    } else if (c >= 0xE0 && c <= 0xEF) {
+      continuations = 2;
+      if (c == 0xE0) min = 0xA0;  // Overlong.
+      if (c == 0xED) max = 0x9F;  // Surrogates.
+    } else if (c >= 0xF0 && c <= 0xF4) {
+      continuations = 3;
+      if (c == 0xF0) min = 0x90;  // Overlong.
+      if (c == 0xF4) max = 0x8F;  // Above U+10FFFF.
+    } else {
+      return false;
+    }
+
+    if (length - i - 1 < continuations)
+      return false;
+    if (data[i + 1] < min || data[i + 1] > max)
+      return false;
+    for (size_t j = 2; j <= continuations; j++) {
+      if ((data[i + j] & 0xC0) != 0x80)
+        return false;
+    }
+    i += continuations + 1;
+  }
+  return true;
+}
+
+
+#ifdef NODE_SIMD_X86
+
+// The vector loops stop at the first block with a non-ASCII byte and leave
+// it to the narrower loops to find the byte.
+NODE_SIMD_SSSE3
+static size_t AsciiPrefixSSSE3(const char* data, size_t length) {
+  size_t i = 0;
+  for (; i + 64 <= length; i += 64) {
+    const __m128i* p = reinterpret_cast<const __m128i*>(data + i);
+    const __m128i bits =
+        _mm_or_si128(_mm_or_si128(_mm_loadu_si128(p), _mm_loadu_si128(p + 1)),
+                     _mm_or_si128(_mm_loadu_si128(p + 2),
+                                  _mm_loadu_si128(p + 3)));
+    if (_mm_movemask_epi8(bits) != 0)
+      break;
+  }
+  for (; i + 16 <= length; i += 16) {
+    const __m128i bits =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    if (_mm_movemask_epi8(bits) != 0)
+      break;
+  }
+  return i + AsciiPrefixScalar(data + i, length - i);
+}
+
+
+NODE_SIMD_AVX2
+static size_t AsciiPrefixAVX2(const char* data, size_t length) {
+  size_t i = 0;
+  for (; i + 128 <= length; i += 128) {
+    const __m256i* p = reinterpret_cast<const __m256i*>(data + i);
+    const __m256i bits = _mm256_or_si256(
+        _mm256_or_si256(_mm256_loadu_si256(p), _mm256_loadu_si256(p + 1)),
+        _mm256_or_si256(_mm256_loadu_si256(p + 2), _mm256_loadu_si256(p + 3)));
+    if (_mm256_movemask_epi8(bits) != 0)
+      break;
+  }
+  return i + AsciiPrefixSSSE3(data + i, length - i);
+}
+
+
+NODE_SIMD_SSSE3
+static void ForceAsciiSSSE3(const char* src, char* dst, size_t length) {
+  const __m128i mask = _mm_set1_epi8(0x7f);
+  size_t i = 0;
+  for (; i + 16 <= length; i += 16) {
+    const __m128i in =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                     _mm_and_si128(in, mask));
+  }
+  ForceAsciiScalar(src + i, dst + i, length - i);
+}
+
+
+NODE_SIMD_AVX2
+static void ForceAsciiAVX2(const char* src, char* dst, size_t length) {
+  const __m256i mask = _mm256_set1_epi8(0x7f);
+  size_t i = 0;
+  for (; i + 32 <= length; i += 32) {
+    const __m256i in =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i),
+                        _mm256_and_si256(in, mask));
+  }
+  ForceAsciiSSSE3(src + i, dst + i, length - i);
+}
+
+
+// UTF-8 validation after John Keiser and Daniel Lemire, "Validating UTF-8
+// In Less Than One Instruction Per Byte". Most errors show up in the first
+// two bytes of a sequence, and three table lookups on the high and low
+// nibble of the previous byte and the high nibble of the current byte flag
+// them. What is left is checked by requiring the bytes two and three after
+// 3 and 4 byte leads to be continuation bytes.
+enum Utf8Error : uint8_t {
+  kTooShort = 1 << 0,      // A lead byte followed by too few continuations.
+  kTooLong = 1 << 1,       // A continuation without a lead byte.
+  kOverlong3 = 1 << 2,     // 11100000 100_____
+  kTooLarge = 1 << 3,      // Above U+10FFFF.
+  kSurrogate = 1 << 4,     // 11101101 101_____
+  kOverlong2 = 1 << 5,     // 1100000_ 10______
+  kTooLarge1000 = 1 << 6,  // 11110101 1000____ and up.
+  kOverlong4 = 1 << 6,     // 11110000 1000____
+  kTwoConts = 1 << 7,      // 10______ 10______
+};
+
+static const uint8_t kCarry = kTooShort | kTooLong | kTwoConts;
+
+static const uint8_t kByte1High[16] = {
+  // 0_______ ________, ASCII.
+  kTooLong, kTooLong, kTooLong, kTooLong,
+  kTooLong, kTooLong, kTooLong, kTooLong,
+  // 10______ ________, continuation.
+  kTwoConts, kTwoConts, kTwoConts, kTwoConts,
+  // 1100____ ________, two byte lead.
+  kTooShort | kOverlong2,
+  // 1101____ ________, two byte lead.
+  kTooShort,
+  // 1110____ ________, three byte lead.
+  kTooShort | kOverlong3 | kSurrogate,
+  // 1111____ ________, four byte lead.
+  kTooShort | kTooLarge | kTooLarge1000 | kOverlong4
+};
+
+static const uint8_t kByte1Low[16] = {
+  // ____0000 ________
+  kCarry | kOverlong3 | kOverlong2 | kOverlong4,
+  // ____0001 ________
+  kCarry | kOverlong2,
+  // ____001_ ________
+  kCarry,
+  kCarry,
+  // ____0100 ________
+  kCarry | kTooLarge,
+  // ____0101 ________
+  kCarry | kTooLarge | kTooLarge1000,
+  // ____011_ ________
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+  // ____1___ ________
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+  // ____1101 ________
+  kCarry | kTooLarge | kTooLarge1000 | kSurrogate,
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000
+};
+
+static const uint8_t kByte2High[16] = {
+  // ________ 0_______, ASCII.
+  kTooShort, kTooShort, kTooShort, kTooShort,
+  kTooShort, kTooShort, kTooShort, kTooShort,
+  // ________ 1000____
+  kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge1000 | kOverlong4,
+  // ________ 1001____
+  kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge,
+  // ________ 101_____
+  kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+  kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+  // ________ 11______, lead byte.
+  kTooShort, kTooShort, kTooShort, kTooShort
+};
+
+// The largest values that the last three bytes of a block may have without
+// starting a sequence that continues in the next block.
+static const uint8_t kIncompleteMax[32] = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xBF
+};
+
+
+class Utf8CheckerSSSE3 {
+ public:
+  static const size_t kBlockSize = 16;
+
+  NODE_SIMD_SSSE3 Utf8CheckerSSSE3()
+      : error_(_mm_setzero_si128()),
+        prev_input_(_mm_setzero_si128()),
+        prev_incomplete_(_mm_setzero_si128()),
+        byte_1_high_(Load(kByte1High)),
+        byte_1_low_(Load(kByte1Low)),
+        byte_2_high_(Load(kByte2High)),
+        incomplete_max_(Load(kIncompleteMax + 16)) {}
+
+  NODE_SIMD_SSSE3 void CheckBlock(const uint8_t* data) {
+    const __m128i input = Load(data);
+    if (_mm_movemask_epi8(input) == 0) {
+      // ASCII is fine unless the previous block ended in the middle of a
+      // sequence.
+      error_ = _mm_or_si128(error_, prev_incomplete_);
+      prev_incomplete_ = _mm_setzero_si128();
+    } else {
+      const __m128i prev1 = _mm_alignr_epi8(input, prev_input_, 15);
+      const __m128i prev2 = _mm_alignr_epi8(input, prev_input_, 14);
+      const __m128i prev3 = _mm_alignr_epi8(input, prev_input_, 13);
+      const __m128i special_cases = _mm_and_si128(
+          _mm_and_si128(_mm_shuffle_epi8(byte_1_high_, Shr4(prev1)),
+                        _mm_shuffle_epi8(byte_1_low_, LowNibble(prev1))),
+          _mm_shuffle_epi8(byte_2_high_, Shr4(input)));
+      // Only 111_____ and 1111____ end up with the high bit set.
+      const __m128i must_be_continuation = _mm_and_si128(
+          _mm_or_si128(_mm_subs_epu8(prev2, _mm_set1_epi8(0xE0 - 0x80)),
+                       _mm_subs_epu8(prev3, _mm_set1_epi8(0xF0 - 0x80))),
+          _mm_set1_epi8(static_cast<char>(0x80)));
+      error_ = _mm_or_si128(error_,
+                            _mm_xor_si128(must_be_continuation,
+                                          special_cases));
+      prev_incomplete_ = _mm_subs_epu8(input, incomplete_max_);
+    }
+    prev_input_ = input;
+  }
+
+  // Also fails when the input ended in the middle of a sequence.
+  NODE_SIMD_SSSE3 bool Finish() {
+    const __m128i error = _mm_or_si128(error_, prev_incomplete_);
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) ==
+           0xFFFF;
+  }
+
+ private:
+  NODE_SIMD_SSSE3 static __m128i Load(const uint8_t* data) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+  }
+
+  NODE_SIMD_SSSE3 static __m128i Shr4(__m128i v) {
+    return _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0f));
+  }
+
+  NODE_SIMD_SSSE3 static __m128i LowNibble(__m128i v) {
+    return _mm_and_si128(v, _mm_set1_epi8(0x0f));
+  }
+
+  __m128i error_;
+  __m128i prev_input_;
+  __m128i prev_incomplete_;
+  const __m128i byte_1_high_;
+  const __m128i byte_1_low_;
+  const __m128i byte_2_high_;
+  const __m128i incomplete_max_;
+};
+
+
+class Utf8CheckerAVX2 {
+ public:
+  static const size_t kBlockSize = 32;
+
+  NODE_SIMD_AVX2 Utf8CheckerAVX2()
+      : error_(_mm256_setzero_si256()),
+        prev_input_(_mm256_setzero_si256()),
+        prev_incomplete_(_mm256_setzero_si256()),
+        byte_1_high_(LoadTable(kByte1High)),
+        byte_1_low_(LoadTable(kByte1Low)),
+        byte_2_high_(LoadTable(kByte2High)),
+        incomplete_max_(Load(kIncompleteMax)) {}
+
+  NODE_SIMD_AVX2 void CheckBlock(const uint8_t* data) {
+    const __m256i input = Load(data);
+    if (_mm256_movemask_epi8(input) == 0) {
+      error_ = _mm256_or_si256(error_, prev_incomplete_);
+      prev_incomplete_ = _mm256_setzero_si256();
+    } else {
+      // The high half of the previous block and the low half of this one,
+      // so that alignr can shift across the lanes.
+      const __m256i shifted =
+          _mm256_permute2x128_si256(prev_input_, input, 0x21);
+      const __m256i prev1 = _mm256_alignr_epi8(input, shifted, 15);
+      const __m256i prev2 = _mm256_alignr_epi8(input, shifted, 14);
+      const __m256i prev3 = _mm256_alignr_epi8(input, shifted, 13);
+      const __m256i special_cases = _mm256_and_si256(
+          _mm256_and_si256(_mm256_shuffle_epi8(byte_1_high_, Shr4(prev1)),
+                           _mm256_shuffle_epi8(byte_1_low_, LowNibble(prev1))),
+          _mm256_shuffle_epi8(byte_2_high_, Shr4(input)));
+      const __m256i must_be_continuation = _mm256_and_si256(
+          _mm256_or_si256(
+              _mm256_subs_epu8(prev2, _mm256_set1_epi8(0xE0 - 0x80)),
+              _mm256_subs_epu8(prev3, _mm256_set1_epi8(0xF0 - 0x80))),
+          _mm256_set1_epi8(static_cast<char>(0x80)));
+      error_ = _mm256_or_si256(error_,
+                               _mm256_xor_si256(must_be_continuation,
+                                                special_cases));
+      prev_incomplete_ = _mm256_subs_epu8(input, incomplete_max_);
+    }
+    prev_input_ = input;
+  }
+
+  NODE_SIMD_AVX2 bool Finish() {
+    const __m256i error = _mm256_or_si256(error_, prev_incomplete_);
+    return _mm256_testz_si256(error, error);
+  }
+
+ private:
+  NODE_SIMD_AVX2 static __m256i Load(const uint8_t* data) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+  }
+
+  NODE_SIMD_AVX2 static __m256i LoadTable(const uint8_t* table) {
+    return _mm256_broadcastsi128_si256(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(table)));
+  }
+
+  NODE_SIMD_AVX2 static __m256i Shr4(__m256i v) {
+    return _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0f));
+  }
+
+  NODE_SIMD_AVX2 static __m256i LowNibble(__m256i v) {
+    return _mm256_and_si256(v, _mm256_set1_epi8(0x0f));
+  }
+
+  __m256i error_;
+  __m256i prev_input_;
+  __m256i prev_incomplete_;
+  const __m256i byte_1_high_;
+  const __m256i byte_1_low_;
+  const __m256i byte_2_high_;
+  const __m256i incomplete_max_;
+};
+
+
+// The last partial block is padded with spaces, which are valid on their
+// own and still reveal a sequence that is cut short by the end of input.
+template <typename Checker>
+static inline bool IsValidUtf8Vector(const uint8_t* data, size_t length) {
+  Checker checker;
+  size_t i = 0;
+  for (; i + Checker::kBlockSize <= length; i += Checker::kBlockSize)
+    checker.CheckBlock(data + i);
+  if (i < length) {
+    uint8_t block[Checker::kBlockSize];
+    memset(block, ' ', sizeof(block));
+    memcpy(block, data + i, length - i);
+    checker.CheckBlock(block);
+  }
+  return checker.Finish();
+}
+
+
+NODE_SIMD_SSSE3
+static bool IsValidUtf8SSSE3(const uint8_t* data, size_t length) {
+  return IsValidUtf8Vector<Utf8CheckerSSSE3>(data, length);
+}
+
+
+NODE_SIMD_AVX2
+static bool IsValidUtf8AVX2(const uint8_t* data, size_t length) {
+  return IsValidUtf8Vector<Utf8CheckerAVX2>(data, length);
+}
+
+
+// Hex encoding looks the nibbles up with a byte shuffle and interleaves
+// them, decoding maps the digits to nibbles with range checks and combines
+// pairs of them with a multiply-add.
+
+NODE_SIMD_SSSE3
+static size_t HexEncodeSSSE3(const uint8_t* src, size_t slen, char* dst) {
+  const __m128i digits = _mm_loadu_si128(
+      reinterpret_cast<const __m128i*>("0123456789abcdef"));
+  const __m128i mask = _mm_set1_epi8(0x0f);
+  size_t i = 0;
+  for (; i + 16 <= slen; i += 16) {
+    const __m128i in =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    const __m128i hi =
+        _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(in, 4), mask));
+    const __m128i lo = _mm_shuffle_epi8(digits, _mm_and_si128(in, mask));
+    __m128i* out = reinterpret_cast<__m128i*>(dst + i * 2);
+    _mm_storeu_si128(out, _mm_unpacklo_epi8(hi, lo));
+    _mm_storeu_si128(out + 1, _mm_unpackhi_epi8(hi, lo));
+  }
+  return i;
+}
+
+
+NODE_SIMD_AVX2
+static size_t HexEncodeAVX2(const uint8_t* src, size_t slen, char* dst) {
+  const __m256i digits = _mm256_broadcastsi128_si256(_mm_loadu_si128(
+      reinterpret_cast<const __m128i*>("0123456789abcdef")));
+  const __m256i mask = _mm256_set1_epi8(0x0f);
+  size_t i = 0;
+  for (; i + 32 <= slen; i += 32) {
+    const __m256i in =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+    const __m256i hi = _mm256_shuffle_epi8(
+        digits, _mm256_and_si256(_mm256_srli_epi16(in, 4), mask));
+    const __m256i lo = _mm256_shuffle_epi8(digits, _mm256_and_si256(in, mask));
+    // The unpacks work per 128 bit lane, put the halves back in order.
+    const __m256i a = _mm256_unpacklo_epi8(hi, lo);
+    const __m256i b = _mm256_unpackhi_epi8(hi, lo);
+    __m256i* out = reinterpret_cast<__m256i*>(dst + i * 2);
+    _mm256_storeu_si256(out, _mm256_permute2x128_si256(a, b, 0x20));
+    _mm256_storeu_si256(out + 1, _mm256_permute2x128_si256(a, b, 0x31));
+  }
+  return i + HexEncodeSSSE3(src + i, slen - i, dst + i * 2);
+}
+
+
+NODE_SIMD_SSSE3
+static inline __m128i LoadChars(const uint8_t* src) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+}
+
+
+// Characters above 0xFF saturate to 0xFF, which is not a digit. The scalar
+// code takes it from there.
+NODE_SIMD_SSSE3
+static inline __m128i LoadChars(const uint16_t* src) {
+  const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+  const __m128i hi =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 8));
+  return _mm_packus_epi16(lo, hi);
+}
+
+
+NODE_SIMD_AVX2
+static inline __m256i LoadCharsAVX2(const uint8_t* src) {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+}
+
+
+NODE_SIMD_AVX2
+static inline __m256i LoadCharsAVX2(const uint16_t* src) {
+  const __m256i lo =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+  const __m256i hi =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 16));
+  return _mm256_permute4x64_epi64(_mm256_packus_epi16(lo, hi), 0xD8);
+}
+
+
+// Replaces the characters in |chars| with their values, returns false if
+// any of them is not a hex digit.
+NODE_SIMD_SSSE3
+static inline bool HexTranslate(__m128i* chars) {
+  const __m128i digit = _mm_sub_epi8(*chars, _mm_set1_epi8('0'));
+  const __m128i is_digit =
+      _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+  const __m128i letter = _mm_sub_epi8(_mm_or_si128(*chars, _mm_set1_epi8(0x20)),
+                                      _mm_set1_epi8('a'));
+  const __m128i is_letter =
+      _mm_cmpeq_epi8(_mm_min_epu8(letter, _mm_set1_epi8(5)), letter);
+  if (_mm_movemask_epi8(_mm_or_si128(is_digit, is_letter)) != 0xFFFF)
+    return false;
+  *chars = _mm_or_si128(
+      _mm_and_si128(is_digit, digit),
+      _mm_and_si128(is_letter, _mm_add_epi8(letter, _mm_set1_epi8(10))));
+  return true;
+}
+
+
+NODE_SIMD_AVX2
+static inline bool HexTranslate(__m256i* chars) {
+  const __m256i digit = _mm256_sub_epi8(*chars, _mm256_set1_epi8('0'));
+  const __m256i is_digit =
+      _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+  const __m256i letter =
+      _mm256_sub_epi8(_mm256_or_si256(*chars, _mm256_set1_epi8(0x20)),
+                      _mm256_set1_epi8('a'));
+  const __m256i is_letter =
+      _mm256_cmpeq_epi8(_mm256_min_epu8(letter, _mm256_set1_epi8(5)), letter);
+  if (_mm256_movemask_epi8(_mm256_or_si256(is_digit, is_letter)) != -1)
+    return false;
+  *chars = _mm256_or_si256(
+      _mm256_and_si256(is_digit, digit),
+      _mm256_and_si256(is_letter,
+                       _mm256_add_epi8(letter, _mm256_set1_epi8(10))));
+  return true;
+}
+
+
+// Decodes 32 characters at a time and stops before the first block with
+// anything but hex digits in it.
+template <typename TypeName>
+NODE_SIMD_SSSE3
+static size_t HexDecodeSSSE3(char* dst, size_t dstlen,
+                             const TypeName* src, size_t srclen) {
+  // Every pair of nibbles becomes high * 16 + low.
+  const __m128i weights = _mm_set1_epi16(0x0110);
+  size_t k = 0;
+  for (; k + 16 <= dstlen && k * 2 + 32 <= srclen; k += 16) {
+    __m128i a = LoadChars(src + k * 2);
+    __m128i b = LoadChars(src + k * 2 + 16);
+    if (!HexTranslate(&a) || !HexTranslate(&b))
+      break;
+    const __m128i out = _mm_packus_epi16(_mm_maddubs_epi16(a, weights),
+                                         _mm_maddubs_epi16(b, weights));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + k), out);
+  }
+  return k;
+}
+
+
+template <typename TypeName>
+NODE_SIMD_AVX2
+static size_t HexDecodeAVX2(char* dst, size_t dstlen,
+                            const TypeName* src, size_t srclen) {
+  const __m256i weights = _mm256_set1_epi16(0x0110);
+  size_t k = 0;
+  for (; k + 32 <= dstlen && k * 2 + 64 <= srclen; k += 32) {
+    __m256i a = LoadCharsAVX2(src + k * 2);
+    __m256i b = LoadCharsAVX2(src + k * 2 + 32);
+    if (!HexTranslate(&a) || !HexTranslate(&b))
+      break;
+    const __m256i out =
+        _mm256_packus_epi16(_mm256_maddubs_epi16(a, weights),
+                            _mm256_maddubs_epi16(b, weights));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + k),
+                        _mm256_permute4x64_epi64(out, 0xD8));
+  }
+  // Whatever is left can still fill some of the smaller blocks, unless
+  // decoding stopped at an invalid character.
+  return k + HexDecodeSSSE3(dst + k, dstlen - k, src + k * 2, srclen - k * 2);
+}
+
+
+template <typename TypeName>
+static size_t HexDecodeDispatch(char* dst, size_t dstlen,
+                                const TypeName* src, size_t srclen) {
+  switch (level()) {
+    case kAVX2:
+      return HexDecodeAVX2(dst, dstlen, src, srclen);
+    case kSSSE3:
+      return HexDecodeSSSE3(dst, dstlen, src, srclen);
+    default:
+      return 0;
+  }
+}
+
+#endif  // NODE_SIMD_X86
+
+
+bool IsAscii(const char* data, size_t length) {
+  return AsciiPrefixLength(data, length) == length;
+}
+
+
+size_t AsciiPrefixLength(const char* data, size_t length) {
+#ifdef NODE_SIMD_X86
+  switch (level()) {
+    case kAVX2:
+      return AsciiPrefixAVX2(data, length);
+    case kSSSE3:
+      return AsciiPrefixSSSE3(data, length);
+    default:
+      break;
+  }
+#endif
+  return AsciiPrefixScalar(data, length);
+}
+
+
+void ForceAscii(const char* src, char* dst, size_t length) {
+#ifdef NODE_SIMD_X86
+  switch (level()) {
+    case kAVX2:
+      return ForceAsciiAVX2(src, dst, length);
+    case kSSSE3:
+      return ForceAsciiSSSE3(src, dst, length);
+    default:
+      break;
+  }
+#endif
+  ForceAsciiScalar(src, dst, length);
+}
+
+
+bool IsValidUtf8(const char* data, size_t length) {
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+  // Short inputs are not worth setting up the tables for.
+  if (length < 16)
+    return IsValidUtf8Scalar(bytes, length);
+#ifdef NODE_SIMD_X86
+  switch (level()) {
+    case kAVX2:
+      return IsValidUtf8AVX2(bytes, length);
+    case kSSSE3:
+      return IsValidUtf8SSSE3(bytes, length);
+    default:
+      break;
+  }
+#endif
+  return IsValidUtf8Scalar(bytes, length);
+}
+
+
+bool Utf8ToLatin1(const char* src, size_t length, char* dst, size_t* written) {
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(src);
+  size_t i = 0;
+  size_t k = 0;
+  while (i < length) {
+    if (i + 8 <= length) {
+      uint64_t word;
+      memcpy(&word, bytes + i, sizeof(word));
+      if (!(word & kHighBits)) {
+        memcpy(dst + k, &word, sizeof(word));
+        i += 8;
+        k += 8;
+        continue;
+      }
+    }
+    const uint8_t c = bytes[i];
+    if (c < 0x80) {
+      dst[k++] = c;
+      i += 1;
+    } else if ((c == 0xC2 || c == 0xC3) && i + 1 < length &&
+               (bytes[i + 1] & 0xC0) == 0x80) {
+      // U+0080 to U+00FF, never overlong.
+      dst[k++] = ((c & 0x03) << 6) | (bytes[i + 1] & 0x3F);
+      i += 2;
+    } else {
+      return false;
+    }
+  }
+  *written = k;
+  return true;
+}
+
+
+size_t HexEncode(const char* src, size_t slen, char* dst) {
+  static const char hex[] = "0123456789abcdef";
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(src);
+  size_t i = 0;
+#ifdef NODE_SIMD_X86
+  switch (level()) {
+    case kAVX2:
+      i = HexEncodeAVX2(bytes, slen, dst);
+      break;
+    case kSSSE3:
+      i = HexEncodeSSSE3(bytes, slen, dst);
+      break;
+    default:
+      break;
+  }
+#endif
+  for (; i < slen; i++) {
+    dst[i * 2 + 0] = hex[bytes[i] >> 4];
+    dst[i * 2 + 1] = hex[bytes[i] & 15];
+  }
+  return slen * 2;
+}
+
+
+size_t HexDecodeVector(char* dst, size_t dstlen,
+                       const uint8_t* src, size_t srclen) {
+#ifdef NODE_SIMD_X86
+  return HexDecodeDispatch(dst, dstlen, src, srclen);
+#else
+  return 0;
+#endif
+}
+
+
+size_t HexDecodeVector(char* dst, size_t dstlen,
+                       const uint16_t* src, size_t srclen) {
+#ifdef NODE_SIMD_X86
+  return HexDecodeDispatch(dst, dstlen, src, srclen);
+#else
+  return 0;
+#endif
+}
+
+}  // namespace simd
+}  // namespace node
@@ -0,0 +1,76 @@
+#ifndef SRC_SIMD_H_
+#define SRC_SIMD_H_
+
+#if defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Vectorized kernels are compiled with function attributes for the
+// instruction sets they use, node as a whole does not assume any of them.
+// Which kernel runs is decided at runtime by simd::level().
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define NODE_SIMD_X86 1
+#define NODE_SIMD_SSSE3 __attribute__((target("ssse3")))
+#define NODE_SIMD_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace node {
+namespace simd {
+
+enum Level {
+  kScalar,
+  kSSSE3,
+  kAVX2
+};
+
+// The widest instruction set that both the CPU and the OS support, always
+// kScalar when the vectorized kernels are not compiled in.
+Level level();
+
+// Whether all bytes of |data| are below 0x80.
+bool IsAscii(const char* data, size_t length);
+
+// The number of leading bytes of |data| that are below 0x80, |length| when
+// they all are.
+size_t AsciiPrefixLength(const char* data, size_t length);
+
+// Copies |src| to |dst| with the high bit of every byte cleared.
+void ForceAscii(const char* src, char* dst, size_t length);
+
+// Whether |data| is well-formed UTF-8, i.e. without overlong encodings,
+// surrogates, code points above U+10FFFF or truncated sequences.
+bool IsValidUtf8(const char* data, size_t length);
+
+// Decodes |src| into |dst| when it is well-formed UTF-8 with no code point
+// above U+00FF, i.e. when it fits into a one-byte string. |dst| must have
+// room for |length| bytes. Returns false, with |dst| in an unspecified
+// state, for any other input.
+bool Utf8ToLatin1(const char* src, size_t length, char* dst, size_t* written);
+
+// Writes the lowercase hex digits for |src| to |dst|, which must have room
+// for |slen| * 2 bytes. Returns the number of bytes written.
+size_t HexEncode(const char* src, size_t slen, char* dst);
+
+// Decodes a prefix of the hex digits in |src| into |dst| and returns the
+// number of bytes written, i.e. half the number of characters consumed.
+// Stops early at characters that are not hex digits and leaves the rest,
+// including any partial block, to the caller. Returns 0 when no
+// vectorized kernel is available.
+size_t HexDecodeVector(char* dst, size_t dstlen,
+                       const uint8_t* src, size_t srclen);
+size_t HexDecodeVector(char* dst, size_t dstlen,
+                       const uint16_t* src, size_t srclen);
+
+inline size_t HexDecodeVector(char* dst, size_t dstlen,
+                              const char* src, size_t srclen) {
+  return HexDecodeVector(dst, dstlen,
+                         reinterpret_cast<const uint8_t*>(src), srclen);
+}
+
+}  // namespace simd
+}  // namespace node
+
+#endif  // defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#endif  // SRC_SIMD_H_
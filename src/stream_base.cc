@@ -196,27 +196,44 @@ int StreamBase::WriteBuffer(const FunctionCallbackInfo<Value>& args) {
   const char* data = Buffer::Data(args[1]);
   size_t length = Buffer::Length(args[1]);
 
+  // Only IPC pipes can send handles, see WriteString() below.
+  uv_stream_t* send_handle = nullptr;
+  if (args[2]->IsObject()) {
+    HandleWrap* wrap;
+    ASSIGN_OR_RETURN_UNWRAP(&wrap, args[2].As<Object>(), UV_EINVAL);
+    send_handle = reinterpret_cast<uv_stream_t*>(wrap->GetHandle());
+  }
+
   WriteWrap* req_wrap;
   uv_buf_t buf;
   buf.base = const_cast<char*>(data);
   buf.len = length;
 
-  // Try writing immediately without allocation
+  // Try writing immediately without allocation, unless there is a handle to
+  // send along with the data.
   uv_buf_t* bufs = &buf;
   size_t count = 1;
-  int err = DoTryWrite(&bufs, &count);
-  if (err != 0)
-    goto done;
-  if (count == 0)
-    goto done;
+  int err = 0;
+  if (send_handle == nullptr) {
+    err = DoTryWrite(&bufs, &count);
+    if (err != 0)
+      goto done;
+    if (count == 0)
+      goto done;
+  }
   CHECK_EQ(count, 1);
 
   // Allocate, or write rest
   req_wrap = WriteWrap::New(env, req_wrap_obj, this, AfterWrite);
 
-  err = DoWrite(req_wrap, bufs, count, nullptr);
+  err = DoWrite(req_wrap, bufs, count, send_handle);
   req_wrap_obj->Set(env->async(), True(env->isolate()));
   req_wrap_obj->Set(env->buffer_string(), args[1]);
+  if (send_handle != nullptr) {
+    // Reference the handle's wrap to prevent it from being garbage
+    // collected before `AfterWrite` is called.
+    req_wrap_obj->Set(env->handle_string(), args[2]);
+  }
 
   if (err)
     req_wrap->Dispose();
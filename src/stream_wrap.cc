@@ -19,6 +19,11 @@
 #include <string.h>  // memcpy()
 #include <limits.h>  // INT_MAX
 
+#if !defined(_WIN32)
+# include <fcntl.h>  // fcntl(), F_DUPFD_CLOEXEC
+# include <unistd.h>  // close()
+#endif
+
 
 namespace node {
 
@@ -29,10 +34,200 @@ using v8::FunctionTemplate;
 using v8::HandleScope;
 using v8::Integer;
 using v8::Local;
+using v8::Number;
 using v8::Object;
 using v8::Value;
 
 
+// Transfers a range of a file to a stream with sendfile(2) on the thread pool,
+// the data never passes through userland. The stream's fd is non-blocking, so
+// a pass only sends what fits into the socket buffer; the rest is sent in
+// further passes once the fd is writable again.
+//
+// The request works on a duplicate of the stream's fd so that closing the
+// stream while a pass is in flight can't make it write into a reused fd.
+class SendFileWrap : public ReqWrap<uv_fs_t> {
+ public:
+  SendFileWrap(Environment* env,
+               Local<Object> req_wrap_obj,
+               uv_file in_fd,
+               int64_t offset,
+               size_t length)
+      : ReqWrap(env, req_wrap_obj, AsyncWrap::PROVIDER_SENDFILEWRAP),
+        in_fd_(in_fd),
+        out_fd_(-1),
+        offset_(offset),
+        remaining_(length),
+        bytes_(0),
+        status_(0),
+        polling_(false),
+        pass_pending_(false),
+        cancelled_(false) {
+    Wrap(req_wrap_obj, this);
+    Dispatched();
+  }
+
+  static void NewSendFileWrap(const FunctionCallbackInfo<Value>& args) {
+    CHECK(args.IsConstructCall());
+  }
+
+  static void Cancel(const FunctionCallbackInfo<Value>& args);
+
+  int Start(int fd);
+
+  size_t self_size() const override { return sizeof(*this); }
+
+ private:
+  int Pass();
+  void Done(int status);
+
+  static void AfterPass(uv_fs_t* req);
+  static void OnWritable(uv_poll_t* handle, int status, int events);
+  static void OnPollClose(uv_handle_t* handle);
+
+  uv_poll_t poll_;
+  const uv_file in_fd_;
+  int out_fd_;
+  int64_t offset_;
+  size_t remaining_;
+  size_t bytes_;
+  int status_;
+  bool polling_;
+  bool pass_pending_;
+  bool cancelled_;
+};
+
+
+int SendFileWrap::Start(int fd) {
+#if defined(_WIN32)
+  return UV_ENOTSUP;
+#else
+  int out_fd = fcntl(fd, F_DUPFD_CLOEXEC, 0);
+  if (out_fd == -1)
+    return -errno;
+
+  int err = uv_poll_init(env()->event_loop(), &poll_, out_fd);
+  if (err) {
+    close(out_fd);
+    return err;
+  }
+  poll_.data = this;
+  out_fd_ = out_fd;
+
+  // From here on errors are reported through the oncomplete callback.
+  err = Pass();
+  if (err)
+    Done(err);
+  return 0;
+#endif
+}
+
+
+int SendFileWrap::Pass() {
+  int err = uv_fs_sendfile(env()->event_loop(),
+                           req(),
+                           out_fd_,
+                           in_fd_,
+                           offset_,
+                           remaining_,
+                           AfterPass);
+  if (err == 0)
+    pass_pending_ = true;
+  return err;
+}
+
+
+void SendFileWrap::AfterPass(uv_fs_t* req) {
+  SendFileWrap* req_wrap = static_cast<SendFileWrap*>(req->data);
+  CHECK_EQ(req_wrap->req(), req);
+  ssize_t result = req->result;
+  uv_fs_req_cleanup(req);
+  req_wrap->pass_pending_ = false;
+
+  if (req_wrap->cancelled_)
+    return req_wrap->Done(UV_ECANCELED);
+
+  if (result > 0) {
+    req_wrap->offset_ += result;
+    req_wrap->remaining_ -= result;
+    req_wrap->bytes_ += result;
+  } else if (result == 0) {
+    // End of file, the range was longer than the file.
+    return req_wrap->Done(0);
+  } else if (result != UV_EAGAIN) {
+    return req_wrap->Done(result);
+  }
+
+  if (req_wrap->remaining_ == 0)
+    return req_wrap->Done(0);
+
+  // The socket buffer is full, continue when it has drained.
+  int err = uv_poll_start(&req_wrap->poll_, UV_WRITABLE, OnWritable);
+  if (err)
+    return req_wrap->Done(err);
+  req_wrap->polling_ = true;
+}
+
+
+void SendFileWrap::OnWritable(uv_poll_t* handle, int status, int events) {
+  SendFileWrap* req_wrap = static_cast<SendFileWrap*>(handle->data);
+  uv_poll_stop(handle);
+  req_wrap->polling_ = false;
+
+  int err = status;
+  if (err == 0)
+    err = req_wrap->Pass();
+  if (err)
+    req_wrap->Done(err);
+}
+
+
+void SendFileWrap::Cancel(const FunctionCallbackInfo<Value>& args) {
+  SendFileWrap* req_wrap;
+  ASSIGN_OR_RETURN_UNWRAP(&req_wrap, args.Holder());
+
+  if (req_wrap->cancelled_ || req_wrap->out_fd_ == -1)
+    return;
+  req_wrap->cancelled_ = true;
+
+  // A pass on the thread pool can't be interrupted, AfterPass() finishes
+  // the request when it returns.
+  if (req_wrap->polling_) {
+    uv_poll_stop(&req_wrap->poll_);
+    req_wrap->polling_ = false;
+    req_wrap->Done(UV_ECANCELED);
+  }
+}
+
+
+void SendFileWrap::Done(int status) {
+  CHECK_EQ(pass_pending_, false);
+  status_ = status;
+  uv_close(reinterpret_cast<uv_handle_t*>(&poll_), OnPollClose);
+}
+
+
+void SendFileWrap::OnPollClose(uv_handle_t* handle) {
+  SendFileWrap* req_wrap = static_cast<SendFileWrap*>(handle->data);
+  Environment* env = req_wrap->env();
+  HandleScope handle_scope(env->isolate());
+  Context::Scope context_scope(env->context());
+
+#if !defined(_WIN32)
+  close(req_wrap->out_fd_);
+#endif
+  req_wrap->out_fd_ = -1;
+
+  Local<Value> argv[] = {
+    Integer::New(env->isolate(), req_wrap->status_),
+    Number::New(env->isolate(), static_cast<double>(req_wrap->bytes_))
+  };
+  req_wrap->MakeCallback(env->oncomplete_string(), arraysize(argv), argv);
+
+  delete req_wrap;
+}
+
+
 void StreamWrap::Initialize(Local<Object> target,
                             Local<Value> unused,
                             Local<Context> context) {
@@ -52,6 +247,32 @@ void StreamWrap::Initialize(Local<Object> target,
   target->Set(FIXED_ONE_BYTE_STRING(env->isolate(), "WriteWrap"),
               ww->GetFunction());
   env->set_write_wrap_constructor_function(ww->GetFunction());
+
+  Local<FunctionTemplate> sfw =
+      FunctionTemplate::New(env->isolate(), SendFileWrap::NewSendFileWrap);
+  sfw->InstanceTemplate()->SetInternalFieldCount(1);
+  sfw->SetClassName(FIXED_ONE_BYTE_STRING(env->isolate(), "SendFileWrap"));
+  env->SetProtoMethod(sfw, "cancel", SendFileWrap::Cancel);
+  target->Set(FIXED_ONE_BYTE_STRING(env->isolate(), "SendFileWrap"),
+              sfw->GetFunction());
+
+  env->SetMethod(target, "getReadBufferPoolStats", GetReadBufferPoolStats);
+}
+
+
+void StreamWrap::GetReadBufferPoolStats(
+    const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  ReadBufferPool* pool = env->read_buffer_pool();
+
+  Local<Object> stats = Object::New(env->isolate());
+  stats->Set(FIXED_ONE_BYTE_STRING(env->isolate(), "hits"),
+             Number::New(env->isolate(), pool->hits()));
+  stats->Set(FIXED_ONE_BYTE_STRING(env->isolate(), "misses"),
+             Number::New(env->isolate(), pool->misses()));
+  stats->Set(FIXED_ONE_BYTE_STRING(env->isolate(), "bytesPinned"),
+             Number::New(env->isolate(), pool->bytes_pinned()));
+  args.GetReturnValue().Set(stats);
 }
 
 
@@ -77,6 +298,7 @@ void StreamWrap::AddMethods(Environment* env,
                             v8::Local<v8::FunctionTemplate> target,
                             int flags) {
   env->SetProtoMethod(target, "setBlocking", SetBlocking);
+  env->SetProtoMethod(target, "sendFile", SendFile);
   StreamBase::AddMethods<StreamWrap>(env, target, flags);
 }
 
@@ -148,8 +370,8 @@ void StreamWrap::OnAlloc(uv_handle_t* handle,
 
 
 void StreamWrap::OnAllocImpl(size_t size, uv_buf_t* buf, void* ctx) {
-  buf->base = node::Malloc(size);
-  buf->len = size;
+  StreamWrap* wrap = static_cast<StreamWrap*>(ctx);
+  wrap->env()->read_buffer_pool()->Allocate(size, buf);
 }
 
 
@@ -186,20 +408,18 @@ void StreamWrap::OnReadImpl(ssize_t nread,
   Local<Object> pending_obj;
 
   if (nread < 0)  {
-    if (buf->base != nullptr)
-      free(buf->base);
+    env->read_buffer_pool()->Release(buf);
     wrap->EmitData(nread, Local<Object>(), pending_obj);
     return;
   }
 
   if (nread == 0) {
-    if (buf->base != nullptr)
-      free(buf->base);
+    env->read_buffer_pool()->Release(buf);
     return;
   }
 
-  CHECK_LE(static_cast<size_t>(nread), buf->len);
-  char* base = node::Realloc(buf->base, nread);
+  Local<Object> obj =
+      env->read_buffer_pool()->Commit(buf, nread).ToLocalChecked();
 
   if (pending == UV_TCP) {
     pending_obj = AcceptHandle<TCPWrap, uv_tcp_t>(env, wrap);
@@ -211,7 +431,6 @@ void StreamWrap::OnReadImpl(ssize_t nread,
     CHECK_EQ(pending, UV_UNKNOWN_HANDLE);
   }
 
-  Local<Object> obj = Buffer::New(env, base, nread).ToLocalChecked();
   wrap->EmitData(nread, obj, pending_obj);
 }
 
@@ -268,6 +487,39 @@ void StreamWrap::SetBlocking(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+// sendFile(req, fd, offset, length)
+void StreamWrap::SendFile(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  StreamWrap* wrap;
+  ASSIGN_OR_RETURN_UNWRAP(&wrap,
+                          args.Holder(),
+                          args.GetReturnValue().Set(UV_EBADF));
+
+  CHECK(args[0]->IsObject());
+  CHECK(args[1]->IsInt32());
+  CHECK(args[2]->IsNumber());
+  CHECK(args[3]->IsNumber());
+
+  if (!wrap->IsAlive())
+    return args.GetReturnValue().Set(UV_EBADF);
+
+  const int fd = wrap->GetFD();
+  if (fd == -1)
+    return args.GetReturnValue().Set(UV_ENOTSUP);
+
+  SendFileWrap* req_wrap = new SendFileWrap(env,
+                                            args[0].As<Object>(),
+                                            args[1]->Int32Value(),
+                                            args[2]->IntegerValue(),
+                                            args[3]->IntegerValue());
+  int err = req_wrap->Start(fd);
+  if (err)
+    delete req_wrap;
+
+  args.GetReturnValue().Set(err);
+}
+
+
 int StreamWrap::DoShutdown(ShutdownWrap* req_wrap) {
   int err;
   err = uv_shutdown(req_wrap->req(), stream(), AfterShutdown);
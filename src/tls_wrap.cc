@@ -280,6 +280,10 @@ void TLSWrap::EncOut() {
 
   // No data to write
   if (BIO_pending(enc_out_) == 0) {
+    // Nothing is waiting to be encrypted or written either, give the
+    // buffers back until the connection has something to send again.
+    NodeBIO::FromBIO(enc_out_)->Trim();
+    clear_in_->Trim();
     if (clear_in_->Length() == 0)
       InvokeQueued(0);
     return;
@@ -471,13 +475,22 @@ bool TLSWrap::ClearIn() {
 
   int written = 0;
   while (clear_in_->Length() > 0) {
-    size_t avail = 0;
-    char* data = clear_in_->Peek(&avail);
-    written = SSL_write(ssl_, data, avail);
-    CHECK(written == -1 || written == static_cast<int>(avail));
-    if (written == -1)
+    char* data[kSimultaneousBufferCount];
+    size_t size[arraysize(data)];
+    size_t count = arraysize(data);
+    clear_in_->PeekMultiple(data, size, &count);
+
+    uv_buf_t bufs[arraysize(data)];
+    for (size_t i = 0; i < count; i++)
+      bufs[i] = uv_buf_init(data[i], size[i]);
+    const size_t n = WriteRecords(bufs, count, &written);
+
+    size_t bytes = 0;
+    for (size_t i = 0; i < n; i++)
+      bytes += size[i];
+    clear_in_->Read(nullptr, bytes);
+    if (n != count)
       break;
-    clear_in_->Read(nullptr, avail);
   }
 
   // All written
@@ -501,6 +514,45 @@ bool TLSWrap::ClearIn() {
 }
 
 
+size_t TLSWrap::WriteRecords(const uv_buf_t* bufs,
+                             size_t count,
+                             int* written) {
+  char record[kClearOutChunkSize];
+  size_t i = 0;
+
+  *written = 0;
+  while (i < count) {
+    // Gather as many buffers as fit into one record.
+    size_t end = i;
+    size_t length = 0;
+    while (end < count && length + bufs[end].len <= sizeof(record))
+      length += bufs[end++].len;
+
+    const char* data = record;
+    if (end <= i + 1) {
+      // Nothing to gather, OpenSSL splits larger buffers by itself.
+      data = bufs[i].base;
+      length = bufs[i].len;
+      end = i + 1;
+    } else {
+      size_t offset = 0;
+      for (size_t k = i; k < end; k++) {
+        memcpy(record + offset, bufs[k].base, bufs[k].len);
+        offset += bufs[k].len;
+      }
+    }
+
+    *written = SSL_write(ssl_, data, length);
+    CHECK(*written == -1 || *written == static_cast<int>(length));
+    if (*written == -1)
+      break;
+    i = end;
+  }
+
+  return i;
+}
+
+
 void* TLSWrap::Cast() {
   return reinterpret_cast<void*>(this);
 }
@@ -607,12 +659,7 @@ int TLSWrap::DoWrite(WriteWrap* w,
   crypto::MarkPopErrorOnReturn mark_pop_error_on_return;
 
   int written = 0;
-  for (i = 0; i < count; i++) {
-    written = SSL_write(ssl_, bufs[i].base, bufs[i].len);
-    CHECK(written == -1 || written == static_cast<int>(bufs[i].len));
-    if (written == -1)
-      break;
-  }
+  i = WriteRecords(bufs, count, &written);
 
   if (i != count) {
     int err;
@@ -716,6 +763,10 @@ void TLSWrap::DoRead(ssize_t nread,
 
   // Cycle OpenSSL's state
   Cycle();
+
+  // Everything that was read has been decrypted.
+  if (ssl_ != nullptr)
+    NodeBIO::FromBIO(enc_in_)->Trim();
 }
 
 
@@ -89,6 +89,10 @@ class TLSWrap : public AsyncWrap,
   void EncOut();
   static void EncOutCb(WriteWrap* req_wrap, int status);
   bool ClearIn();
+  // Passes |bufs| to SSL_write(), gathering small buffers into full-size
+  // records. Returns the number of buffers that were written, |written| is
+  // the result of the last SSL_write().
+  size_t WriteRecords(const uv_buf_t* bufs, size_t count, int* written);
   void ClearOut();
   void MakePending();
   bool InvokeQueued(int status, const char* error_str = nullptr);
@@ -9,6 +9,7 @@
 #include "util-inl.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 
 namespace node {
@@ -55,21 +56,89 @@ inline bool SendWrap::have_callback() const {
 }
 
 
+// Send requests for a whole batch of datagrams.  Every datagram needs a
+// uv_udp_send_t of its own but JS land is notified only once, after the last
+// one completed.
+class SendBatchWrap : public ReqWrap<uv_udp_send_t> {
+ public:
+  SendBatchWrap(Environment* env,
+                Local<Object> req_wrap_obj,
+                size_t count,
+                bool have_callback);
+  ~SendBatchWrap();
+  inline bool have_callback() const;
+  inline uv_udp_send_t* req_at(size_t index);
+  size_t msg_size;
+  size_t pending;
+  int status;
+  size_t self_size() const override { return sizeof(*this); }
+ private:
+  const bool have_callback_;
+  // Requests for all but the first datagram, which uses req().
+  uv_udp_send_t* const extra_reqs_;
+};
+
+
+SendBatchWrap::SendBatchWrap(Environment* env,
+                             Local<Object> req_wrap_obj,
+                             size_t count,
+                             bool have_callback)
+    : ReqWrap(env, req_wrap_obj, AsyncWrap::PROVIDER_UDPSENDWRAP),
+      msg_size(0),
+      pending(0),
+      status(0),
+      have_callback_(have_callback),
+      extra_reqs_(count > 1 ? new uv_udp_send_t[count - 1] : nullptr) {
+  Wrap(req_wrap_obj, this);
+}
+
+
+SendBatchWrap::~SendBatchWrap() {
+  delete[] extra_reqs_;
+}
+
+
+inline bool SendBatchWrap::have_callback() const {
+  return have_callback_;
+}
+
+
+inline uv_udp_send_t* SendBatchWrap::req_at(size_t index) {
+  if (index == 0)
+    return req();
+  uv_udp_send_t* req = &extra_reqs_[index - 1];
+  req->data = this;
+  return req;
+}
+
+
 static void NewSendWrap(const FunctionCallbackInfo<Value>& args) {
   CHECK(args.IsConstructCall());
 }
 
 
-UDPWrap::UDPWrap(Environment* env, Local<Object> object, AsyncWrap* parent)
+UDPWrap::UDPWrap(Environment* env,
+                 Local<Object> object,
+                 AsyncWrap* parent,
+                 unsigned int flags)
     : HandleWrap(env,
                  object,
                  reinterpret_cast<uv_handle_t*>(&handle_),
-                 AsyncWrap::PROVIDER_UDPWRAP) {
-  int r = uv_udp_init(env->event_loop(), &handle_);
+                 AsyncWrap::PROVIDER_UDPWRAP),
+      recv_batch_((flags & UV_UDP_RECVMMSG) != 0),
+      recv_ring_(nullptr),
+      recv_chunks_count_(0) {
+  CHECK_EQ(flags & ~UV_UDP_RECVMMSG, 0);
+  int r = uv_udp_init_ex(env->event_loop(), &handle_, AF_UNSPEC | flags);
   CHECK_EQ(r, 0);  // can't fail anyway
 }
 
 
+UDPWrap::~UDPWrap() {
+  free(recv_ring_);
+}
+
+
 void UDPWrap::Initialize(Local<Object> target,
                          Local<Value> unused,
                          Local<Context> context) {
@@ -91,10 +160,17 @@ void UDPWrap::Initialize(Local<Object> target,
   env->SetProtoMethod(t, "bind", Bind);
   env->SetProtoMethod(t, "send", Send);
   env->SetProtoMethod(t, "bind6", Bind6);
+  env->SetProtoMethod(t, "connect", Connect);
+  env->SetProtoMethod(t, "connect6", Connect6);
+  env->SetProtoMethod(t, "disconnect", Disconnect);
   env->SetProtoMethod(t, "send6", Send6);
+  env->SetProtoMethod(t, "sendBatch", SendBatch);
+  env->SetProtoMethod(t, "sendBatch6", SendBatch6);
   env->SetProtoMethod(t, "close", Close);
   env->SetProtoMethod(t, "recvStart", RecvStart);
   env->SetProtoMethod(t, "recvStop", RecvStop);
+  env->SetProtoMethod(t, "getpeername",
+                      GetSockOrPeerName<UDPWrap, uv_udp_getpeername>);
   env->SetProtoMethod(t, "getsockname",
                       GetSockOrPeerName<UDPWrap, uv_udp_getsockname>);
   env->SetProtoMethod(t, "addMembership", AddMembership);
@@ -130,6 +206,8 @@ void UDPWrap::New(const FunctionCallbackInfo<Value>& args) {
     new UDPWrap(env,
                 args.This(),
                 static_cast<AsyncWrap*>(args[0].As<External>()->Value()));
+  } else if (args[0]->IsUint32()) {
+    new UDPWrap(env, args.This(), nullptr, args[0]->Uint32Value());
   } else {
     UNREACHABLE();
   }
@@ -195,6 +273,60 @@ void UDPWrap::Bind6(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+void UDPWrap::DoConnect(const FunctionCallbackInfo<Value>& args, int family) {
+  UDPWrap* wrap;
+  ASSIGN_OR_RETURN_UNWRAP(&wrap,
+                          args.Holder(),
+                          args.GetReturnValue().Set(UV_EBADF));
+
+  // connect(ip, port)
+  CHECK_EQ(args.Length(), 2);
+
+  node::Utf8Value address(args.GetIsolate(), args[0]);
+  const int port = args[1]->Uint32Value();
+  char addr[sizeof(sockaddr_in6)];
+  int err;
+
+  switch (family) {
+  case AF_INET:
+    err = uv_ip4_addr(*address, port, reinterpret_cast<sockaddr_in*>(&addr));
+    break;
+  case AF_INET6:
+    err = uv_ip6_addr(*address, port, reinterpret_cast<sockaddr_in6*>(&addr));
+    break;
+  default:
+    CHECK(0 && "unexpected address family");
+    ABORT();
+  }
+
+  if (err == 0)
+    err = uv_udp_connect(&wrap->handle_, reinterpret_cast<sockaddr*>(&addr));
+
+  args.GetReturnValue().Set(err);
+}
+
+
+void UDPWrap::Connect(const FunctionCallbackInfo<Value>& args) {
+  DoConnect(args, AF_INET);
+}
+
+
+void UDPWrap::Connect6(const FunctionCallbackInfo<Value>& args) {
+  DoConnect(args, AF_INET6);
+}
+
+
+void UDPWrap::Disconnect(const FunctionCallbackInfo<Value>& args) {
+  UDPWrap* wrap;
+  ASSIGN_OR_RETURN_UNWRAP(&wrap,
+                          args.Holder(),
+                          args.GetReturnValue().Set(UV_EBADF));
+
+  int err = uv_udp_connect(&wrap->handle_, nullptr);
+  args.GetReturnValue().Set(err);
+}
+
+
 #define X(name, fn)                                                           \
   void UDPWrap::name(const FunctionCallbackInfo<Value>& args) {               \
     UDPWrap* wrap = Unwrap<UDPWrap>(args.Holder());                           \
@@ -256,21 +388,26 @@ void UDPWrap::DoSend(const FunctionCallbackInfo<Value>& args, int family) {
                           args.GetReturnValue().Set(UV_EBADF));
 
   // send(req, list, list.length, port, address, hasCallback)
+  // or send(req, list, list.length, hasCallback) on connected sockets
+  const bool sendto = args.Length() == 6;
   CHECK(args[0]->IsObject());
   CHECK(args[1]->IsArray());
   CHECK(args[2]->IsUint32());
-  CHECK(args[3]->IsUint32());
-  CHECK(args[4]->IsString());
-  CHECK(args[5]->IsBoolean());
+  if (sendto) {
+    CHECK(args[3]->IsUint32());
+    CHECK(args[4]->IsString());
+    CHECK(args[5]->IsBoolean());
+  } else {
+    CHECK_EQ(args.Length(), 4);
+    CHECK(args[3]->IsBoolean());
+  }
 
   Local<Object> req_wrap_obj = args[0].As<Object>();
   Local<Array> chunks = args[1].As<Array>();
   // it is faster to fetch the length of the
   // array in js-land
   size_t count = args[2]->Uint32Value();
-  const unsigned short port = args[3]->Uint32Value();
-  node::Utf8Value address(env->isolate(), args[4]);
-  const bool have_callback = args[5]->IsTrue();
+  const bool have_callback = args[sendto ? 5 : 3]->IsTrue();
 
   SendWrap* req_wrap = new SendWrap(env, req_wrap_obj, have_callback);
   size_t msg_size = 0;
@@ -289,19 +426,31 @@ void UDPWrap::DoSend(const FunctionCallbackInfo<Value>& args, int family) {
 
   req_wrap->msg_size = msg_size;
 
-  char addr[sizeof(sockaddr_in6)];
-  int err;
-
-  switch (family) {
-  case AF_INET:
-    err = uv_ip4_addr(*address, port, reinterpret_cast<sockaddr_in*>(&addr));
-    break;
-  case AF_INET6:
-    err = uv_ip6_addr(*address, port, reinterpret_cast<sockaddr_in6*>(&addr));
-    break;
-  default:
-    CHECK(0 && "unexpected address family");
-    ABORT();
+  char addr_storage[sizeof(sockaddr_in6)];
+  sockaddr* addr = nullptr;
+  int err = 0;
+
+  // Connected sockets send to their peer without an explicit address.
+  if (sendto) {
+    const unsigned short port = args[3]->Uint32Value();
+    node::Utf8Value address(env->isolate(), args[4]);
+    addr = reinterpret_cast<sockaddr*>(&addr_storage);
+
+    switch (family) {
+    case AF_INET:
+      err = uv_ip4_addr(*address,
+                        port,
+                        reinterpret_cast<sockaddr_in*>(&addr_storage));
+      break;
+    case AF_INET6:
+      err = uv_ip6_addr(*address,
+                        port,
+                        reinterpret_cast<sockaddr_in6*>(&addr_storage));
+      break;
+    default:
+      CHECK(0 && "unexpected address family");
+      ABORT();
+    }
   }
 
   if (err == 0) {
@@ -309,7 +458,7 @@ void UDPWrap::DoSend(const FunctionCallbackInfo<Value>& args, int family) {
                       &wrap->handle_,
                       *bufs,
                       count,
-                      reinterpret_cast<const sockaddr*>(&addr),
+                      addr,
                       OnSend);
   }
 
@@ -331,6 +480,108 @@ void UDPWrap::Send6(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+void UDPWrap::DoSendBatch(const FunctionCallbackInfo<Value>& args,
+                          int family) {
+  Environment* env = Environment::GetCurrent(args);
+
+  UDPWrap* wrap;
+  ASSIGN_OR_RETURN_UNWRAP(&wrap,
+                          args.Holder(),
+                          args.GetReturnValue().Set(UV_EBADF));
+
+  // sendBatch(req, buffers, ports, addresses, count, hasCallback)
+  CHECK(args[0]->IsObject());
+  CHECK(args[1]->IsArray());
+  CHECK(args[2]->IsArray());
+  CHECK(args[3]->IsArray());
+  CHECK(args[4]->IsUint32());
+  CHECK(args[5]->IsBoolean());
+
+  Local<Object> req_wrap_obj = args[0].As<Object>();
+  Local<Array> buffers = args[1].As<Array>();
+  Local<Array> ports = args[2].As<Array>();
+  Local<Array> addresses = args[3].As<Array>();
+  const size_t count = args[4]->Uint32Value();
+  const bool have_callback = args[5]->IsTrue();
+
+  CHECK_GT(count, 0);
+
+  // Resolve all addresses before queueing anything so that a bad address
+  // fails the batch as a whole.
+  MaybeStackBuffer<sockaddr_storage, 16> addrs(count);
+  for (size_t i = 0; i < count; i++) {
+    node::Utf8Value address(env->isolate(), addresses->Get(i));
+    const unsigned short port = ports->Get(i)->Uint32Value();
+    int err;
+
+    switch (family) {
+    case AF_INET:
+      err = uv_ip4_addr(*address,
+                        port,
+                        reinterpret_cast<sockaddr_in*>(&addrs[i]));
+      break;
+    case AF_INET6:
+      err = uv_ip6_addr(*address,
+                        port,
+                        reinterpret_cast<sockaddr_in6*>(&addrs[i]));
+      break;
+    default:
+      CHECK(0 && "unexpected address family");
+      ABORT();
+    }
+
+    if (err) {
+      args.GetReturnValue().Set(err);
+      return;
+    }
+  }
+
+  SendBatchWrap* req_wrap =
+      new SendBatchWrap(env, req_wrap_obj, count, have_callback);
+  int err = 0;
+
+  for (size_t i = 0; i < count; i++) {
+    Local<Value> chunk = buffers->Get(i);
+    uv_buf_t buf = uv_buf_init(Buffer::Data(chunk), Buffer::Length(chunk));
+
+    err = uv_udp_send(req_wrap->req_at(i),
+                      &wrap->handle_,
+                      &buf,
+                      1,
+                      reinterpret_cast<const sockaddr*>(&addrs[i]),
+                      OnSendBatch);
+    if (err)
+      break;
+
+    req_wrap->msg_size += buf.len;
+    req_wrap->pending += 1;
+  }
+
+  req_wrap->Dispatched();
+
+  // Datagrams that were queued before the error still complete normally,
+  // the error is reported together with them.
+  if (err && req_wrap->pending == 0) {
+    delete req_wrap;
+  } else {
+    req_wrap->status = err;
+    err = 0;
+  }
+
+  args.GetReturnValue().Set(err);
+}
+
+
+void UDPWrap::SendBatch(const FunctionCallbackInfo<Value>& args) {
+  DoSendBatch(args, AF_INET);
+}
+
+
+void UDPWrap::SendBatch6(const FunctionCallbackInfo<Value>& args) {
+  DoSendBatch(args, AF_INET6);
+}
+
+
 void UDPWrap::RecvStart(const FunctionCallbackInfo<Value>& args) {
   UDPWrap* wrap;
   ASSIGN_OR_RETURN_UNWRAP(&wrap,
@@ -370,9 +621,42 @@ void UDPWrap::OnSend(uv_udp_send_t* req, int status) {
 }
 
 
+void UDPWrap::OnSendBatch(uv_udp_send_t* req, int status) {
+  SendBatchWrap* req_wrap = static_cast<SendBatchWrap*>(req->data);
+  if (status < 0 && req_wrap->status == 0)
+    req_wrap->status = status;
+
+  if (--req_wrap->pending > 0)
+    return;
+
+  if (req_wrap->have_callback()) {
+    Environment* env = req_wrap->env();
+    HandleScope handle_scope(env->isolate());
+    Context::Scope context_scope(env->context());
+    Local<Value> arg[] = {
+      Integer::New(env->isolate(), req_wrap->status),
+      Integer::New(env->isolate(), req_wrap->msg_size),
+    };
+    req_wrap->MakeCallback(env->oncomplete_string(), 2, arg);
+  }
+  delete req_wrap;
+}
+
+
 void UDPWrap::OnAlloc(uv_handle_t* handle,
                       size_t suggested_size,
                       uv_buf_t* buf) {
+  UDPWrap* wrap = static_cast<UDPWrap*>(handle->data);
+
+  if (wrap->recv_batch_) {
+    const size_t size = kRecvBatchSize * kMaxDatagramSize;
+    if (wrap->recv_ring_ == nullptr)
+      wrap->recv_ring_ = node::Malloc(size);
+    buf->base = wrap->recv_ring_;
+    buf->len = size;
+    return;
+  }
+
   buf->base = node::Malloc(suggested_size);
   buf->len = suggested_size;
 }
@@ -383,13 +667,34 @@ void UDPWrap::OnRecv(uv_udp_t* handle,
                      const uv_buf_t* buf,
                      const struct sockaddr* addr,
                      unsigned int flags) {
+  UDPWrap* wrap = static_cast<UDPWrap*>(handle->data);
+
+  // Datagrams read by recvmmsg() point into the receive ring.  Collect them
+  // and hand them to JS land in one go once libuv signals the end of the
+  // batch by passing back the ring itself.
+  if (flags & UV_UDP_MMSG_CHUNK) {
+    CHECK_LT(wrap->recv_chunks_count_, kRecvBatchSize);
+    RecvChunk* chunk = &wrap->recv_chunks_[wrap->recv_chunks_count_++];
+    chunk->data = buf->base;
+    chunk->length = nread;
+    memset(&chunk->addr, 0, sizeof(chunk->addr));
+    if (addr != nullptr) {
+      memcpy(&chunk->addr,
+             addr,
+             addr->sa_family == AF_INET6 ? sizeof(sockaddr_in6)
+                                         : sizeof(sockaddr_in));
+    }
+    return;
+  }
+
   if (nread == 0 && addr == nullptr) {
-    if (buf->base != nullptr)
+    if (wrap->recv_chunks_count_ > 0)
+      wrap->FlushRecvBatch();
+    if (buf->base != nullptr && buf->base != wrap->recv_ring_)
       free(buf->base);
     return;
   }
 
-  UDPWrap* wrap = static_cast<UDPWrap*>(handle->data);
   Environment* env = wrap->env();
 
   HandleScope handle_scope(env->isolate());
@@ -404,19 +709,53 @@ void UDPWrap::OnRecv(uv_udp_t* handle,
   };
 
   if (nread < 0) {
-    if (buf->base != nullptr)
+    if (buf->base != nullptr && buf->base != wrap->recv_ring_)
       free(buf->base);
     wrap->MakeCallback(env->onmessage_string(), arraysize(argv), argv);
     return;
   }
 
-  char* base = node::UncheckedRealloc(buf->base, nread);
-  argv[2] = Buffer::New(env, base, nread).ToLocalChecked();
+  if (buf->base == wrap->recv_ring_) {
+    argv[2] = Buffer::Copy(env, buf->base, nread).ToLocalChecked();
+  } else {
+    char* base = node::UncheckedRealloc(buf->base, nread);
+    argv[2] = Buffer::New(env, base, nread).ToLocalChecked();
+  }
   argv[3] = AddressToJS(env, addr);
   wrap->MakeCallback(env->onmessage_string(), arraysize(argv), argv);
 }
 
 
+void UDPWrap::FlushRecvBatch() {
+  Environment* env = this->env();
+  HandleScope handle_scope(env->isolate());
+  Context::Scope context_scope(env->context());
+
+  const size_t count = recv_chunks_count_;
+  recv_chunks_count_ = 0;
+
+  Local<Array> buffers = Array::New(env->isolate(), count);
+  Local<Array> addresses = Array::New(env->isolate(), count);
+  for (size_t i = 0; i < count; i++) {
+    const RecvChunk& chunk = recv_chunks_[i];
+    buffers->Set(i,
+                 Buffer::Copy(env, chunk.data, chunk.length).ToLocalChecked());
+    addresses->Set(i,
+                   AddressToJS(env,
+                               reinterpret_cast<const sockaddr*>(&chunk.addr)));
+  }
+
+  // onmessage(count, handle, buffers, addresses)
+  Local<Value> argv[] = {
+    Integer::New(env->isolate(), count),
+    object(),
+    buffers,
+    addresses
+  };
+  MakeCallback(env->onmessage_string(), arraysize(argv), argv);
+}
+
+
 Local<Object> UDPWrap::Instantiate(Environment* env, AsyncWrap* parent) {
   EscapableHandleScope scope(env->isolate());
   // If this assert fires then Initialize hasn't been called yet.
@@ -24,7 +24,12 @@ class UDPWrap: public HandleWrap {
   static void Bind(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void Send(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void Bind6(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void Connect(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void Connect6(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void Disconnect(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void Send6(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void SendBatch(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void SendBatch6(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void RecvStart(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void RecvStop(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void AddMembership(const v8::FunctionCallbackInfo<v8::Value>& args);
@@ -43,16 +48,34 @@ class UDPWrap: public HandleWrap {
  private:
   typedef uv_udp_t HandleType;
 
+  static const size_t kMaxDatagramSize = 64 * 1024;
+  // Number of datagrams that a single recvmmsg() call reads at most.
+  static const size_t kRecvBatchSize = 20;
+
+  struct RecvChunk {
+    const char* data;
+    size_t length;
+    sockaddr_storage addr;
+  };
+
   template <typename T,
             int (*F)(const typename T::HandleType*, sockaddr*, int*)>
   friend void GetSockOrPeerName(const v8::FunctionCallbackInfo<v8::Value>&);
 
-  UDPWrap(Environment* env, v8::Local<v8::Object> object, AsyncWrap* parent);
+  UDPWrap(Environment* env,
+          v8::Local<v8::Object> object,
+          AsyncWrap* parent,
+          unsigned int flags = 0);
+  ~UDPWrap() override;
 
   static void DoBind(const v8::FunctionCallbackInfo<v8::Value>& args,
                      int family);
+  static void DoConnect(const v8::FunctionCallbackInfo<v8::Value>& args,
+                        int family);
   static void DoSend(const v8::FunctionCallbackInfo<v8::Value>& args,
                      int family);
+  static void DoSendBatch(const v8::FunctionCallbackInfo<v8::Value>& args,
+                          int family);
   static void SetMembership(const v8::FunctionCallbackInfo<v8::Value>& args,
                             uv_membership membership);
 
@@ -60,13 +83,21 @@ class UDPWrap: public HandleWrap {
                       size_t suggested_size,
                       uv_buf_t* buf);
   static void OnSend(uv_udp_send_t* req, int status);
+  static void OnSendBatch(uv_udp_send_t* req, int status);
   static void OnRecv(uv_udp_t* handle,
                      ssize_t nread,
                      const uv_buf_t* buf,
                      const struct sockaddr* addr,
                      unsigned int flags);
 
+  void FlushRecvBatch();
+
   uv_udp_t handle_;
+  const bool recv_batch_;
+  // Receive buffer shared by all recvmmsg() calls when recv_batch_ is set.
+  char* recv_ring_;
+  RecvChunk recv_chunks_[kRecvBatchSize];
+  size_t recv_chunks_count_;
 };
 
 }  // namespace node
@@ -0,0 +1,128 @@
+#include "base64.h"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+// The inputs are long enough to go through the vectorized kernels, when
+// the CPU supports them, and cover the scalar code for the leftovers.
+
+static std::string Encode(const std::string& input) {
+  std::string output(base64_encoded_size(input.size()), '\0');
+  const size_t written = node::base64_encode(input.data(), input.size(),
+                                             &output[0], output.size());
+  EXPECT_EQ(output.size(), written);
+  return output;
+}
+
+template <typename TypeName>
+static std::string Decode(const std::basic_string<TypeName>& input) {
+  std::string output(node::base64_decoded_size(input.data(), input.size()),
+                     '\0');
+  const size_t written = node::base64_decode(&output[0], output.size(),
+                                             input.data(), input.size());
+  output.resize(written);
+  return output;
+}
+
+// Straightforward encoder to compare against.
+static std::string ReferenceEncode(const std::string& input) {
+  static const char table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                              "abcdefghijklmnopqrstuvwxyz"
+                              "0123456789+/";
+  std::string output;
+  for (size_t i = 0; i < input.size(); i += 3) {
+    uint32_t v = static_cast<uint8_t>(input[i]) << 16;
+    if (i + 1 < input.size())
+      v |= static_cast<uint8_t>(input[i + 1]) << 8;
+    if (i + 2 < input.size())
+      v |= static_cast<uint8_t>(input[i + 2]);
+    output += table[(v >> 18) & 63];
+    output += table[(v >> 12) & 63];
+    output += i + 1 < input.size() ? table[(v >> 6) & 63] : '=';
+    output += i + 2 < input.size() ? table[v & 63] : '=';
+  }
+  return output;
+}
+
+static std::string Bytes(size_t length) {
+  std::string bytes;
+  for (size_t i = 0; i < length; i++)
+    bytes += static_cast<char>(i * 151 + 7);
+  return bytes;
+}
+
+TEST(Base64Test, Encode) {
+  for (size_t length = 0; length < 300; length++) {
+    const std::string input = Bytes(length);
+    EXPECT_EQ(ReferenceEncode(input), Encode(input)) << "length " << length;
+  }
+}
+
+TEST(Base64Test, Decode) {
+  for (size_t length = 0; length < 300; length++) {
+    const std::string input = Bytes(length);
+    const std::string encoded = ReferenceEncode(input);
+    EXPECT_EQ(input, Decode(encoded)) << "length " << length;
+
+    const std::basic_string<uint16_t> wide(encoded.begin(), encoded.end());
+    EXPECT_EQ(input, Decode(wide)) << "length " << length;
+  }
+}
+
+TEST(Base64Test, DecodeAllCharacters) {
+  std::string input;
+  for (int i = 0; i < 3 * 64; i++)
+    input += static_cast<char>(i);
+  const std::string encoded = ReferenceEncode(input);
+  // Every character of the alphabet appears in every position of a block.
+  EXPECT_EQ(input, Decode(encoded));
+}
+
+TEST(Base64Test, DecodeSkipsWhitespace) {
+  const std::string input = Bytes(200);
+  std::string encoded = ReferenceEncode(input);
+  for (size_t i = 76; i < encoded.size(); i += 77)
+    encoded.insert(i, "\n");
+  EXPECT_EQ(input, Decode(encoded));
+}
+
+TEST(Base64Test, DecodeUrlSafe) {
+  const std::string input = Bytes(200);
+  std::string encoded = ReferenceEncode(input);
+  for (char& c : encoded) {
+    if (c == '+') c = '-';
+    if (c == '/') c = '_';
+  }
+  EXPECT_EQ(input, Decode(encoded));
+}
+
+TEST(Base64Test, DecodeStopsAtPadding) {
+  const std::string first = Bytes(40);
+  const std::string encoded = ReferenceEncode(first + "x") +
+                              ReferenceEncode(Bytes(60));
+  EXPECT_EQ(first + "x", Decode(encoded));
+}
+
+TEST(Base64Test, DecodeTruncatesTwoByteCharacters) {
+  const std::string input = Bytes(120);
+  const std::string encoded = ReferenceEncode(input);
+  std::basic_string<uint16_t> wide(encoded.begin(), encoded.end());
+  // Like the scalar code, only the low byte counts.
+  wide[50] += 0x100;
+  EXPECT_EQ(input, Decode(wide));
+}
+
+TEST(Base64Test, DecodeRespectsDestinationLength) {
+  const std::string input = Bytes(200);
+  const std::string encoded = ReferenceEncode(input);
+  for (size_t length = 0; length < input.size(); length += 7) {
+    std::string output(input.size(), '*');
+    const size_t written = node::base64_decode(&output[0], length,
+                                               encoded.data(), encoded.size());
+    EXPECT_EQ(length, written);
+    EXPECT_EQ(input.substr(0, length), output.substr(0, length));
+    EXPECT_EQ(std::string(input.size() - length, '*'), output.substr(length));
+  }
+}
@@ -0,0 +1,298 @@
+#include "simd.h"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+using node::simd::AsciiPrefixLength;
+using node::simd::ForceAscii;
+using node::simd::HexDecodeVector;
+using node::simd::HexEncode;
+using node::simd::IsAscii;
+using node::simd::IsValidUtf8;
+using node::simd::Utf8ToLatin1;
+
+// The inputs are long enough to go through the vectorized kernels, when
+// the CPU supports them, and put the interesting bytes at every position
+// of a block and across the block boundaries.
+
+// Straightforward validator to compare against, after the table in
+// section 3.9 of the Unicode standard.
+static bool ReferenceIsValidUtf8(const std::string& input) {
+  const uint8_t* s = reinterpret_cast<const uint8_t*>(input.data());
+  const size_t n = input.size();
+  size_t i = 0;
+  while (i < n) {
+    uint32_t cp;
+    size_t len;
+    if (s[i] < 0x80) {
+      cp = s[i];
+      len = 1;
+    } else if ((s[i] & 0xE0) == 0xC0) {
+      cp = s[i] & 0x1F;
+      len = 2;
+    } else if ((s[i] & 0xF0) == 0xE0) {
+      cp = s[i] & 0x0F;
+      len = 3;
+    } else if ((s[i] & 0xF8) == 0xF0) {
+      cp = s[i] & 0x07;
+      len = 4;
+    } else {
+      return false;
+    }
+    if (i + len > n)
+      return false;
+    for (size_t j = 1; j < len; j++) {
+      if ((s[i + j] & 0xC0) != 0x80)
+        return false;
+      cp = (cp << 6) | (s[i + j] & 0x3F);
+    }
+    static const uint32_t min[] = { 0, 0, 0x80, 0x800, 0x10000 };
+    if (cp < min[len] || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF))
+      return false;
+    i += len;
+  }
+  return true;
+}
+
+static std::string Text(size_t length) {
+  std::string text;
+  for (size_t i = 0; i < length; i++)
+    text += static_cast<char>('a' + i % 26);
+  return text;
+}
+
+static std::string Bytes(size_t length) {
+  std::string bytes;
+  for (size_t i = 0; i < length; i++)
+    bytes += static_cast<char>(i * 151 + 7);
+  return bytes;
+}
+
+// Well-formed text with sequences of every length.
+static std::string MixedText(size_t count) {
+  static const char* const pieces[] = {
+    "a", "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80", "z",
+    "\xC2\x80", "\xDF\xBF", "\xE0\xA0\x80", "\xED\x9F\xBF", "\xEF\xBF\xBF",
+    "\xF0\x90\x80\x80", "\xF4\x8F\xBF\xBF", "0"
+  };
+  std::string text;
+  for (size_t i = 0; i < count; i++)
+    text += pieces[(i * 7) % (sizeof(pieces) / sizeof(pieces[0]))];
+  return text;
+}
+
+TEST(SimdTest, IsAscii) {
+  for (size_t length = 0; length < 300; length++) {
+    const std::string text = Text(length);
+    EXPECT_TRUE(IsAscii(text.data(), text.size())) << "length " << length;
+    for (size_t i = 0; i < length; i++) {
+      std::string copy = text;
+      copy[i] = '\x80';
+      EXPECT_FALSE(IsAscii(copy.data(), copy.size())) << "at " << i;
+    }
+  }
+}
+
+TEST(SimdTest, AsciiPrefixLength) {
+  for (size_t length = 0; length < 300; length++) {
+    const std::string text = Text(length);
+    EXPECT_EQ(length, AsciiPrefixLength(text.data(), text.size()));
+    for (size_t i = 0; i < length; i++) {
+      std::string copy = text;
+      copy[i] = '\xC4';
+      if (i + 1 < length)
+        copy[length - 1] = '\x80';
+      EXPECT_EQ(i, AsciiPrefixLength(copy.data(), copy.size())) << "at " << i;
+    }
+  }
+}
+
+TEST(SimdTest, ForceAscii) {
+  for (size_t length = 0; length < 300; length++) {
+    const std::string input = Bytes(length);
+    // Unaligned on both sides.
+    std::vector<char> output(length + 1, '*');
+    ForceAscii(input.data(), output.data() + 1, length);
+    EXPECT_EQ('*', output[0]);
+    for (size_t i = 0; i < length; i++)
+      EXPECT_EQ(input[i] & 0x7f, output[i + 1]) << "at " << i;
+  }
+}
+
+TEST(SimdTest, IsValidUtf8) {
+  for (size_t count = 0; count < 150; count++) {
+    const std::string text = MixedText(count);
+    EXPECT_TRUE(IsValidUtf8(text.data(), text.size())) << "count " << count;
+
+    // Cutting off the last sequence anywhere in the middle.
+    const std::string prefix = MixedText(count > 0 ? count - 1 : 0);
+    for (size_t length = prefix.size() + 1; length < text.size(); length++)
+      EXPECT_FALSE(IsValidUtf8(text.data(), length)) << "length " << length;
+  }
+}
+
+TEST(SimdTest, IsValidUtf8Errors) {
+  static const char* const errors[] = {
+    "\x80",                  // Continuation without lead byte.
+    "\xBF",
+    "\xC0\x80",              // Overlong.
+    "\xC1\xBF",
+    "\xE0\x9F\xBF",
+    "\xF0\x8F\xBF\xBF",
+    "\xED\xA0\x80",          // Surrogates.
+    "\xED\xBF\xBF",
+    "\xF4\x90\x80\x80",      // Above U+10FFFF.
+    "\xF5\x80\x80\x80",
+    "\xF8\x88\x80\x80\x80",  // Invalid lead bytes.
+    "\xFF",
+    "\xC3",                  // Too short.
+    "\xE2\x82",
+    "\xF0\x9F\x98",
+    "\xC3\xA9\xA9",          // Too long.
+    "\xE2\x82\xAC\x80",
+  };
+  for (const char* error : errors) {
+    for (size_t offset = 0; offset < 70; offset++) {
+      for (const std::string& filler : { Text(100), MixedText(50) }) {
+        std::string text = filler;
+        // Start at a sequence boundary.
+        size_t at = offset;
+        while (at < text.size() && (text[at] & 0xC0) == 0x80)
+          at++;
+        text.insert(at, error);
+        EXPECT_FALSE(IsValidUtf8(text.data(), text.size()))
+            << "offset " << offset;
+        ASSERT_FALSE(ReferenceIsValidUtf8(text));
+      }
+    }
+  }
+}
+
+TEST(SimdTest, IsValidUtf8MatchesReference) {
+  // Random bytes, mostly around the interesting ranges.
+  uint32_t state = 1;
+  for (int round = 0; round < 20000; round++) {
+    std::string text;
+    const size_t length = round % 97;
+    for (size_t i = 0; i < length; i++) {
+      state = state * 1103515245 + 12345;
+      const uint8_t r = state >> 16;
+      text += static_cast<char>(r & 1 ? 0x80 | (r >> 2) : 'a' + (r & 7));
+    }
+    EXPECT_EQ(ReferenceIsValidUtf8(text), IsValidUtf8(text.data(), length))
+        << "round " << round;
+  }
+}
+
+TEST(SimdTest, Utf8ToLatin1) {
+  std::string latin1;
+  for (int i = 0; i < 512; i++)
+    latin1 += static_cast<char>(i);
+  std::string utf8;
+  for (unsigned char c : latin1) {
+    if (c < 0x80) {
+      utf8 += c;
+    } else {
+      utf8 += static_cast<char>(0xC0 | (c >> 6));
+      utf8 += static_cast<char>(0x80 | (c & 0x3F));
+    }
+  }
+
+  std::vector<char> output(utf8.size());
+  size_t written = 0;
+  ASSERT_TRUE(Utf8ToLatin1(utf8.data(), utf8.size(), output.data(), &written));
+  EXPECT_EQ(latin1, std::string(output.data(), written));
+
+  // Anything that needs two bytes per character does not fit.
+  const std::string euro = Text(40) + "\xE2\x82\xAC";
+  EXPECT_FALSE(Utf8ToLatin1(euro.data(), euro.size(), output.data(),
+                            &written));
+  const std::string truncated = Text(40) + "\xC3";
+  EXPECT_FALSE(Utf8ToLatin1(truncated.data(), truncated.size(), output.data(),
+                            &written));
+  const std::string overlong = Text(40) + "\xC1\xBF";
+  EXPECT_FALSE(Utf8ToLatin1(overlong.data(), overlong.size(), output.data(),
+                            &written));
+}
+
+static std::string ReferenceHex(const std::string& input) {
+  static const char digits[] = "0123456789abcdef";
+  std::string hex;
+  for (unsigned char c : input) {
+    hex += digits[c >> 4];
+    hex += digits[c & 15];
+  }
+  return hex;
+}
+
+TEST(SimdTest, HexEncode) {
+  for (size_t length = 0; length < 300; length++) {
+    const std::string input = Bytes(length);
+    std::string output(length * 2, '\0');
+    EXPECT_EQ(length * 2, HexEncode(input.data(), length, &output[0]));
+    EXPECT_EQ(ReferenceHex(input), output) << "length " << length;
+  }
+}
+
+// The vectorized decoder may leave any suffix to the caller, but whatever
+// it decodes must be right and it must not write past what it reports.
+template <typename TypeName>
+static void CheckHexDecode(const std::basic_string<TypeName>& hex,
+                           const std::string& expected, size_t dstlen) {
+  std::string output(dstlen + 64, '*');
+  const size_t written =
+      HexDecodeVector(&output[0], dstlen, hex.data(), hex.size());
+  EXPECT_LE(written, dstlen);
+  EXPECT_LE(written, expected.size());
+  EXPECT_EQ(expected.substr(0, written), output.substr(0, written));
+  EXPECT_EQ(std::string(output.size() - written, '*'), output.substr(written));
+}
+
+TEST(SimdTest, HexDecode) {
+  for (size_t length = 0; length < 300; length++) {
+    const std::string input = Bytes(length);
+    std::string hex = ReferenceHex(input);
+    // Upper case digits are fine too.
+    for (size_t i = 0; i < hex.size(); i += 3)
+      hex[i] = toupper(hex[i]);
+    const std::basic_string<uint16_t> wide(hex.begin(), hex.end());
+    CheckHexDecode(hex, input, length);
+    CheckHexDecode(wide, input, length);
+    CheckHexDecode(hex, input, length / 2);
+  }
+
+  // Long inputs go all the way through the vectorized kernels.
+  if (node::simd::level() != node::simd::kScalar) {
+    const std::string input = Bytes(256);
+    const std::string hex = ReferenceHex(input);
+    std::string output(input.size(), '\0');
+    EXPECT_EQ(input.size(), HexDecodeVector(&output[0], output.size(),
+                                            hex.data(), hex.size()));
+    EXPECT_EQ(input, output);
+  }
+}
+
+TEST(SimdTest, HexDecodeStopsAtInvalidCharacters) {
+  const std::string input = Bytes(200);
+  const std::string hex = ReferenceHex(input);
+  for (const char c : { 'g', 'G', '/', ':', '@', '`', ' ', '\0', '\xB0' }) {
+    for (size_t at = 0; at < hex.size(); at += 5) {
+      std::string bad = hex;
+      bad[at] = c;
+      std::string output(input.size(), '\0');
+      const size_t written = HexDecodeVector(&output[0], output.size(),
+                                             bad.data(), bad.size());
+      EXPECT_LE(written, at / 2) << "at " << at;
+      EXPECT_EQ(input.substr(0, written), output.substr(0, written));
+
+      // Characters above 0xFF do not pass for their low byte.
+      std::basic_string<uint16_t> wide(hex.begin(), hex.end());
+      wide[at] += 0x100;
+      EXPECT_LE(HexDecodeVector(&output[0], output.size(),
+                                wide.data(), wide.size()),
+                at / 2) << "at " << at;
+    }
+  }
+}
@@ -15,6 +15,7 @@ const net = require('net');
 const tls = require('tls');
 const zlib = require('zlib');
 const ChildProcess = require('child_process').ChildProcess;
+const Worker = require('worker_threads').Worker;
 const StreamWrap = require('_stream_wrap').StreamWrap;
 const HTTPParser = process.binding('http_parser').HTTPParser;
 const async_wrap = process.binding('async_wrap');
@@ -79,6 +80,9 @@ net.createServer(function(c) {
 });
 
 net.createServer(function(c) {
+  const fd = fs.openSync(__filename, 'r');
+  c.on('close', () => fs.closeSync(fd));
+  c.sendFile(fd, 0, 1);
   c.end();
   this.close(checkTLS);
 }).listen(0, function() {
@@ -115,6 +119,8 @@ new ChildProcess();
 
 new HTTPParser(HTTPParser.REQUEST);
 
+new Worker('', { eval: true });
+
 process.on('exit', function() {
   if (keyList.length !== 0) {
     process._rawDebug('Not all keys have been used:');
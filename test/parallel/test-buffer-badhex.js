@@ -47,3 +47,25 @@ const Buffer = require('buffer').Buffer;
   const badHex = hex.slice(0, 256) + 'xx' + hex.slice(256, 510);
   assert.deepStrictEqual(Buffer.from(badHex, 'hex'), buf.slice(0, 128));
 }
+
+{
+  // Long enough for the vectorized kernels, with the bad characters at
+  // every position of a block, in one-byte and two-byte strings.
+  const buf = Buffer.alloc(300);
+  for (let i = 0; i < buf.length; i++)
+    buf[i] = i * 151 + 7;
+
+  const hex = buf.toString('hex');
+  assert.strictEqual(hex, Array.from(buf, (b) => (b + 0x100).toString(16)
+                                                 .slice(1)).join(''));
+  assert.deepStrictEqual(Buffer.from(hex.toUpperCase(), 'hex'), buf);
+  assert.deepStrictEqual(Buffer.from(hex + 'Ā', 'hex'), buf);
+
+  for (let at = 0; at < 200; at += 3) {
+    for (const bad of ['g', '/', ':', '@', '`', '°', 'Ġ']) {
+      const badHex = hex.slice(0, at) + bad + hex.slice(at + 1);
+      assert.deepStrictEqual(Buffer.from(badHex, 'hex'),
+                             buf.slice(0, at >> 1));
+    }
+  }
+}
@@ -0,0 +1,81 @@
+'use strict';
+
+require('../common');
+const assert = require('assert');
+const { isUtf8, isAscii } = require('buffer');
+
+const valid = [
+  '',
+  'hello',
+  'héllo wörld',
+  '€ 100',
+  '😀 emoji',
+  '\u0000\u007f\u0080߿ࠀ￿',
+  '日本語'.repeat(100),
+  'a'.repeat(1000) + '\u{10ffff}'
+];
+
+for (const str of valid) {
+  const buf = Buffer.from(str);
+  assert.strictEqual(isUtf8(buf), true, str);
+  assert.strictEqual(isAscii(buf), /^[\x00-\x7f]*$/.test(str), str);
+}
+
+const invalid = [
+  [0x80],
+  [0xc3],
+  [0xc0, 0x80],
+  [0xe2, 0x82],
+  [0xed, 0xa0, 0x80],
+  [0xf4, 0x90, 0x80, 0x80],
+  [0xf8, 0x88, 0x80, 0x80, 0x80],
+  [0xff]
+];
+
+for (const bytes of invalid) {
+  for (const pad of [0, 15, 31, 100]) {
+    const buf = Buffer.concat([Buffer.alloc(pad, 'a'), Buffer.from(bytes),
+                               Buffer.alloc(pad, 'b')]);
+    assert.strictEqual(isUtf8(buf), false, bytes.join());
+    assert.strictEqual(isAscii(buf), false, bytes.join());
+  }
+}
+
+{
+  // Only the bytes the view covers count.
+  const buf = Buffer.from([0xff, 0x61, 0x62, 0xff]);
+  assert.strictEqual(isUtf8(buf), false);
+  assert.strictEqual(isUtf8(buf.slice(1, 3)), true);
+  assert.strictEqual(isAscii(buf.slice(1, 3)), true);
+  assert.strictEqual(isUtf8(new DataView(buf.buffer, buf.byteOffset + 1, 2)),
+                     true);
+}
+
+{
+  // Other views and buffers.
+  const ab = new ArrayBuffer(4);
+  assert.strictEqual(isUtf8(ab), true);
+  assert.strictEqual(isAscii(new Uint16Array([0x6162])), true);
+  new Uint8Array(ab)[0] = 0x80;
+  assert.strictEqual(isUtf8(ab), false);
+  assert.strictEqual(isAscii(ab), false);
+  assert.strictEqual(isUtf8(new Uint32Array(ab, 0, 0)), true);
+}
+
+for (const input of [undefined, null, 'string', 42, {}, [0x61]]) {
+  assert.throws(() => isUtf8(input),
+                /^TypeError: "input" argument must be an ArrayBuffer, /);
+  assert.throws(() => isAscii(input),
+                /^TypeError: "input" argument must be an ArrayBuffer, /);
+}
+
+{
+  // Decoding takes the one-byte fast paths for these, the result must not
+  // change.
+  const samples = ['a'.repeat(2000), 'é'.repeat(1000), 'ÿ\u0080'.repeat(500),
+                   'a'.repeat(2e6), 'ü'.repeat(2e6), 'a€'.repeat(100)];
+  for (const str of samples)
+    assert.strictEqual(Buffer.from(str).toString(), str);
+  // Not well-formed, so it goes through V8's decoder.
+  assert.strictEqual(Buffer.from([0x61, 0xc3]).toString(), 'a�');
+}
@@ -0,0 +1,75 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const child_process = require('child_process');
+const net = require('net');
+
+const values = [
+  'a string',
+  Buffer.from('a buffer'),
+  new Map([['key', { nested: [1, 2, 3] }]]),
+  new Set([1, 'two']),
+  new Date(1234567890),
+  new Float32Array([0.5, 1.5]),
+  { big: 'x'.repeat(256 * 1024) },
+  null
+];
+
+if (process.argv[2] === 'child') {
+  process.on('message', (message, handle) => {
+    if (handle) {
+      handle.close();
+      process.send({ gotHandle: message instanceof Map });
+      return;
+    }
+    process.send(message);
+    if (message === null)
+      process.disconnect();
+  });
+  return;
+}
+
+assert.throws(() => {
+  child_process.fork(__filename, ['child'], { serialization: 'yaml' });
+}, /"serialization" must be "json" or "advanced"/);
+
+const child = child_process.fork(__filename, ['child'], {
+  serialization: 'advanced'
+});
+
+const received = [];
+child.on('message', common.mustCall((message) => {
+  if (message !== null && message.gotHandle !== undefined) {
+    assert.strictEqual(message.gotHandle, true);
+    for (const value of values)
+      child.send(value);
+    return;
+  }
+  received.push(message);
+}, values.length + 1));
+
+child.on('exit', common.mustCall((code) => {
+  assert.strictEqual(code, 0);
+  assert.strictEqual(received.length, values.length);
+  assert(Buffer.isBuffer(received[1]));
+  assert(received[1].equals(values[1]));
+  assert(received[2] instanceof Map);
+  assert.deepStrictEqual(received[2].get('key'), { nested: [1, 2, 3] });
+  assert(received[3] instanceof Set);
+  assert(received[3].has('two'));
+  assert(received[4] instanceof Date);
+  assert.strictEqual(received[4].getTime(), 1234567890);
+  assert(received[5] instanceof Float32Array);
+  assert.deepStrictEqual(Array.from(received[5]), [0.5, 1.5]);
+  assert.strictEqual(received[6].big, values[6].big);
+  assert.strictEqual(received[7], null);
+}));
+
+// Handles travel with binary messages as well.
+const server = net.createServer();
+server.listen(0, common.mustCall(() => {
+  child.send(new Map(), server, common.mustCall((err) => {
+    assert.ifError(err);
+    server.close();
+  }));
+}));
@@ -0,0 +1,33 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const ChildProcess = require('child_process').ChildProcess;
+
+// A child whose parent asks for a serialization mode it does not know falls
+// back to JSON with a warning instead of failing at startup.
+if (process.argv[2] === 'child') {
+  process.send('hello');
+  process.disconnect();
+  return;
+}
+
+const child = new ChildProcess();
+let stderr = '';
+child.spawn({
+  file: process.execPath,
+  args: [process.execPath, __filename, 'child'],
+  // Comes before the NODE_CHANNEL_SERIALIZATION_MODE that spawn() adds.
+  envPairs: ['NODE_CHANNEL_SERIALIZATION_MODE=yaml'],
+  stdio: ['ignore', 'ignore', 'pipe', 'ipc']
+});
+child.stderr.setEncoding('utf8');
+child.stderr.on('data', (chunk) => stderr += chunk);
+
+child.on('message', common.mustCall((message) => {
+  assert.strictEqual(message, 'hello');
+}));
+
+child.on('exit', common.mustCall((code) => {
+  assert.strictEqual(code, 0);
+  assert(/Unknown NODE_CHANNEL_SERIALIZATION_MODE "yaml"/.test(stderr));
+}));
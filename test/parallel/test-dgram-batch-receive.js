@@ -0,0 +1,32 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const dgram = require('dgram');
+
+// Datagrams read in batches still emit one 'message' event each, in order and
+// with their own copy of the payload.
+const count = 50;
+const receiver = dgram.createSocket({ type: 'udp4', batchReceive: true });
+const sender = dgram.createSocket('udp4');
+let received = 0;
+
+receiver.on('message', common.mustCall((msg, rinfo) => {
+  assert.strictEqual(msg.toString(), `message ${received}`);
+  assert.strictEqual(rinfo.size, msg.length);
+  assert.strictEqual(rinfo.family, 'IPv4');
+  assert.strictEqual(rinfo.address, common.localhostIPv4);
+  assert.strictEqual(rinfo.port, sender.address().port);
+
+  if (++received === count) {
+    receiver.close();
+    sender.close();
+  }
+}, count));
+
+receiver.bind(0, common.localhostIPv4, common.mustCall(() => {
+  sender.bind(0, common.localhostIPv4, common.mustCall(() => {
+    const port = receiver.address().port;
+    for (let i = 0; i < count; i++)
+      sender.send(`message ${i}`, port, common.localhostIPv4);
+  }));
+}));
@@ -0,0 +1,28 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const dgram = require('dgram');
+
+// Datagrams sent while connect() is pending are not dropped silently when
+// the connection fails, their callbacks are called with the connect error.
+const client = dgram.createSocket('udp4');
+
+// An IPv6 address can't be the peer of an udp4 socket.
+client.connect(common.PORT, '::1', common.mustCall((err) => {
+  assert.strictEqual(err.code, 'EINVAL');
+  assert.strictEqual(err.syscall, 'connect');
+}));
+
+// Queued until connect() completes.
+client.send('first', common.mustCall((err) => {
+  assert.strictEqual(err.code, 'EINVAL');
+  assert.strictEqual(err.syscall, 'connect');
+}));
+
+client.send(Buffer.from('-second-'), 1, 6, common.mustCall((err) => {
+  assert.strictEqual(err.code, 'EINVAL');
+  client.close();
+}));
+
+// Without a callback, the error is reported by connect() alone.
+client.send('third');
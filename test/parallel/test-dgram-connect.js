@@ -0,0 +1,57 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const dgram = require('dgram');
+
+// A connected socket sends to its peer without a port or address and only
+// receives datagrams from that peer.
+const server = dgram.createSocket('udp4');
+const client = dgram.createSocket('udp4');
+
+assert.throws(() => client.connect(0), RangeError);
+assert.throws(() => client.connect(1234, 42), TypeError);
+assert.throws(() => client.disconnect(), /^Error: Socket is not connected$/);
+assert.throws(() => client.remoteAddress(),
+              /^Error: Socket is not connected$/);
+
+server.bind(0, common.localhostIPv4, common.mustCall(() => {
+  const port = server.address().port;
+
+  client.connect(port, common.localhostIPv4, common.mustCall(() => {
+    assert.deepStrictEqual(client.remoteAddress(), {
+      address: common.localhostIPv4,
+      family: 'IPv4',
+      port: port
+    });
+    assert.throws(() => client.connect(port),
+                  /^Error: Socket is already connected$/);
+    assert.throws(() => client.send('x', port, common.localhostIPv4),
+                  /^Error: Connected sockets send only to their peer$/);
+
+    client.send(Buffer.from('-second-'), 1, 6, common.mustCall((err, sent) => {
+      assert.ifError(err);
+      assert.strictEqual(sent, 6);
+    }));
+  }));
+
+  // Sent once the connection is established.
+  client.send('first', common.mustCall((err, sent) => {
+    assert.ifError(err);
+    assert.strictEqual(sent, 5);
+  }));
+}));
+
+const expected = new Set(['first', 'second']);
+server.on('message', common.mustCall((msg, rinfo) => {
+  assert(expected.delete(msg.toString()));
+  assert.strictEqual(rinfo.port, client.address().port);
+
+  if (expected.size === 0) {
+    client.disconnect();
+    assert.throws(() => client.remoteAddress(),
+                  /^Error: Socket is not connected$/);
+    assert.throws(() => client.send('x'), RangeError);
+    client.close();
+    server.close();
+  }
+}, 2));
@@ -0,0 +1,43 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const dgram = require('dgram');
+
+const receiver = dgram.createSocket('udp4');
+const sender = dgram.createSocket('udp4');
+const count = 30;
+const seen = new Set();
+
+assert.throws(() => sender.sendBatch('foo'), TypeError);
+assert.throws(() => sender.sendBatch([null]), TypeError);
+assert.throws(() => sender.sendBatch([{ msg: 42, port: 1234 }]), TypeError);
+assert.throws(() => sender.sendBatch([{ msg: 'a', port: 0 }]), RangeError);
+
+sender.sendBatch([], common.mustCall((err, sent) => {
+  assert.ifError(err);
+  assert.strictEqual(sent, 0);
+}));
+
+receiver.on('message', common.mustCall((msg) => {
+  seen.add(msg.toString());
+  if (seen.size === count) {
+    receiver.close();
+    sender.close();
+  }
+}, count));
+
+receiver.bind(0, common.localhostIPv4, common.mustCall(() => {
+  const port = receiver.address().port;
+  const messages = [];
+  let bytes = 0;
+  for (let i = 0; i < count; i++) {
+    const msg = i % 2 ? Buffer.from(`buffer ${i}`) : `string ${i}`;
+    bytes += Buffer.byteLength(msg);
+    messages.push({ msg, port, address: common.localhostIPv4 });
+  }
+
+  sender.sendBatch(messages, common.mustCall((err, sent) => {
+    assert.ifError(err);
+    assert.strictEqual(sent, bytes);
+  }));
+}));
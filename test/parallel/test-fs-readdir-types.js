@@ -0,0 +1,76 @@
+'use strict';
+
+const common = require('../common');
+const assert = require('assert');
+const fs = require('fs');
+const path = require('path');
+
+const readdirDir = common.tmpDir;
+const files = ['empty', 'files', 'for', 'just', 'testing'];
+const dirs = ['a-dir', 'z-dir'];
+
+common.refreshTmpDir();
+
+files.forEach(function(currentFile) {
+  fs.closeSync(fs.openSync(path.join(readdirDir, currentFile), 'w'));
+});
+dirs.forEach(function(currentDir) {
+  fs.mkdirSync(path.join(readdirDir, currentDir));
+});
+
+function byName(a, b) {
+  return a.name < b.name ? -1 : a.name > b.name ? 1 : 0;
+}
+
+function assertDirents(dirents) {
+  assert.strictEqual(dirents.length, files.length + dirs.length);
+  dirents.sort(byName);
+  for (const dirent of dirents) {
+    const name = dirent.name.toString();
+    assert(dirent instanceof fs.Dirent);
+    assert.strictEqual(dirent.isFile(), files.includes(name));
+    assert.strictEqual(dirent.isDirectory(), dirs.includes(name));
+    assert.strictEqual(dirent.isSymbolicLink(), false);
+    assert.strictEqual(dirent.isFIFO(), false);
+    assert.strictEqual(dirent.isSocket(), false);
+    assert.strictEqual(dirent.isCharacterDevice(), false);
+    assert.strictEqual(dirent.isBlockDevice(), false);
+  }
+  assert.deepStrictEqual(dirents.map((d) => d.name.toString()),
+                         dirs.concat(files).sort());
+}
+
+assertDirents(fs.readdirSync(readdirDir, { withFileTypes: true }));
+
+fs.readdir(readdirDir, { withFileTypes: true },
+           common.mustCall(function(err, dirents) {
+             assert.ifError(err);
+             assertDirents(dirents);
+           }));
+
+// Names are still encoded as asked.
+fs.readdir(readdirDir, { withFileTypes: true, encoding: 'buffer' },
+           common.mustCall(function(err, dirents) {
+             assert.ifError(err);
+             for (const dirent of dirents)
+               assert(Buffer.isBuffer(dirent.name));
+             assertDirents(dirents);
+           }));
+
+// Symbolic links are reported as such, not as what they point to.
+if (!common.isWindows) {
+  const linkDir = path.join(readdirDir, 'a-dir');
+  fs.symlinkSync('..', path.join(linkDir, 'link'));
+  const link = fs.readdirSync(linkDir, { withFileTypes: true })[0];
+  assert.strictEqual(link.name, 'link');
+  assert.strictEqual(link.isSymbolicLink(), true);
+  assert.strictEqual(link.isDirectory(), false);
+}
+
+assert.throws(function() {
+  fs.readdirSync(__filename, { withFileTypes: true });
+}, /Error: ENOTDIR: not a directory/);
+
+fs.readdir(__filename, { withFileTypes: true }, common.mustCall(function(e) {
+  assert.strictEqual(e.code, 'ENOTDIR');
+}));
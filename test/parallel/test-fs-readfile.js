@@ -0,0 +1,54 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const fs = require('fs');
+const path = require('path');
+
+common.refreshTmpDir();
+
+// Odd length, so the last byte is left over for ucs2.
+const size = 3 * 64 * 1024 + 1;
+const data = Buffer.alloc(size);
+for (let i = 0; i < size; i++)
+  data[i] = i * 7 + (i >> 8);
+
+const filename = path.join(common.tmpDir, 'readfile.bin');
+fs.writeFileSync(filename, data);
+
+fs.readFile(filename, common.mustCall(function(err, buf) {
+  assert.ifError(err);
+  assert.deepStrictEqual(buf, data);
+}));
+
+for (const encoding of ['utf8', 'ucs2', 'latin1', 'ascii', 'hex', 'base64']) {
+  fs.readFile(filename, encoding, common.mustCall(function(err, str) {
+    assert.ifError(err);
+    assert.strictEqual(str, data.toString(encoding));
+  }));
+}
+
+fs.readFile(filename, { encoding: 'buffer' }, common.mustCall(function(err, b) {
+  assert.ifError(err);
+  assert.deepStrictEqual(b, data);
+}));
+
+// A file descriptor is read from its current position and left open.
+{
+  const fd = fs.openSync(filename, 'r');
+  fs.readSync(fd, Buffer.alloc(1000), 0, 1000, null);
+  fs.readFile(fd, common.mustCall(function(err, buf) {
+    assert.ifError(err);
+    assert.deepStrictEqual(buf, data.slice(1000));
+    fs.closeSync(fd);
+  }));
+}
+
+fs.readFile(path.join(common.tmpDir, 'missing'), common.mustCall(function(err) {
+  assert.strictEqual(err.code, 'ENOENT');
+  assert.strictEqual(err.syscall, 'open');
+  assert.strictEqual(err.path, path.join(common.tmpDir, 'missing'));
+}));
+
+fs.readFile(filename, { flag: 'wx' }, common.mustCall(function(err) {
+  assert.strictEqual(err.code, 'EEXIST');
+}));
@@ -0,0 +1,191 @@
+'use strict';
+
+const common = require('../common');
+const assert = require('assert');
+const fs = require('fs');
+const path = require('path');
+
+common.refreshTmpDir();
+
+const root = path.join(common.tmpDir, 'walk');
+const expected = [];
+
+function mkdir(name) {
+  fs.mkdirSync(path.join(root, name));
+  expected.push(name);
+}
+
+function touch(name, data) {
+  fs.writeFileSync(path.join(root, name), data || '');
+  expected.push(name);
+}
+
+fs.mkdirSync(root);
+mkdir('a');
+mkdir(path.join('a', 'b'));
+mkdir(path.join('a', 'b', 'c'));
+touch(path.join('a', 'b', 'c', 'deep'), 'deep');
+touch(path.join('a', 'file'), 'hello');
+mkdir('many');
+// More entries than fit into a single batch.
+for (let i = 0; i < 1500; i++)
+  touch(path.join('many', 'f' + i));
+mkdir('empty');
+expected.sort();
+
+function walk(options, callback) {
+  const entries = [];
+  fs.walk(root, options)
+    .on('data', (entry) => entries.push(entry))
+    .on('end', common.mustCall(() => callback(entries)));
+}
+
+function relative(entries) {
+  return entries.map((entry) => path.relative(root, entry.path)).sort();
+}
+
+walk({}, function(entries) {
+  assert.deepStrictEqual(relative(entries), expected);
+
+  for (const entry of entries) {
+    assert(entry instanceof fs.WalkEntry);
+    assert(entry instanceof fs.Dirent);
+    assert.strictEqual(entry.name, path.basename(entry.path));
+    assert.strictEqual(entry.depth,
+                       path.relative(root, entry.path).split(path.sep).length);
+
+    const stats = fs.lstatSync(entry.path);
+    assert.strictEqual(entry.isDirectory(), stats.isDirectory());
+    assert.strictEqual(entry.isFile(), stats.isFile());
+    assert.strictEqual(entry.mtime.getTime(), stats.mtime.getTime());
+    if (entry.isFile())
+      assert.strictEqual(entry.size, stats.size);
+  }
+});
+
+walk({ maxDepth: 2 }, function(entries) {
+  assert.deepStrictEqual(relative(entries), expected.filter((name) => {
+    return name.split(path.sep).length <= 2;
+  }));
+});
+
+walk({ maxDepth: 0 }, function(entries) {
+  assert.deepStrictEqual(entries, []);
+});
+
+// Directories that are filtered out are not walked either.
+walk({ filter: (entry) => entry.name !== 'many' }, function(entries) {
+  assert.deepStrictEqual(relative(entries), expected.filter((name) => {
+    return name.split(path.sep)[0] !== 'many';
+  }));
+});
+
+if (!common.isWindows) {
+  const linkRoot = path.join(common.tmpDir, 'links');
+  fs.mkdirSync(linkRoot);
+  fs.mkdirSync(path.join(linkRoot, 'dir'));
+  fs.writeFileSync(path.join(linkRoot, 'dir', 'file'), '');
+  fs.symlinkSync('dir', path.join(linkRoot, 'link'));
+  fs.symlinkSync('..', path.join(linkRoot, 'dir', 'parent'));
+  fs.symlinkSync('missing', path.join(linkRoot, 'dangling'));
+
+  const byPath = (options, callback) => {
+    const entries = {};
+    fs.walk(linkRoot, options)
+      .on('data', (entry) => {
+        entries[path.relative(linkRoot, entry.path)] = entry;
+      })
+      .on('end', common.mustCall(() => callback(entries)));
+  };
+
+  byPath({}, function(links) {
+    assert.deepStrictEqual(Object.keys(links).sort(), [
+      'dangling', 'dir', path.join('dir', 'file'), path.join('dir', 'parent'),
+      'link'
+    ]);
+    assert(links.link.isSymbolicLink());
+    assert(links.dangling.isSymbolicLink());
+  });
+
+  // Every directory is walked once, even when links lead back to it.
+  byPath({ followSymlinks: true }, function(followed) {
+    // Only one of 'dir' and 'link' is walked, 'parent' is the root.
+    const walked = ['dir', 'link'].filter((name) => {
+      return followed[path.join(name, 'file')] !== undefined;
+    });
+    assert.strictEqual(walked.length, 1);
+    assert.deepStrictEqual(Object.keys(followed).sort(), [
+      'dangling', 'dir', 'link', path.join(walked[0], 'file'),
+      path.join(walked[0], 'parent')
+    ].sort());
+    assert(followed.link.isDirectory());
+    assert(followed[path.join(walked[0], 'parent')].isDirectory());
+    assert(followed.dangling.isSymbolicLink());
+  });
+}
+
+// Paths and names as Buffers, from a Buffer root.
+fs.walk(Buffer.from(root), 'buffer')
+  .on('data', common.mustCall((entry) => {
+    assert(Buffer.isBuffer(entry.path));
+    assert(Buffer.isBuffer(entry.name));
+  }, expected.length))
+  .on('end', common.mustCall(() => {}));
+
+if (common.isLinux) {
+  // Names that aren't valid UTF-8 are walked into all the same.
+  const binRoot = path.join(common.tmpDir, 'binary');
+  const dir = Buffer.concat([Buffer.from(binRoot + '/'),
+                             Buffer.from([0x66, 0xff])]);
+  fs.mkdirSync(binRoot);
+  fs.mkdirSync(dir);
+  fs.writeFileSync(Buffer.concat([dir, Buffer.from('/file')]), '');
+
+  const found = [];
+  fs.walk(binRoot)
+    .on('data', (entry) => found.push(entry.name))
+    .on('end', common.mustCall(() => {
+      assert.deepStrictEqual(found, ['f\ufffd', 'file']);
+    }));
+
+  fs.walk(binRoot, { encoding: 'buffer' })
+    .on('data', common.mustCall((entry) => {
+      assert.doesNotThrow(() => fs.lstatSync(entry.path));
+    }, 2))
+    .on('end', common.mustCall(() => {}));
+}
+
+// Directories that can't be read are reported, the walk goes on.
+if (!common.isWindows && process.getuid() !== 0) {
+  const lockedRoot = path.join(common.tmpDir, 'locked');
+  fs.mkdirSync(lockedRoot);
+  fs.mkdirSync(path.join(lockedRoot, 'locked'));
+  fs.mkdirSync(path.join(lockedRoot, 'open'));
+  fs.writeFileSync(path.join(lockedRoot, 'open', 'file'), '');
+  fs.chmodSync(path.join(lockedRoot, 'locked'), 0);
+
+  const found = [];
+  fs.walk(lockedRoot, {
+    onError: common.mustCall((err) => {
+      assert.strictEqual(err.code, 'EACCES');
+      assert.strictEqual(err.syscall, 'scandir');
+      assert.strictEqual(err.path, path.join(lockedRoot, 'locked'));
+    })
+  }).on('data', (entry) => found.push(path.relative(lockedRoot, entry.path)))
+    .on('end', common.mustCall(() => {
+      fs.chmodSync(path.join(lockedRoot, 'locked'), 0o755);
+      assert.deepStrictEqual(found.sort(),
+                             ['locked', 'open', path.join('open', 'file')]);
+    }));
+}
+
+fs.walk(path.join(common.tmpDir, 'missing'))
+  .on('data', common.fail)
+  .on('error', common.mustCall(function(err) {
+    assert.strictEqual(err.code, 'ENOENT');
+    assert.strictEqual(err.syscall, 'scandir');
+  }));
+
+assert.throws(() => fs.walk(root, { filter: true }), TypeError);
+assert.throws(() => fs.walk(root, { onError: true }), TypeError);
+assert.throws(() => fs.walk(root, { maxDepth: -1 }), TypeError);
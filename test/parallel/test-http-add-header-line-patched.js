@@ -0,0 +1,29 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const http = require('http');
+
+// Headers skip IncomingMessage#_addHeaderLine() only as long as it is the
+// stock one, replacements still get to see every header line.
+const original = http.IncomingMessage.prototype._addHeaderLine;
+const seen = [];
+http.IncomingMessage.prototype._addHeaderLine = function(field, value, dest) {
+  seen.push(field.toLowerCase());
+  original.call(this, field, value, dest);
+};
+
+const server = http.createServer(common.mustCall((req, res) => {
+  assert.strictEqual(req.headers['x-foo'], 'bar');
+  assert(seen.includes('x-foo'));
+  res.end();
+}));
+
+server.listen(0, common.mustCall(() => {
+  http.get({
+    port: server.address().port,
+    headers: { 'X-Foo': 'bar' }
+  }, common.mustCall((res) => {
+    res.resume();
+    res.on('end', common.mustCall(() => server.close()));
+  }));
+}));
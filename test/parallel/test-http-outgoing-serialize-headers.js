@@ -0,0 +1,132 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const http = require('http');
+const net = require('net');
+const binding = process.binding('http_parser');
+
+const firstLine = 'HTTP/1.1 200 OK\r\n';
+
+function serialize(fields) {
+  const state = { messageHeader: firstLine };
+  const flags = binding.serializeHeaders(state, fields);
+  return { flags: flags, header: state.messageHeader };
+}
+
+{
+  const result = serialize(['Content-Type', 'text/plain',
+                            'content-length', 42,
+                            'X-Latin1', 'déjà vu\tok']);
+  assert.strictEqual(result.header,
+                     firstLine +
+                     'Content-Type: text/plain\r\n' +
+                     'content-length: 42\r\n' +
+                     'X-Latin1: déjà vu\tok\r\n');
+  assert.strictEqual(result.flags, binding.kSentContentLengthHeader);
+}
+
+{
+  const result = serialize([]);
+  assert.strictEqual(result.header, firstLine);
+  assert.strictEqual(result.flags, 0);
+}
+
+// The flags match what storeHeader() in lib/_http_outgoing.js looks for.
+[
+  [['Connection', 'close'],
+   binding.kSentConnectionHeader | binding.kConnectionClose],
+  [['CONNECTION', 'Keep-Alive'],
+   binding.kSentConnectionHeader | binding.kConnectionKeepAlive],
+  [['connection', 'Upgrade, Close'],
+   binding.kSentConnectionHeader | binding.kConnectionClose |
+   binding.kConnectionUpgrade],
+  [['Connection', 'closed', 'Connection', 'xupgrade'],
+   binding.kSentConnectionHeader | binding.kConnectionKeepAlive],
+  [['Transfer-Encoding', 'gzip, CHUNKED'],
+   binding.kSentTransferEncodingHeader | binding.kChunkedEncoding],
+  [['transfer-encoding', 'gzip'], binding.kSentTransferEncodingHeader],
+  [['Date', 'now', 'Expect', '100-continue', 'Trailer', 'X-Foo',
+    'Upgrade', 'websocket'],
+   binding.kSentDateHeader | binding.kSentExpect | binding.kSentTrailer |
+   binding.kSentUpgrade],
+  [['Dates', 'now', 'Content-Lengths', '1'], 0]
+].forEach(function(test) {
+  assert.strictEqual(serialize(test[0]).flags, test[1], test[0].join());
+});
+
+// Anything else is left to lib/_http_outgoing.js without touching the state.
+[
+  ['', 'empty'],
+  ['Bad Name', 'value'],
+  ['Bad:Name', 'value'],
+  ['Bäd', 'value'],
+  ['X-Foo', 'bad\r\nvalue'],
+  ['X-Foo', 'bad\u0000value'],
+  ['X-Foo', 'bad\u007fvalue'],
+  ['X-Foo', 'badĀvalue'],
+  ['X-Foo', true],
+  ['X-Foo', undefined],
+  [1, 'value']
+].forEach(function(fields) {
+  const state = { messageHeader: firstLine };
+  assert.strictEqual(binding.serializeHeaders(state, fields), -1);
+  assert.strictEqual(state.messageHeader, firstLine);
+});
+
+// The errors stay the same.
+assert.throws(function() {
+  const res = new http.ServerResponse({ method: 'GET', httpVersionMajor: 1,
+                                        httpVersionMinor: 1 });
+  res.writeHead(200, { 'X-Foo': 'bar', 'Bad Name': 'value' });
+}, /^TypeError: Header name must be a valid HTTP Token \["Bad Name"]$/);
+
+assert.throws(function() {
+  const res = new http.ServerResponse({ method: 'GET', httpVersionMajor: 1,
+                                        httpVersionMinor: 1 });
+  res.writeHead(200, { 'X-Foo': ['bar', 'bĀz'] });
+}, /^TypeError: The header content contains invalid characters$/);
+
+// The headers go out together with the first body chunk, and values that
+// are not strings or numbers still work.
+const server = http.createServer(common.mustCall(function(req, res) {
+  const writes = [];
+  const socket = res.connection;
+  const writev = socket._writev;
+  socket._writev = function(chunks, cb) {
+    writes.push(chunks.length);
+    return writev.apply(this, arguments);
+  };
+  const write = socket._write;
+  socket._write = function(data, encoding, cb) {
+    writes.push(1);
+    return write.apply(this, arguments);
+  };
+
+  res.writeHead(200, [['X-Array', 'a'], ['X-Array', 'b'],
+                      ['X-Bool', true], ['Content-Length', 5],
+                      ['Connection', 'close']]);
+  res.write(Buffer.from('hello'), common.mustCall(function() {
+    assert.deepStrictEqual(writes, [2]);
+    res.end();
+  }));
+}));
+
+server.listen(0, common.mustCall(function() {
+  const socket = net.connect(this.address().port, function() {
+    socket.write('GET / HTTP/1.1\r\nHost: localhost\r\n\r\n');
+  });
+  let response = '';
+  socket.setEncoding('latin1');
+  socket.on('data', function(data) {
+    response += data;
+  });
+  socket.on('end', common.mustCall(function() {
+    assert(/^HTTP\/1\.1 200 OK\r\n/.test(response), response);
+    assert(response.includes('\r\nX-Array: a\r\nX-Array: b\r\n' +
+                             'X-Bool: true\r\nContent-Length: 5\r\n' +
+                             'Connection: close\r\n'),
+           response);
+    assert(response.endsWith('\r\n\r\nhello'), response);
+    server.close();
+  }));
+}));
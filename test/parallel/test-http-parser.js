@@ -568,6 +568,96 @@ function expectBody(expected) {
   parser.execute(req2, 0, req2.length);
 }
 
+//
+// Test the headers object that the binding builds.
+//
+{
+  const request = Buffer.from(
+      'GET / HTTP/1.1' + CRLF +
+      'Host: a' + CRLF +
+      'HOST: b' + CRLF +
+      'X-Foo: 1' + CRLF +
+      'x-foo: 2' + CRLF +
+      'Set-Cookie: c=1' + CRLF +
+      'set-cookie: c=2' + CRLF +
+      'Accept: */*' + CRLF +
+      CRLF);
+
+  const onHeadersComplete = function(versionMajor, versionMinor, headers,
+                                     method, url, statusCode, statusMessage,
+                                     upgrade, shouldKeepAlive, parsedHeaders) {
+    assert.deepStrictEqual(parsedHeaders, {
+      host: 'a',
+      'x-foo': '1, 2',
+      'set-cookie': ['c=1', 'c=2'],
+      accept: '*/*'
+    });
+    assert.deepStrictEqual(Object.keys(parsedHeaders),
+                           ['host', 'x-foo', 'set-cookie', 'accept']);
+    assert.strictEqual(headers.length, 14);
+  };
+
+  const parser = newParser(REQUEST);
+  parser[kOnHeadersComplete] = mustCall(onHeadersComplete);
+  parser.execute(request, 0, request.length);
+}
+
+{
+  // Known names keep their spelling in the raw list, whichever it is.
+  const request = Buffer.from(
+      'GET / HTTP/1.1' + CRLF +
+      'Content-Type: a' + CRLF +
+      'content-length: 0' + CRLF +
+      'USER-AGENT: b' + CRLF +
+      'Accept-encoding: c' + CRLF +
+      'X-Unknown: d' + CRLF +
+      CRLF);
+
+  const onHeadersComplete = function(versionMajor, versionMinor, headers,
+                                     method, url, statusCode, statusMessage,
+                                     upgrade, shouldKeepAlive, parsedHeaders) {
+    assert.strictEqual(methods[method], 'GET');
+    assert.deepStrictEqual(headers, [
+      'Content-Type', 'a', 'content-length', '0', 'USER-AGENT', 'b',
+      'Accept-encoding', 'c', 'X-Unknown', 'd'
+    ]);
+    assert.deepStrictEqual(parsedHeaders, {
+      'content-type': 'a',
+      'content-length': '0',
+      'user-agent': 'b',
+      'accept-encoding': 'c',
+      'x-unknown': 'd'
+    });
+  };
+
+  const parser = newParser(REQUEST);
+  parser[kOnHeadersComplete] = mustCall(onHeadersComplete);
+  parser.execute(request, 0, request.length);
+}
+
+{
+  // Left to JS land when the headers had to be flushed early, or when a
+  // name would not become an own property.
+  const many = [];
+  for (let i = 0; i < 40; i++)
+    many.push('X-Header-' + i + ': ' + i + CRLF);
+
+  for (const lines of [many.join(''), '__proto__: x' + CRLF]) {
+    const request = Buffer.from('GET / HTTP/1.1' + CRLF + lines + CRLF);
+
+    const onHeadersComplete = function(versionMajor, versionMinor, headers,
+                                       method, url, statusCode, statusMessage,
+                                       upgrade, shouldKeepAlive,
+                                       parsedHeaders) {
+      assert.strictEqual(parsedHeaders, undefined);
+    };
+
+    const parser = newParser(REQUEST);
+    parser[kOnHeadersComplete] = mustCall(onHeadersComplete);
+    parser.execute(request, 0, request.length);
+  }
+}
+
 // Test parser 'this' safety
 // https://github.com/joyent/node/issues/6690
 assert.throws(function() {
@@ -0,0 +1,54 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const execFile = require('child_process').execFile;
+const fs = require('fs');
+const path = require('path');
+
+// Modules compiled with NODE_COMPILE_CACHE set store their code cache on disk
+// and later runs consume it.
+common.refreshTmpDir();
+const cacheDir = path.join(common.tmpDir, 'compile-cache');
+const script = path.join(common.tmpDir, 'compile-cache-script.js');
+fs.writeFileSync(script, 'console.log(require("path").sep.length + 41);');
+
+const env = Object.assign({}, process.env, {
+  NODE_COMPILE_CACHE: cacheDir,
+  NODE_DEBUG: 'module'
+});
+
+function run(callback) {
+  execFile(process.execPath, [script], { env }, common.mustCall(
+    (err, stdout, stderr) => {
+      assert.ifError(err);
+      assert.strictEqual(stdout, '42\n');
+      callback(stderr);
+    }));
+}
+
+run((stderr) => {
+  assert(!/compile cache hit/.test(stderr));
+  assert.strictEqual(fs.readdirSync(cacheDir).length, 1);
+
+  run((stderr) => {
+    assert(stderr.includes(`compile cache hit ${script}`));
+
+    // A modified file invalidates the entry.
+    fs.writeFileSync(script, 'console.log(42);');
+    run((stderr) => {
+      assert(!/compile cache hit/.test(stderr));
+      assert.strictEqual(fs.readdirSync(cacheDir).length, 1);
+
+      // So does one that keeps its size and mtime.
+      const stats = fs.statSync(script);
+      fs.writeFileSync(script, 'console.log(24);');
+      fs.utimesSync(script, stats.atime, stats.mtime);
+      execFile(process.execPath, [script], { env }, common.mustCall(
+        (err, stdout, stderr) => {
+          assert.ifError(err);
+          assert.strictEqual(stdout, '24\n');
+          assert(!/compile cache hit/.test(stderr));
+        }));
+    });
+  });
+});
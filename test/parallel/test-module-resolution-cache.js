@@ -0,0 +1,55 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const execFile = require('child_process').execFile;
+const fs = require('fs');
+const path = require('path');
+
+// With NODE_RESOLUTION_CACHE set, resolutions are saved to the manifest on
+// exit and reused by later runs as long as the resolved file still exists.
+common.refreshTmpDir();
+const tmpDir = fs.realpathSync(common.tmpDir);
+const manifest = path.join(tmpDir, 'resolutions.json');
+const script = path.join(tmpDir, 'resolution-cache-script.js');
+const dep = path.join(tmpDir, 'node_modules', 'dep', 'index.js');
+fs.mkdirSync(path.join(tmpDir, 'node_modules'));
+fs.mkdirSync(path.dirname(dep));
+fs.writeFileSync(dep, 'module.exports = 42;');
+fs.writeFileSync(script, 'console.log(require("dep"));');
+
+const env = Object.assign({}, process.env, {
+  NODE_RESOLUTION_CACHE: manifest,
+  NODE_DEBUG: 'module'
+});
+
+function run(callback) {
+  execFile(process.execPath, [script], { env }, common.mustCall(
+    (err, stdout, stderr) => {
+      assert.ifError(err);
+      callback(stdout, stderr);
+    }));
+}
+
+run((stdout, stderr) => {
+  assert.strictEqual(stdout, '42\n');
+  assert(!stderr.includes(`resolution cache hit ${dep}`));
+  const entries = JSON.parse(fs.readFileSync(manifest, 'utf8')).entries;
+  assert(Object.keys(entries).some((key) => entries[key] === dep));
+
+  run((stdout, stderr) => {
+    assert.strictEqual(stdout, '42\n');
+    assert(stderr.includes(`resolution cache hit ${dep}`));
+
+    // Stale entries are dropped and resolved again.
+    const moved = path.join(path.dirname(dep), 'main.js');
+    fs.renameSync(dep, moved);
+    fs.writeFileSync(path.join(path.dirname(dep), 'package.json'),
+                     '{"main": "main.js"}');
+    run((stdout, stderr) => {
+      assert.strictEqual(stdout, '42\n');
+      assert(!stderr.includes(`resolution cache hit ${dep}`));
+      const entries = JSON.parse(fs.readFileSync(manifest, 'utf8')).entries;
+      assert(Object.keys(entries).some((key) => entries[key] === moved));
+    });
+  });
+});
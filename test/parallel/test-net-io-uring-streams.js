@@ -0,0 +1,58 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const net = require('net');
+const spawn = require('child_process').spawn;
+
+// Runs the echo below again with TCP reads going through io_uring, libuv
+// falls back to polling where the kernel doesn't support that.
+if (process.argv[2] !== 'child') {
+  const env = Object.assign({}, process.env, { UV_IO_URING_STREAMS: '1' });
+  const child = spawn(process.execPath, [__filename, 'child'],
+                      { env: env, stdio: 'inherit' });
+  child.on('exit', common.mustCall(function(code, signal) {
+    assert.strictEqual(code, 0);
+    assert.strictEqual(signal, null);
+  }));
+}
+
+const size = 1024 * 1024;
+const data = Buffer.alloc(size);
+for (let i = 0; i < size; i++)
+  data[i] = i * 7 + (i >> 8);
+
+const server = net.createServer(common.mustCall(function(socket) {
+  socket.pipe(socket);
+}, 4));
+
+server.listen(0, common.mustCall(function() {
+  let pending = 4;
+  for (let i = 0; i < 4; i++) {
+    const client = net.connect(this.address().port);
+    const chunks = [];
+    let received = 0;
+
+    client.on('data', function(chunk) {
+      chunks.push(chunk);
+      received += chunk.length;
+
+      // Stop and restart reading while data keeps arriving.
+      if (chunks.length % 10 === 0) {
+        client.pause();
+        setImmediate(() => client.resume());
+      }
+
+      if (received === size)
+        client.end();
+    });
+
+    client.on('end', common.mustCall(function() {
+      assert.deepStrictEqual(Buffer.concat(chunks), data);
+      if (--pending === 0)
+        server.close();
+    }));
+
+    for (let offset = 0; offset < size; offset += 4096)
+      client.write(data.slice(offset, offset + 4096));
+  }
+}));
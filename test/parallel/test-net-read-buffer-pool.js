@@ -0,0 +1,65 @@
+// Flags: --expose-gc
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const net = require('net');
+
+// Reads on stream handles are served from fixed-size chunks that are recycled
+// once the Buffer emitted for a read has been collected.  Each Buffer is
+// backed by a chunk of its own and covers only the bytes that were read.
+const getStats = process.binding('stream_wrap').getReadBufferPoolStats;
+const kChunkSize = 64 * 1024;
+
+const payload = Buffer.alloc(256 * 1024, 'abc');
+
+const server = net.createServer((socket) => {
+  socket.end(payload);
+});
+
+function receive(callback) {
+  const chunks = [];
+  const client = net.connect(server.address().port);
+
+  client.on('data', (chunk) => {
+    assert(Buffer.isBuffer(chunk));
+    assert(chunk.length > 0);
+    assert.strictEqual(chunk.byteOffset, 0);
+    assert.strictEqual(chunk.buffer.byteLength, chunk.length);
+    chunks.push(chunk);
+  });
+
+  client.on('end', common.mustCall(() => {
+    assert.deepStrictEqual(Buffer.concat(chunks), payload);
+    callback(chunks);
+  }));
+}
+
+server.listen(0, common.mustCall(() => {
+  const before = getStats();
+
+  receive(common.mustCall((chunks) => {
+    // Every chunk that is still referenced from JS land is pinned.
+    const pinned = getStats();
+    assert.strictEqual(pinned.bytesPinned - before.bytesPinned,
+                       chunks.length * kChunkSize);
+    assert(pinned.misses > before.misses);
+
+    for (let i = 1; i < chunks.length; i++)
+      assert.notStrictEqual(chunks[i].buffer, chunks[i - 1].buffer);
+
+    // Dropping the Buffers puts their chunks back on the free list.
+    chunks.length = 0;
+    setImmediate(common.mustCall(() => {
+      global.gc();
+      const released = getStats();
+      assert.strictEqual(released.bytesPinned, before.bytesPinned);
+
+      // The next reads are served from the recycled chunks.
+      receive(common.mustCall(() => {
+        const after = getStats();
+        assert(after.hits > released.hits);
+        server.close();
+      }));
+    }));
+  }));
+}));
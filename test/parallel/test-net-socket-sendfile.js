@@ -0,0 +1,57 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const fs = require('fs');
+const net = require('net');
+const path = require('path');
+
+// Files sent with socket.sendFile() are ordered with respect to the writes
+// around them and count towards backpressure like a write of that size.
+const file = path.join(common.fixturesDir, 'person.jpg');
+const contents = fs.readFileSync(file);
+const fd = fs.openSync(file, 'r');
+const offset = 100;
+const length = contents.length - 200;
+
+const server = net.createServer(common.mustCall((socket) => {
+  assert.throws(() => socket.sendFile(-1, 0, 1), TypeError);
+  assert.throws(() => socket.sendFile(fd, -1, 1), TypeError);
+  assert.throws(() => socket.sendFile(fd, 0, 1.5), TypeError);
+
+  socket.write('head');
+  const ret = socket.sendFile(fd, offset, length, common.mustCall(() => {
+    // Ranges past the end of the file are cut short.
+    socket.sendFile(fd, contents.length - 4, 100);
+    socket.end('tail');
+
+    // Files sent after end() are not accounted for.
+    const queued = socket._writableState.length;
+    socket.once('error', common.mustCall(() => {}));
+    socket.sendFile(fd, 0, length, common.mustCall((err) => {
+      assert(err instanceof Error);
+    }));
+    assert.strictEqual(socket._writableState.length, queued);
+  }));
+  assert.strictEqual(ret, length < socket._writableState.highWaterMark);
+  assert(socket.bufferSize >= length);
+  // Written while the file is still queued.
+  socket.write('middle');
+}));
+
+server.listen(0, common.mustCall(() => {
+  const chunks = [];
+  const client = net.connect(server.address().port);
+  client.on('data', (chunk) => chunks.push(chunk));
+  client.on('end', common.mustCall(() => {
+    const expected = Buffer.concat([
+      Buffer.from('head'),
+      contents.slice(offset, offset + length),
+      Buffer.from('middle'),
+      contents.slice(contents.length - 4),
+      Buffer.from('tail')
+    ]);
+    assert.deepStrictEqual(Buffer.concat(chunks), expected);
+    fs.closeSync(fd);
+    server.close();
+  }));
+}));
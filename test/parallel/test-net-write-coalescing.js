@@ -0,0 +1,98 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const net = require('net');
+
+// Records which handle methods the writes of a socket go through.
+function spy(socket) {
+  const calls = [];
+  const handle = socket._handle;
+  const writev = handle.writev;
+  handle.writev = function(req, chunks) {
+    calls.push('writev:' + chunks.length / 2);
+    return writev.apply(this, arguments);
+  };
+  const writeUtf8String = handle.writeUtf8String;
+  handle.writeUtf8String = function(req, data) {
+    calls.push('write');
+    return writeUtf8String.apply(this, arguments);
+  };
+  return calls;
+}
+
+function test(setup, check) {
+  const server = net.createServer(common.mustCall(function(socket) {
+    let received = '';
+    socket.setEncoding('utf8');
+    socket.on('data', function(data) {
+      received += data;
+    });
+    socket.on('end', common.mustCall(function() {
+      assert.strictEqual(received, 'abcd');
+      server.close();
+    }));
+  }));
+
+  server.listen(0, common.mustCall(function() {
+    const client = net.connect(this.address().port, common.mustCall(() => {
+      setup(client);
+      const calls = spy(client);
+      const order = [];
+      for (const data of ['a', 'b', 'c', 'd'])
+        client.write(data, common.mustCall(() => order.push(data)));
+      setImmediate(common.mustCall(function() {
+        assert.deepStrictEqual(order, ['a', 'b', 'c', 'd']);
+        check(calls);
+        client.end();
+      }));
+    }));
+  }));
+}
+
+// The first write goes straight to the handle, the rest of the tick's writes
+// are passed to it together.
+test(function(client) {}, function(calls) {
+  assert.deepStrictEqual(calls, ['write', 'writev:3']);
+});
+
+test(function(client) {
+  client.setWriteCoalescing(false);
+}, function(calls) {
+  assert.deepStrictEqual(calls, ['write', 'write', 'write', 'write']);
+});
+
+// Writes are flushed as soon as they reach maxBytes.
+test(function(client) {
+  client.setWriteCoalescing(true, 2);
+}, function(calls) {
+  assert.deepStrictEqual(calls, ['write', 'writev:2', 'write']);
+});
+
+// Writes that are held back still go out when the socket is destroyed in the
+// same tick.
+{
+  const server = net.createServer(common.mustCall(function(socket) {
+    let received = '';
+    socket.setEncoding('utf8');
+    socket.on('data', function(data) {
+      received += data;
+    });
+    socket.on('end', common.mustCall(function() {
+      assert.strictEqual(received, 'xyz');
+      server.close();
+    }));
+  }));
+
+  server.listen(0, common.mustCall(function() {
+    const client = net.connect(this.address().port, common.mustCall(() => {
+      client.write('x');
+      client.write('y');
+      client.write('z');
+      client.destroy();
+    }));
+  }));
+}
+
+assert.throws(function() {
+  new net.Socket().setWriteCoalescing(true, -1);
+}, /^TypeError: "maxBytes" argument must be a non-negative number$/);
@@ -0,0 +1,85 @@
+'use strict';
+const common = require('../common');
+if (!common.hasCrypto) {
+  common.skip('missing crypto');
+  return;
+}
+
+const assert = require('assert');
+const fs = require('fs');
+const tls = require('tls');
+
+// Small buffers of a writev are gathered into shared TLS records, and the
+// connection's buffers are released and allocated again between bursts.
+// Check that the data makes it through intact either way.
+
+const options = {
+  key: fs.readFileSync(common.fixturesDir + '/keys/agent1-key.pem'),
+  cert: fs.readFileSync(common.fixturesDir + '/keys/agent1-cert.pem')
+};
+
+function chunk(length, seed) {
+  const buf = Buffer.allocUnsafe(length);
+  for (let i = 0; i < length; i++)
+    buf[i] = (i * 31 + seed) & 0xff;
+  return buf;
+}
+
+const bursts = [
+  // Many small buffers.
+  Array.from({ length: 500 }, (_, i) => chunk(1 + i % 37, i)),
+  // Buffers that just fit into a record together, and ones that do not.
+  [chunk(8192, 1), chunk(8192, 2), chunk(8191, 3), chunk(8194, 4)],
+  // Large buffers between small ones.
+  [chunk(10, 5), chunk(100000, 6), chunk(10, 7), chunk(16384, 8),
+   chunk(20, 9), chunk(0, 10), chunk(16385, 11)]
+];
+
+const server = tls.createServer(options, common.mustCall(function(socket) {
+  let index = 0;
+  let expected = Buffer.concat(bursts[index]);
+  let received = [];
+  let length = 0;
+  socket.on('data', function(data) {
+    received.push(data);
+    length += data.length;
+    if (length < expected.length)
+      return;
+    assert.strictEqual(length, expected.length);
+    assert(Buffer.concat(received).equals(expected), 'burst ' + index);
+    // Acknowledge the burst, the next one starts after the connection has
+    // been idle.
+    socket.write('ok');
+    received = [];
+    length = 0;
+    if (++index < bursts.length)
+      expected = Buffer.concat(bursts[index]);
+    else
+      socket.end();
+  });
+}));
+
+server.listen(0, common.mustCall(function() {
+  const client = tls.connect({
+    port: this.address().port,
+    rejectUnauthorized: false
+  }, common.mustCall(function() {
+    let index = 0;
+    send();
+    client.on('data', function(data) {
+      assert.strictEqual(data.toString(), 'ok');
+      if (++index < bursts.length)
+        setTimeout(send, 10);
+    });
+
+    function send() {
+      client.cork();
+      for (const buf of bursts[index])
+        client.write(buf);
+      client.uncork();
+    }
+  }));
+  client.on('end', common.mustCall(function() {
+    server.close();
+  }));
+}));
@@ -0,0 +1,45 @@
+'use strict';
+require('../common');
+const assert = require('assert');
+const spawnSync = require('child_process').spawnSync;
+
+// Rarely used core modules are not loaded by a trivial script.
+const script = 'console.log(JSON.stringify(process.moduleLoadList))';
+const plain = spawnSync(process.execPath, ['-e', script]);
+assert.strictEqual(plain.status, 0);
+assert.strictEqual(plain.stderr.toString(), '');
+const loaded = JSON.parse(plain.stdout);
+for (const id of ['repl', 'readline', '_debugger', 'punycode'])
+  assert(!loaded.includes(`NativeModule ${id}`), `${id} should be lazy`);
+
+// --trace-native-module-load reports every core module that is compiled.
+const traced = spawnSync(process.execPath,
+                         ['--trace-native-module-load', '-e', script]);
+assert.strictEqual(traced.status, 0);
+const lines = traced.stderr.toString().trim().split('\n');
+const re = /^native module (\S+): (snapshot|code cache|source.*), [\d.]+ ms$/;
+const ids = lines.map((line) => {
+  const match = re.exec(line);
+  assert(match, `unexpected trace line: ${line}`);
+  return match[1];
+});
+const expected = JSON.parse(traced.stdout)
+  .filter((entry) => entry.startsWith('NativeModule '))
+  .map((entry) => entry.slice('NativeModule '.length));
+// console.log() loads the stdout related modules after the list was taken.
+for (const id of expected)
+  assert(ids.includes(id), `${id} was not traced`);
+assert.strictEqual(new Set(ids).size, ids.length);
+
+// The code caches are only present when node was configured with them. Each
+// call returns a copy of its own.
+const getCodeCache = process.binding('code_cache').getCodeCache;
+for (const id of ids) {
+  const cache = getCodeCache(id);
+  if (cache === undefined)
+    continue;
+  assert(cache instanceof Uint8Array);
+  assert(cache.length > 0);
+  assert.notStrictEqual(getCodeCache(id).buffer, cache.buffer);
+}
+assert.strictEqual(getCodeCache('no such module'), undefined);
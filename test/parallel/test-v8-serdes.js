@@ -0,0 +1,149 @@
+'use strict';
+
+require('../common');
+const assert = require('assert');
+const v8 = require('v8');
+
+const objects = [
+  { foo: 'bar' },
+  { bar: 'baz' },
+  new Uint8Array([1, 2, 3, 4]),
+  new Uint32Array([1, 2, 3, 4]),
+  Buffer.from([1, 2, 3, 4]),
+  undefined,
+  null,
+  42,
+  NaN,
+  -Infinity,
+  'aሴb',
+  [1, [2, 3]],
+  new Date(1e12),
+  /ab+c/gi
+];
+
+const hostObject = new (process.binding('tcp_wrap').TCP)();
+
+// Round trips through the shortcuts and through the classes.
+for (const obj of objects) {
+  assert.deepStrictEqual(v8.deserialize(v8.serialize(obj)), obj);
+
+  const ser = new v8.DefaultSerializer();
+  ser.writeHeader();
+  ser.writeValue(obj);
+  const des = new v8.DefaultDeserializer(ser.releaseBuffer());
+  des.readHeader();
+  assert.deepStrictEqual(des.readValue(), obj);
+}
+
+{
+  // Both ways produce the same data.
+  const ser = new v8.Serializer();
+  ser.writeHeader();
+  ser.writeValue(objects);
+  assert.deepStrictEqual(ser.releaseBuffer(), v8.serialize(objects));
+}
+
+{
+  // Buffers come back as Buffers and only the bytes they cover are written,
+  // not the pool behind them.
+  const buf = Buffer.from('hello');
+  const copy = v8.deserialize(v8.serialize(buf));
+  assert.ok(copy instanceof Buffer);
+  assert.strictEqual(copy.toString(), 'hello');
+  assert.ok(v8.serialize(buf).length < 32);
+}
+
+{
+  // assert does not look into Maps and Sets.
+  const map = v8.deserialize(v8.serialize(new Map([['a', 1], [2, [3]]])));
+  assert.deepStrictEqual(Array.from(map), [['a', 1], [2, [3]]]);
+  const set = v8.deserialize(v8.serialize(new Set([1, 'two'])));
+  assert.deepStrictEqual(Array.from(set), [1, 'two']);
+}
+
+{
+  // Identity and cycles are preserved.
+  const shared = { x: 1 };
+  const obj = { a: shared, b: shared };
+  obj.self = obj;
+  const copy = v8.deserialize(v8.serialize(obj));
+  assert.strictEqual(copy.a, copy.b);
+  assert.strictEqual(copy.self, copy);
+}
+
+{
+  // Raw data around the values.
+  const ser = new v8.Serializer();
+  ser.writeHeader();
+  ser.writeUint32(42);
+  ser.writeValue('value');
+  ser.writeUint64(0xffffffff, 7);
+  ser.writeDouble(-0.5);
+  ser.writeRawBytes(Buffer.from('raw'));
+
+  const des = new v8.Deserializer(ser.releaseBuffer());
+  assert.strictEqual(des.readHeader(), true);
+  assert.strictEqual(des.getWireFormatVersion(), 1);
+  assert.strictEqual(des.readUint32(), 42);
+  assert.strictEqual(des.readValue(), 'value');
+  assert.deepStrictEqual(des.readUint64(), [0xffffffff, 7]);
+  assert.strictEqual(des.readDouble(), -0.5);
+  assert.strictEqual(des.readRawBytes(3).toString(), 'raw');
+  assert.throws(() => des.readUint32(), /^Error: Unable to deserialize/);
+}
+
+{
+  // Host objects are left to subclasses.
+  class HostSerializer extends v8.Serializer {
+    _writeHostObject(object) {
+      assert.strictEqual(object, hostObject);
+      this.writeUint32(7);
+      this.writeValue({ nested: true });
+    }
+  }
+
+  class HostDeserializer extends v8.Deserializer {
+    _readHostObject() {
+      return { id: this.readUint32(), extra: this.readValue() };
+    }
+  }
+
+  const ser = new HostSerializer();
+  ser.writeHeader();
+  ser.writeValue({ a: hostObject, b: hostObject, c: [1] });
+
+  const des = new HostDeserializer(ser.releaseBuffer());
+  des.readHeader();
+  const copy = des.readValue();
+  assert.deepStrictEqual(copy.a, { id: 7, extra: { nested: true } });
+  assert.strictEqual(copy.a, copy.b);
+  assert.deepStrictEqual(copy.c, [1]);
+}
+
+{
+  // Errors thrown by the host object methods are passed on.
+  class ThrowingSerializer extends v8.Serializer {
+    _writeHostObject() {
+      throw new Error('nope');
+    }
+  }
+  const ser = new ThrowingSerializer();
+  assert.throws(() => ser.writeValue(hostObject), /^Error: nope$/);
+}
+
+assert.throws(() => v8.serialize(hostObject),
+              /^TypeError: Object could not be cloned\.$/);
+assert.throws(() => new v8.DefaultSerializer().writeValue(hostObject),
+              /^TypeError: Object could not be cloned\.$/);
+assert.throws(() => v8.serialize({ fn: function() {} }),
+              /^TypeError: Functions could not be cloned\.$/);
+assert.throws(() => v8.deserialize('not a buffer'),
+              /^TypeError: "buffer" argument must be a Buffer or Uint8Array$/);
+assert.throws(() => v8.deserialize(Buffer.from('garbage')),
+              /^Error: Unable to deserialize cloned data due to invalid/);
+assert.throws(() => v8.Serializer(), TypeError);
+assert.throws(() => new v8.Deserializer({}), TypeError);
+assert.ok(new v8.DefaultSerializer() instanceof v8.Serializer);
+assert.ok(new v8.DefaultDeserializer(Buffer.alloc(0)) instanceof
+          v8.Deserializer);
+hostObject.close();
@@ -0,0 +1,18 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const Worker = require('worker_threads').Worker;
+
+const code = `
+  const { parentPort, workerData } = require('worker_threads');
+  parentPort.postMessage(workerData.map((n) => n * 2));
+  process.on('exit', (code) => parentPort.postMessage(code));
+`;
+
+const w = new Worker(code, { eval: true, workerData: [1, 2, 3] });
+const messages = [];
+w.on('message', (message) => messages.push(message));
+w.on('exit', common.mustCall((code) => {
+  assert.strictEqual(code, 0);
+  assert.deepStrictEqual(messages, [[2, 4, 6], 0]);
+}));
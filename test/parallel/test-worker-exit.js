@@ -0,0 +1,47 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const Worker = require('worker_threads').Worker;
+
+// process.exit() ends the worker, not the process.
+new Worker('process.exit(42)', { eval: true })
+  .on('exit', common.mustCall((code) => {
+    assert.strictEqual(code, 42);
+  }));
+
+// Uncaught exceptions are emitted as 'error' on the Worker object.
+new Worker('throw new RangeError("boom")', { eval: true })
+  .on('error', common.mustCall((err) => {
+    assert(err instanceof RangeError);
+    assert.strictEqual(err.message, 'boom');
+  }))
+  .on('exit', common.mustCall((code) => {
+    assert.strictEqual(code, 1);
+  }));
+
+// An exception that is handled inside of the worker does not end it.
+new Worker(`
+  process.on('uncaughtException', () => process.exit(7));
+  setImmediate(() => { throw new Error('caught'); });
+`, { eval: true })
+  .on('error', common.fail)
+  .on('exit', common.mustCall((code) => {
+    assert.strictEqual(code, 7);
+  }));
+
+// terminate() stops a worker that never returns to its event loop.
+const w = new Worker(`
+  require('worker_threads').parentPort.postMessage('spinning');
+  for (;;);
+`, { eval: true });
+w.on('message', common.mustCall(() => {
+  w.terminate(common.mustCall((err, code) => {
+    assert.ifError(err);
+    assert.strictEqual(code, 1);
+  }));
+}));
+
+// unref() lets the process exit while the worker is still waiting.
+new Worker(`
+  require('worker_threads').parentPort.on('message', () => {});
+`, { eval: true }).unref();
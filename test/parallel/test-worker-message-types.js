@@ -0,0 +1,68 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const Worker = require('worker_threads').Worker;
+
+// Sends every value through a worker and back, which clones it twice.
+const w = new Worker(`
+  const parentPort = require('worker_threads').parentPort;
+  parentPort.on('message', (value) => {
+    if (value === 'done')
+      return parentPort.removeAllListeners('message');
+    parentPort.postMessage(value);
+  });
+`, { eval: true });
+
+const cyclic = { name: 'cyclic' };
+cyclic.self = cyclic;
+const sparse = [1, , 3];  // eslint-disable-line no-sparse-arrays
+sparse[10] = 'ten';
+
+const values = [
+  undefined, null, true, false, 0, -1, 2147483648, -0.5, NaN, Infinity,
+  '', 'ascii', 'two-byte é中😀',
+  [1, 'two', [3]], sparse, { a: 1, b: { c: [] }, 10: 'index' },
+  new Date(1234567890), /ab+c/gi, new Map([[1, 'one'], [{}, []]]),
+  new Set([1, 'two', {}]), new Number(3), new String('str'),
+  new Boolean(false), new Uint8Array([1, 2, 3]),
+  new Float64Array([1.5, -2.5]).subarray(1), new DataView(new ArrayBuffer(4)),
+  new ArrayBuffer(8), Buffer.from('buffer'), cyclic
+];
+
+const received = [];
+w.on('message', (value) => {
+  received.push(value);
+  if (received.length === values.length)
+    w.postMessage('done');
+});
+
+for (const value of values)
+  w.postMessage(value);
+
+w.on('exit', common.mustCall(() => {
+  assert.strictEqual(received.length, values.length);
+  for (let i = 0; i < values.length; i++) {
+    const expected = values[i];
+    const actual = received[i];
+    if (expected === cyclic) {
+      assert.strictEqual(actual.self, actual);
+      assert.strictEqual(actual.name, 'cyclic');
+    } else if (typeof expected === 'number' && isNaN(expected)) {
+      assert(isNaN(actual));
+    } else if (typeof expected === 'object' && expected !== null) {
+      assert.strictEqual(Object.prototype.toString.call(actual),
+                         Object.prototype.toString.call(expected));
+      assert.deepStrictEqual(actual, expected);
+    } else {
+      assert.strictEqual(actual, expected);
+    }
+  }
+  assert(Buffer.isBuffer(received[values.length - 2]));
+}));
+
+// Values that cannot be cloned throw synchronously.
+assert.throws(() => w.postMessage(() => {}), /could not be cloned/);
+assert.throws(() => w.postMessage(Symbol('s')), /could not be cloned/);
+assert.throws(() => w.postMessage(new WeakMap()), /could not be cloned/);
+assert.throws(() => new Worker('', { eval: true, workerData: () => {} }),
+              /could not be cloned/);
@@ -0,0 +1,57 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const Worker = require('worker_threads').Worker;
+
+// Workers can't change the state of the whole process, and get a copy of the
+// environment of their parent.
+process.env.NODE_TEST_WORKER_ENV = 'parent';
+
+const code = `
+  const { parentPort } = require('worker_threads');
+  const results = {};
+  function attempt(name, fn) {
+    try {
+      fn();
+      results[name] = 'ok';
+    } catch (err) {
+      results[name] = err.code;
+    }
+  }
+
+  attempt('chdir', () => process.chdir('..'));
+  attempt('umask', () => process.umask(0));
+  attempt('umask()', () => process.umask());
+  if (process.setuid)
+    attempt('setuid', () => process.setuid(process.getuid()));
+  if (process.setgroups)
+    attempt('setgroups', () => process.setgroups([]));
+  attempt('stdin', () => process.stdin);
+  attempt('signal', () => process.on('SIGINT', () => {}));
+  attempt('stdout', () => process.stdout.write(''));
+
+  results.env = process.env.NODE_TEST_WORKER_ENV;
+  process.env.NODE_TEST_WORKER_ENV = 'worker';
+  parentPort.postMessage(results);
+`;
+
+const w = new Worker(code, { eval: true });
+w.on('message', common.mustCall((results) => {
+  const unsupported = 'ERR_WORKER_UNSUPPORTED_OPERATION';
+  assert.strictEqual(results.chdir, unsupported);
+  assert.strictEqual(results.umask, unsupported);
+  assert.strictEqual(results['umask()'], 'ok');
+  if (!common.isWindows) {
+    assert.strictEqual(results.setuid, unsupported);
+    assert.strictEqual(results.setgroups, unsupported);
+  }
+  assert.strictEqual(results.stdin, unsupported);
+  assert.strictEqual(results.signal, unsupported);
+  assert.strictEqual(results.stdout, 'ok');
+  assert.strictEqual(results.env, 'parent');
+}));
+w.on('exit', common.mustCall((code) => {
+  assert.strictEqual(code, 0);
+  // The environment of the process is left alone.
+  assert.strictEqual(process.env.NODE_TEST_WORKER_ENV, 'parent');
+}));
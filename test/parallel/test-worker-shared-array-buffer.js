@@ -0,0 +1,42 @@
+// Flags: --harmony-sharedarraybuffer
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const Worker = require('worker_threads').Worker;
+
+// The workers increment the same counters, SharedArrayBuffers are shared
+// and not copied.
+const sab = new SharedArrayBuffer(8);
+const counters = new Int32Array(sab);
+const workers = 4;
+const iterations = 1000;
+
+const code = `
+  const { parentPort, workerData } = require('worker_threads');
+  const counters = new Int32Array(workerData.sab);
+  for (let i = 0; i < workerData.iterations; i++)
+    Atomics.add(counters, 0, 1);
+  parentPort.on('message', (view) => {
+    Atomics.add(view, 1, 1);
+    parentPort.postMessage(view.buffer);
+    parentPort.removeAllListeners('message');
+  });
+`;
+
+let exited = 0;
+for (let i = 0; i < workers; i++) {
+  const w = new Worker(code, { eval: true, workerData: { sab, iterations } });
+  w.on('message', common.mustCall((buffer) => {
+    assert(buffer instanceof SharedArrayBuffer);
+    assert.strictEqual(buffer.byteLength, 8);
+    assert(Atomics.load(new Int32Array(buffer), 1) >= 1);
+  }));
+  w.on('exit', common.mustCall((code) => {
+    assert.strictEqual(code, 0);
+    if (++exited === workers) {
+      assert.strictEqual(Atomics.load(counters, 0), workers * iterations);
+      assert.strictEqual(Atomics.load(counters, 1), workers);
+    }
+  }));
+  w.postMessage(counters);
+}
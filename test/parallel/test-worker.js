@@ -0,0 +1,31 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const { Worker, isMainThread, parentPort, workerData, threadId } =
+  require('worker_threads');
+
+if (isMainThread) {
+  assert.strictEqual(threadId, 0);
+  assert.strictEqual(parentPort, null);
+  assert.throws(() => new Worker(42), TypeError);
+  assert.throws(() => Worker(__filename), TypeError);
+
+  const w = new Worker(__filename, { workerData: { greeting: 'hello' } });
+  assert.strictEqual(typeof w.threadId, 'number');
+  assert.notStrictEqual(w.threadId, 0);
+  w.on('message', common.mustCall((message) => {
+    assert.strictEqual(message, 'hello world');
+    w.postMessage('exit');
+  }));
+  w.on('exit', common.mustCall((code) => {
+    assert.strictEqual(code, 0);
+  }));
+  w.postMessage('world');
+} else {
+  assert.notStrictEqual(threadId, 0);
+  parentPort.on('message', (message) => {
+    if (message === 'exit')
+      return parentPort.removeAllListeners('message');
+    parentPort.postMessage(`${workerData.greeting} ${message}`);
+  });
+}
@@ -0,0 +1,178 @@
+// Compiles the core modules and writes their V8 code caches out as a C++
+// source file that defines node::NodeNativeCodeCache(), see
+// src/node_code_cache.h.
+//
+// Usage: node_mkcodecache <output.cc>
+
+#include "node_natives.h"
+#include "node_code_cache.h"
+#include "libplatform/libplatform.h"
+#include "v8.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+
+using v8::ArrayBuffer;
+using v8::Context;
+using v8::HandleScope;
+using v8::Isolate;
+using v8::Local;
+using v8::NewStringType;
+using v8::ScriptCompiler;
+using v8::ScriptOrigin;
+using v8::String;
+using v8::TryCatch;
+using v8::UnboundScript;
+using v8::V8;
+
+// Must match NativeModule.wrapper in lib/internal/bootstrap_node.js, V8 only
+// accepts a code cache for the exact same source.
+static const char kWrapperStart[] =
+    "(function (exports, require, module, __filename, __dirname) { ";
+static const char kWrapperEnd[] = "\n});";
+
+// The bootstrap function is run by node::LoadEnvironment() directly and does
+// not go through NativeModule, a cache for it would never be consumed.
+static const char kBootstrapId[] = "internal/bootstrap_node";
+
+
+class ArrayBufferAllocator : public ArrayBuffer::Allocator {
+ public:
+  void* Allocate(size_t size) override { return calloc(size, 1); }
+  void* AllocateUninitialized(size_t size) override { return malloc(size); }
+  void Free(void* data, size_t) override { free(data); }
+};
+
+
+static Local<String> OneByteString(Isolate* isolate,
+                                   const void* data,
+                                   size_t length) {
+  return String::NewFromOneByte(isolate,
+                                static_cast<const uint8_t*>(data),
+                                NewStringType::kNormal,
+                                static_cast<int>(length)).ToLocalChecked();
+}
+
+
+// Writes the code cache of a single module as `static const uint8_t
+// cache_<n>[]`, returns false if V8 did not produce one.
+static bool WriteCache(FILE* fp,
+                       Isolate* isolate,
+                       const std::string& id,
+                       const uint8_t* data,
+                       size_t length,
+                       size_t n) {
+  std::string source(reinterpret_cast<const char*>(data), length);
+  source = kWrapperStart + source + kWrapperEnd;
+  std::string filename = id + ".js";
+
+  TryCatch try_catch(isolate);
+  ScriptOrigin origin(OneByteString(isolate, filename.data(), filename.size()));
+  ScriptCompiler::Source script_source(
+      OneByteString(isolate, source.data(), source.size()), origin);
+  Local<UnboundScript> script;
+  if (!ScriptCompiler::CompileUnboundScript(
+          isolate,
+          &script_source,
+          ScriptCompiler::kProduceCodeCache).ToLocal(&script)) {
+    fprintf(stderr, "node_mkcodecache: failed to compile %s\n", id.c_str());
+    return false;
+  }
+
+  const ScriptCompiler::CachedData* cached_data =
+      script_source.GetCachedData();
+  if (cached_data == nullptr || cached_data->length <= 0) {
+    fprintf(stderr, "node_mkcodecache: no code cache for %s\n", id.c_str());
+    return false;
+  }
+
+  fprintf(fp, "static const uint8_t cache_%zu[] = {\n", n);
+  for (int i = 0; i < cached_data->length; i++) {
+    fprintf(fp, "%u,", cached_data->data[i]);
+    if (i % 32 == 31)
+      fprintf(fp, "\n");
+  }
+  fprintf(fp, "\n};\n\n");
+  return true;
+}
+
+
+int main(int argc, char* argv[]) {
+  if (argc != 2) {
+    fprintf(stderr, "Usage: %s <output.cc>\n", argv[0]);
+    return 1;
+  }
+
+  V8::InitializeICU();
+  v8::Platform* platform = v8::platform::CreateDefaultPlatform();
+  V8::InitializePlatform(platform);
+  V8::Initialize();
+
+  FILE* fp = fopen(argv[1], "w");
+  if (fp == nullptr) {
+    perror(argv[1]);
+    return 1;
+  }
+
+  fprintf(fp, "// Generated by tools/code_cache/node_mkcodecache.cc, "
+              "do not edit.\n\n");
+  fprintf(fp, "#include \"node_code_cache.h\"\n\n");
+  fprintf(fp, "namespace node {\n\n");
+
+  std::string table;
+  bool ok = true;
+  {
+    ArrayBufferAllocator allocator;
+    Isolate::CreateParams params;
+    params.array_buffer_allocator = &allocator;
+    Isolate* isolate = Isolate::New(params);
+    {
+      Isolate::Scope isolate_scope(isolate);
+      HandleScope handle_scope(isolate);
+      Local<Context> context = Context::New(isolate);
+      Context::Scope context_scope(context);
+      size_t n = 0;
+
+#define V(id)                                                                 \
+      do {                                                                    \
+        std::string name(reinterpret_cast<const char*>(node::id##_name),      \
+                         sizeof(node::id##_name));                            \
+        if (!ok || name == kBootstrapId)                                      \
+          break;                                                              \
+        ok = WriteCache(fp, isolate, name, node::id##_data,                   \
+                        sizeof(node::id##_data), n);                          \
+        table += "  { \"" + name + "\", cache_" + std::to_string(n) +         \
+                 ", sizeof(cache_" + std::to_string(n) + ") },\n";            \
+        n++;                                                                  \
+      } while (0);
+      NODE_NATIVES_MAP(V)
+#undef V
+    }
+    isolate->Dispose();
+  }
+
+  fprintf(fp, "static const NativeCodeCache code_cache[] = {\n");
+  fprintf(fp, "%s", table.c_str());
+  fprintf(fp, "  { nullptr, nullptr, 0 }\n");
+  fprintf(fp, "};\n\n");
+  fprintf(fp, "const NativeCodeCache* NodeNativeCodeCache() {\n");
+  fprintf(fp, "  return code_cache;\n");
+  fprintf(fp, "}\n\n");
+  fprintf(fp, "}  // namespace node\n");
+
+  V8::Dispose();
+  V8::ShutdownPlatform();
+  delete platform;
+
+  ok = ok && ferror(fp) == 0;
+  if (fclose(fp) != 0 || !ok) {
+    if (ok)
+      perror(argv[1]);
+    remove(argv[1]);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,192 @@
+// Creates the startup snapshot described in src/node_snapshot.h and writes it
+// out as a C++ source file that defines node::NodeSnapshotBlob().
+//
+// Usage: node_mksnapshot <output.cc>
+
+#include "node_natives.h"
+#include "node_snapshot.h"
+#include "libplatform/libplatform.h"
+#include "v8.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+
+using v8::Context;
+using v8::Function;
+using v8::HandleScope;
+using v8::Isolate;
+using v8::Local;
+using v8::NewStringType;
+using v8::Object;
+using v8::Script;
+using v8::ScriptOrigin;
+using v8::SnapshotCreator;
+using v8::StartupData;
+using v8::String;
+using v8::TryCatch;
+using v8::V8;
+using v8::Value;
+
+// Must match NativeModule.wrapper in lib/internal/bootstrap_node.js, stack
+// traces and the debugger rely on the exact same source.
+static const char kWrapperStart[] =
+    "(function (exports, require, module, __filename, __dirname) { ";
+static const char kWrapperEnd[] = "\n});";
+
+// The bootstrap function is not wrapped and keeps the name that
+// node::LoadEnvironment() uses for it.
+static const char kBootstrapId[] = "internal/bootstrap_node";
+static const char kBootstrapFilename[] = "bootstrap_node.js";
+
+
+static Local<String> OneByteString(Isolate* isolate,
+                                   const void* data,
+                                   size_t length) {
+  return String::NewFromOneByte(isolate,
+                                static_cast<const uint8_t*>(data),
+                                NewStringType::kNormal,
+                                static_cast<int>(length)).ToLocalChecked();
+}
+
+
+static bool Compile(Local<Context> context,
+                    Local<Object> natives,
+                    const std::string& id,
+                    const uint8_t* data,
+                    size_t length) {
+  Isolate* isolate = context->GetIsolate();
+  const bool is_bootstrap = id == kBootstrapId;
+
+  std::string source(reinterpret_cast<const char*>(data), length);
+  std::string filename = id + ".js";
+  if (is_bootstrap)
+    filename = kBootstrapFilename;
+  else
+    source = kWrapperStart + source + kWrapperEnd;
+
+  TryCatch try_catch(isolate);
+  ScriptOrigin origin(OneByteString(isolate, filename.data(), filename.size()));
+  Local<Script> script;
+  Local<Value> fn;
+  if (!Script::Compile(context,
+                       OneByteString(isolate, source.data(), source.size()),
+                       &origin).ToLocal(&script) ||
+      !script->Run(context).ToLocal(&fn) ||
+      !fn->IsFunction()) {
+    fprintf(stderr, "node_mksnapshot: failed to compile %s\n", id.c_str());
+    return false;
+  }
+
+  return natives->Set(context,
+                      OneByteString(isolate, id.data(), id.size()),
+                      fn).FromJust();
+}
+
+
+static bool WriteBlob(const char* filename, const StartupData& blob) {
+  FILE* fp = fopen(filename, "w");
+  if (fp == nullptr) {
+    perror(filename);
+    return false;
+  }
+
+  fprintf(fp, "// Generated by tools/snapshot/node_mksnapshot.cc, "
+              "do not edit.\n\n");
+  fprintf(fp, "#include \"node_snapshot.h\"\n\n");
+  fprintf(fp, "namespace node {\n\n");
+  fprintf(fp, "static const char blob_data[] = {\n");
+  for (int i = 0; i < blob.raw_size; i++) {
+    fprintf(fp, "%d,", blob.data[i]);
+    if (i % 32 == 31)
+      fprintf(fp, "\n");
+  }
+  fprintf(fp, "\n};\n\n");
+  fprintf(fp, "static v8::StartupData blob = { blob_data, %d };\n\n",
+          blob.raw_size);
+  fprintf(fp, "v8::StartupData* NodeSnapshotBlob() {\n");
+  fprintf(fp, "  return &blob;\n");
+  fprintf(fp, "}\n\n");
+  fprintf(fp, "}  // namespace node\n");
+
+  const bool ok = ferror(fp) == 0;
+  if (fclose(fp) != 0 || !ok) {
+    perror(filename);
+    return false;
+  }
+  return true;
+}
+
+
+int main(int argc, char* argv[]) {
+  if (argc != 2) {
+    fprintf(stderr, "Usage: %s <output.cc>\n", argv[0]);
+    return 1;
+  }
+
+  V8::InitializeICU();
+  v8::Platform* platform = v8::platform::CreateDefaultPlatform();
+  V8::InitializePlatform(platform);
+  V8::Initialize();
+
+  StartupData blob = { nullptr, 0 };
+  {
+    SnapshotCreator creator;
+    Isolate* isolate = creator.GetIsolate();
+    bool ok = true;
+    {
+      HandleScope handle_scope(isolate);
+
+      // Context 0, the default context, stays pristine.
+      creator.AddContext(Context::New(isolate));
+
+      Local<Context> context = Context::New(isolate);
+      Context::Scope context_scope(context);
+      Local<Object> natives = Object::New(isolate);
+
+#define V(id)                                                                 \
+      ok = ok && Compile(context,                                             \
+                         natives,                                             \
+                         std::string(                                         \
+                             reinterpret_cast<const char*>(node::id##_name),  \
+                             sizeof(node::id##_name)),                        \
+                         node::id##_data,                                     \
+                         sizeof(node::id##_data));
+      NODE_NATIVES_MAP(V)
+#undef V
+
+      ok = ok && context->Global()->Set(
+          context,
+          OneByteString(isolate,
+                        NODE_SNAPSHOT_NATIVES_KEY,
+                        sizeof(NODE_SNAPSHOT_NATIVES_KEY) - 1),
+          natives).FromJust();
+
+      if (!ok)
+        return 1;
+
+      if (creator.AddContext(context) != node::kNodeSnapshotContextIndex) {
+        fprintf(stderr, "node_mksnapshot: unexpected context index\n");
+        return 1;
+      }
+    }
+
+    // Keep the compiled code, saving it is the point of the exercise.
+    blob = creator.CreateBlob(SnapshotCreator::FunctionCodeHandling::kKeep);
+  }
+
+  V8::Dispose();
+  V8::ShutdownPlatform();
+  delete platform;
+
+  if (blob.data == nullptr) {
+    fprintf(stderr, "node_mksnapshot: failed to create the snapshot\n");
+    return 1;
+  }
+
+  const bool ok = WriteBlob(argv[1], blob);
+  delete[] blob.data;
+  return ok ? 0 : 1;
+}